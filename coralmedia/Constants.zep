@@ -13,4 +13,42 @@ final class Constants {
     const LA_DIST_L2  = 1; // Euclidean
     const LA_DIST_LP  = 2; // Minkowski
     const LA_DIST_COS = 3; // Cosine
+
+    const LA_AXIS_NONE = 0; // Whole matrix
+    const LA_AXIS_ROWS = 1; // One result per row
+    const LA_AXIS_COLS = 2; // One result per column
+
+    const LA_REDUCE_SUM    = 0;
+    const LA_REDUCE_MEAN   = 1;
+    const LA_REDUCE_VAR    = 2;
+    const LA_REDUCE_MIN    = 3;
+    const LA_REDUCE_MAX    = 4;
+    const LA_REDUCE_ARGMIN = 5;
+    const LA_REDUCE_ARGMAX = 6;
+
+    const LA_ACT_IDENTITY    = 0;
+    const LA_ACT_RELU        = 1;
+    const LA_ACT_SIGMOID     = 2;
+    const LA_ACT_TANH        = 3;
+    const LA_ACT_GELU        = 4; // tanh approximation
+    const LA_ACT_SOFTMAX     = 5; // row-wise
+    const LA_ACT_LOG_SOFTMAX = 6; // row-wise
+
+    const LA_LOSS_LOG   = 0; // logistic regression
+    const LA_LOSS_HINGE = 1; // linear SVM
+
+    const LA_OPT_SGD     = 0;
+    const LA_OPT_ADAGRAD = 1;
+
+    const TEXT_TF_RAW    = 0;
+    const TEXT_TF_LOG    = 1; // sign(tf) * log(1 + |tf|)
+    const TEXT_TF_BINARY = 2;
+
+    const TEXT_NORM_NONE = -1;
+    const TEXT_NORM_L1   = 0;
+    const TEXT_NORM_L2   = 1;
+
+    const TEXT_OUTPUT_SPARSE = 0; // index => value
+    const TEXT_OUTPUT_DENSE  = 1; // list of 2^bits values
+    const TEXT_OUTPUT_PACKED = 2; // float32 buffer, rows x 2^bits
 }
\ No newline at end of file
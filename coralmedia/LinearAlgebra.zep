@@ -1,27 +1,30 @@
 namespace CoralMedia;
 
-use CoralMedia\LinearAlgebra\Vector;
-use CoralMedia\LinearAlgebra\Matrix;
+use CoralMedia\LinearAlgebra\KMeans;
 
 class LinearAlgebra
 {
     public static function dot(array! a, array! b) -> float
     {
-        return Vector\Dot::calc(a, b);
+        // intercepted by optimizer
+        return linear_algebra_dot(a, b);
     }
 
     public static function norm(array! x, int method = Constants::LA_NORM_L2) -> float
     {
-        return Vector\Norm::calc(x, method);
+        // intercepted by optimizer
+        return linear_algebra_norm(x, method);
     }
 
     public static function normalize(array! x, int method = Constants::LA_NORM_L2) -> array
     {
-        return Vector\Normalize::calc(x, method);
+        // intercepted by optimizer
+        return linear_algebra_vector_normalize(x, method);
     }
 
     public static function svd(array x, int rows, int cols, string jobz = Constants::LA_SVD_VALUES) -> array {
-        return Matrix\Svd::calc(x, rows, cols, jobz);
+        // intercepted by optimizer
+        return linear_algebra_svd(x, rows, cols, jobz);
     }
 
     public static function distance(
@@ -30,7 +33,8 @@ class LinearAlgebra
         int method = Constants::LA_DIST_L2,
         float p = 3.0
     ) -> float {
-        return Vector\Distance::calc(a, b, method, p);
+        // intercepted by optimizer
+        return linear_algebra_vector_distance(a, b, method, p);
     }
 
     public static function matmul(
@@ -42,38 +46,207 @@ class LinearAlgebra
         bool transpose_a = false,
         bool transpose_b = false
     ) -> array {
-        return Matrix\Matmul::calc(a, b, m, n, k, transpose_a, transpose_b);
+        // intercepted by optimizer
+        return linear_algebra_matmul(a, b, m, n, k, transpose_a, transpose_b);
     }
 
     public static function matrixAdd(array! a, array! b, int rows, int cols) -> array {
-        return Matrix\Add::calc(a, b, rows, cols);
+        // intercepted by optimizer
+        return linear_algebra_matrix_add(a, b, rows, cols);
     }
 
     public static function matrixSubtract(array! a, array! b, int rows, int cols) -> array {
-        return Matrix\Subtract::calc(a, b, rows, cols);
+        // intercepted by optimizer
+        return linear_algebra_matrix_subtract(a, b, rows, cols);
     }
 
     public static function matrixHadamard(array! a, array! b, int rows, int cols) -> array {
-        return Matrix\Hadamard::calc(a, b, rows, cols);
+        // intercepted by optimizer
+        return linear_algebra_matrix_hadamard(a, b, rows, cols);
     }
 
     public static function matrixDivide(array! a, array! b, int rows, int cols) -> array {
-        return Matrix\Divide::calc(a, b, rows, cols);
+        // intercepted by optimizer
+        return linear_algebra_matrix_divide(a, b, rows, cols);
     }
 
     public static function matrixScale(array! a, float scalar, int rows, int cols) -> array {
-        return Matrix\Scale::calc(a, scalar, rows, cols);
+        // intercepted by optimizer
+        return linear_algebra_matrix_scale(a, scalar, rows, cols);
     }
 
     public static function matrixAddScalar(array! a, float scalar, int rows, int cols) -> array {
-        return Matrix\Scale::addScalar(a, scalar, rows, cols);
+        // intercepted by optimizer
+        return linear_algebra_matrix_add_scalar(a, scalar, rows, cols);
     }
 
     public static function matrixMultiplyScalar(array! a, float scalar, int rows, int cols) -> array {
-        return Matrix\Scale::multiplyScalar(a, scalar, rows, cols);
+        // intercepted by optimizer
+        return linear_algebra_matrix_multiply_scalar(a, scalar, rows, cols);
     }
 
     public static function matrixDivideScalar(array! a, float scalar, int rows, int cols) -> array {
-        return Matrix\Scale::divideScalar(a, scalar, rows, cols);
+        // intercepted by optimizer
+        return linear_algebra_matrix_divide_scalar(a, scalar, rows, cols);
+    }
+
+    public static function matrixReduce(array! a, int rows, int cols, int op, int axis = Constants::LA_AXIS_NONE) {
+        // intercepted by optimizer
+        return linear_algebra_matrix_reduce(a, rows, cols, op, axis);
+    }
+
+    public static function matrixSum(array! a, int rows, int cols, int axis = Constants::LA_AXIS_NONE) {
+        // intercepted by optimizer
+        return linear_algebra_matrix_reduce(a, rows, cols, Constants::LA_REDUCE_SUM, axis);
+    }
+
+    public static function matrixMean(array! a, int rows, int cols, int axis = Constants::LA_AXIS_NONE) {
+        // intercepted by optimizer
+        return linear_algebra_matrix_reduce(a, rows, cols, Constants::LA_REDUCE_MEAN, axis);
+    }
+
+    public static function matrixVariance(array! a, int rows, int cols, int axis = Constants::LA_AXIS_NONE) {
+        // intercepted by optimizer
+        return linear_algebra_matrix_reduce(a, rows, cols, Constants::LA_REDUCE_VAR, axis);
+    }
+
+    public static function matrixMin(array! a, int rows, int cols, int axis = Constants::LA_AXIS_NONE) {
+        // intercepted by optimizer
+        return linear_algebra_matrix_reduce(a, rows, cols, Constants::LA_REDUCE_MIN, axis);
+    }
+
+    public static function matrixMax(array! a, int rows, int cols, int axis = Constants::LA_AXIS_NONE) {
+        // intercepted by optimizer
+        return linear_algebra_matrix_reduce(a, rows, cols, Constants::LA_REDUCE_MAX, axis);
+    }
+
+    public static function matrixArgmin(array! a, int rows, int cols, int axis = Constants::LA_AXIS_NONE) {
+        // intercepted by optimizer
+        return linear_algebra_matrix_reduce(a, rows, cols, Constants::LA_REDUCE_ARGMIN, axis);
+    }
+
+    public static function matrixArgmax(array! a, int rows, int cols, int axis = Constants::LA_AXIS_NONE) {
+        // intercepted by optimizer
+        return linear_algebra_matrix_reduce(a, rows, cols, Constants::LA_REDUCE_ARGMAX, axis);
+    }
+
+    public static function activation(array! a, int rows, int cols, int fn) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matrix_activation(a, rows, cols, fn);
+    }
+
+    public static function relu(array! a, int rows, int cols) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matrix_activation(a, rows, cols, Constants::LA_ACT_RELU);
+    }
+
+    public static function sigmoid(array! a, int rows, int cols) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matrix_activation(a, rows, cols, Constants::LA_ACT_SIGMOID);
+    }
+
+    public static function tanh(array! a, int rows, int cols) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matrix_activation(a, rows, cols, Constants::LA_ACT_TANH);
+    }
+
+    public static function gelu(array! a, int rows, int cols) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matrix_activation(a, rows, cols, Constants::LA_ACT_GELU);
+    }
+
+    public static function softmax(array! a, int rows, int cols) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matrix_activation(a, rows, cols, Constants::LA_ACT_SOFTMAX);
+    }
+
+    public static function logSoftmax(array! a, int rows, int cols) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matrix_activation(a, rows, cols, Constants::LA_ACT_LOG_SOFTMAX);
+    }
+
+    public static function logSumExp(array! a, int rows, int cols) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matrix_logsumexp(a, rows, cols);
+    }
+
+    public static function pack(array! x) -> string {
+        // intercepted by optimizer
+        return linear_algebra_pack(x);
+    }
+
+    public static function unpack(string packed) -> array {
+        // intercepted by optimizer
+        return linear_algebra_unpack(packed);
+    }
+
+    public static function kmeans(array! x, int rows, int cols, int k, array options = []) -> array {
+        var model;
+
+        let model = new KMeans(k, options);
+
+        return model->fit(x, rows, cols);
+    }
+
+    public static function matmul3x3(array! a, array! b) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matmul(a, b, 3, 3, 3, false, false);
+    }
+
+    public static function matmul4x4(array! a, array! b) -> array {
+        // intercepted by optimizer
+        return linear_algebra_matmul(a, b, 4, 4, 4, false, false);
+    }
+
+    public static function cosineSimilarity(array! a, array! b) -> float {
+        // intercepted by optimizer (fused)
+        return linear_algebra_dot(
+            linear_algebra_vector_normalize(a, Constants::LA_NORM_L2),
+            linear_algebra_vector_normalize(b, Constants::LA_NORM_L2)
+        );
+    }
+
+    public static function sparseDot(array! a, array! b) -> float {
+        // intercepted by optimizer
+        return linear_algebra_sparse_dot(a, b);
+    }
+
+    public static function sparseCosine(array! a, array! b) -> float {
+        // intercepted by optimizer
+        return linear_algebra_sparse_cosine(a, b);
+    }
+
+    public static function affineHadamard(array! a, float scale, float shift, array! b, int rows, int cols) -> array {
+        // intercepted by optimizer (fused)
+        return linear_algebra_matrix_hadamard(
+            linear_algebra_matrix_add_scalar(
+                linear_algebra_matrix_scale(a, scale, rows, cols),
+                shift,
+                rows,
+                cols
+            ),
+            b,
+            rows,
+            cols
+        );
+    }
+
+    public static function matmulAddScalar(
+        array! a,
+        array! b,
+        int m,
+        int n,
+        int k,
+        float scalar,
+        bool transpose_a = false,
+        bool transpose_b = false
+    ) -> array {
+        // intercepted by optimizer (fused)
+        return linear_algebra_matrix_add_scalar(
+            linear_algebra_matmul(a, b, m, n, k, transpose_a, transpose_b),
+            scalar,
+            m,
+            k
+        );
     }
 }
\ No newline at end of file
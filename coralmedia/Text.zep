@@ -1,7 +1,7 @@
 namespace CoralMedia;
 
-use CoralMedia\Text\Tokenizer\Icu;
-use CoralMedia\Stemmer\Snowball;
+use CoralMedia\Text\HashingVectorizer;
+use CoralMedia\Text\TokenStream;
 
 class Text
 {
@@ -12,6 +12,21 @@ class Text
      *
      * Options:
      * - strip_numbers: bool (default false) - Remove numeric tokens from results
+     * - stop_words: bool|string|array (default false) - Remove stop words: true for the
+     *   built-in list of the locale's language, a language ("french", "fr") or a name
+     *   given to registerStopWords(), or an array of words. Matching ignores case.
+     * - break_rules: string (default none) - Break with rules given to registerBreakRules()
+     *   instead of the locale's word rules
+     * - types: string|array (default all) - Keep only these token categories, from ICU's
+     *   rule status: "number", "letter", "kana", "ideo", or "other" (custom rule tags)
+     * - min_length, max_length: int (default none) - Keep only tokens of this many code
+     *   points, counted as written
+     * - ngrams: int|array (default none) - Word n-grams instead of words: n, or [min, max]
+     *   (up to 8); the words of an n-gram are joined with a space
+     * - char_ngrams: int|array (default none) - Character n-grams of each word instead:
+     *   n, or [min, max] grapheme clusters of the word padded with a space on both sides
+     * - hash_bits: int (default none) - Return MurmurHash3 columns (as HashingVectorizer,
+     *   with seed) instead of strings
      *
      * @param string text The text to tokenize
      * @param string locale The locale (default: "en_US")
@@ -20,24 +35,13 @@ class Text
      */
     public static function wordBreak(string text, string locale = "en_US", array options = []) -> array
     {
-        var tokens, token, stripNumbers, filtered;
-
-        let tokens = Icu::wordBreak(text, locale);
-
-        // Apply strip_numbers filter if requested
-        if fetch stripNumbers, options["strip_numbers"] {
-            if stripNumbers {
-                let filtered = [];
-                for token in tokens {
-                    if !is_numeric(token) {
-                        let filtered[] = token;
-                    }
-                }
-                return filtered;
-            }
+        if empty options {
+            // intercepted by optimizer
+            return icu_word_break(text, locale);
         }
 
-        return tokens;
+        // intercepted by optimizer
+        return text_word_break(text, locale, options);
     }
 
     /**
@@ -49,7 +53,8 @@ class Text
      */
     public static function sentenceBreak(string text, string locale = "en_US") -> array
     {
-        return Icu::sentenceBreak(text, locale);
+        // intercepted by optimizer
+        return icu_sentence_break(text, locale);
     }
 
     /**
@@ -61,7 +66,8 @@ class Text
      */
     public static function lowercase(string text, string locale = "en_US") -> string
     {
-        return Icu::lowercase(text, locale);
+        // intercepted by optimizer
+        return icu_lowercase(text, locale);
     }
 
     /**
@@ -72,7 +78,145 @@ class Text
      */
     public static function removeDiacritics(string text) -> string
     {
-        return Icu::removeDiacritics(text);
+        // intercepted by optimizer
+        return icu_remove_diacritics(text);
+    }
+
+    /**
+     * wordBreak() over an array of texts
+     *
+     * The break iterator (or, with options, the token pipeline) is opened once
+     * for the whole batch.
+     *
+     * @param array texts The texts to tokenize
+     * @param string locale The locale (default: "en_US")
+     * @param array options Configuration options, as in wordBreak()
+     * @return array One array of word tokens per text, keys preserved
+     */
+    public static function wordBreakAll(array texts, string locale = "en_US", array options = []) -> array
+    {
+        if empty options {
+            // intercepted by optimizer
+            return icu_word_break_all(texts, locale);
+        }
+
+        // intercepted by optimizer
+        return text_word_break(texts, locale, options);
+    }
+
+    /**
+     * sentenceBreak() over an array of texts, sharing one break iterator
+     *
+     * @param array texts The texts to split
+     * @param string locale The locale (default: "en_US")
+     * @return array One array of sentences per text, keys preserved
+     */
+    public static function sentenceBreakAll(array texts, string locale = "en_US") -> array
+    {
+        // intercepted by optimizer
+        return icu_sentence_break_all(texts, locale);
+    }
+
+    /**
+     * lowercase() over an array of texts, resolving the locale once
+     *
+     * @param array texts The texts to convert
+     * @param string locale The locale (default: "en_US")
+     * @return array Lowercase texts, keys preserved
+     */
+    public static function lowercaseAll(array texts, string locale = "en_US") -> array
+    {
+        // intercepted by optimizer
+        return icu_lowercase_all(texts, locale);
+    }
+
+    /**
+     * removeDiacritics() over an array of texts, sharing one transliterator
+     *
+     * @param array texts The texts to process
+     * @return array Texts with diacritics removed, keys preserved
+     */
+    public static function removeDiacriticsAll(array texts) -> array
+    {
+        // intercepted by optimizer
+        return icu_remove_diacritics_all(texts);
+    }
+
+    /**
+     * Number of words, as count(wordBreak(text, locale)) without building the array
+     *
+     * @param string text The text to count
+     * @param string locale The locale (default: "en_US")
+     * @return int Number of words
+     */
+    public static function countWords(string text, string locale = "en_US") -> int
+    {
+        // intercepted by optimizer
+        return icu_count_words(text, locale);
+    }
+
+    /**
+     * Number of sentences, as count(sentenceBreak(text, locale)) without building the array
+     *
+     * @param string text The text to count
+     * @param string locale The locale (default: "en_US")
+     * @return int Number of sentences
+     */
+    public static function countSentences(string text, string locale = "en_US") -> int
+    {
+        // intercepted by optimizer
+        return icu_count_sentences(text, locale);
+    }
+
+    /**
+     * Word, sentence and character counts in one native pass
+     *
+     * Returns words and sentences (as countWords() and countSentences()),
+     * graphemes (user-perceived characters), bytes, and avg_word_length
+     * (graphemes per word, 0.0 without words). No token is materialized.
+     *
+     * @param string text The text to measure
+     * @param string locale The locale (default: "en_US")
+     * @return array Associative array of counts
+     */
+    public static function textStats(string text, string locale = "en_US") -> array
+    {
+        // intercepted by optimizer
+        return icu_text_stats(text, locale);
+    }
+
+    /**
+     * Words of a stream or file, read in chunks with bounded memory
+     *
+     * @param resource|string source Readable stream resource, or a file path
+     * @param string locale The locale (default: "en_US")
+     * @param array options chunk_size (default 65536 bytes)
+     * @return TokenStream Iterator over the same words as wordBreak()
+     */
+    public static function wordBreakStream(var source, string locale = "en_US", array options = []) -> <TokenStream>
+    {
+        return new TokenStream(source, locale, options);
+    }
+
+    /**
+     * Unicode normalization in a single pass
+     *
+     * Forms: "NFC", "NFD", "NFKC", "NFKD" and "NFKC_Casefold" (compatibility
+     * folding plus case folding, for matching keys). With stripMarks the
+     * nonspacing marks are removed as well, so
+     * normalize(text, "NFKC_Casefold", true) replaces
+     * lowercase(removeDiacritics(text)). Text that is already normalized is
+     * returned without a copy.
+     *
+     * @param string text The text to normalize
+     * @param string form The normalization form (default: "NFKC_Casefold")
+     * @param bool stripMarks Also remove diacritics (default: false)
+     * @return string Normalized text
+     */
+    public static function normalize(string text, string form = "NFKC_Casefold", bool stripMarks = false) -> string
+    {
+        // intercepted by optimizer
+        return icu_normalize(text, form, stripMarks);
     }
 
     /**
@@ -88,6 +232,13 @@ class Text
      * - stem: bool (default false) - Apply stemming to terms
      * - stem_language: string (default "english") - Language for stemming
      * - strip_numbers: bool (default false) - Remove numeric tokens
+     * - stop_words: bool|string|array (default false) - Remove stop words, as in wordBreak();
+     *   true uses the list of stem_language when stemming, else of the locale's language
+     * - break_rules: string (default none) - Registered word-break rules, as in wordBreak()
+     * - types, min_length, max_length: Token category and length filters, as in wordBreak()
+     * - ngrams, char_ngrams: int|array (default none) - Count n-grams of the processed terms,
+     *   as in wordBreak()
+     * - hash_bits: int (default none) - Key the counts by MurmurHash3 column instead of term
      *
      * @param string text The text to analyze
      * @param array options Configuration options
@@ -95,102 +246,90 @@ class Text
      */
     public static function termFrequency(string text, array options = []) -> array
     {
-        var locale, normalize, toLowercase, removeDiacritics, applyStem, stemLanguage, stripNumbers;
-        var tokens, counts, term, total, processedTokens, stemmedTerm, wordBreakOptions;
-        var count, key;
-        double normalizedValue;
-
-        // Get options with defaults
-        if fetch locale, options["locale"] {
-            // locale is set
-        } else {
-            let locale = "en_US";
-        }
+        var normalize;
 
-        if fetch normalize, options["normalize"] {
-            // normalize is set
-        } else {
+        if !fetch normalize, options["normalize"] {
             let normalize = false;
         }
 
-        if fetch toLowercase, options["lowercase"] {
-            // toLowercase is set
-        } else {
-            let toLowercase = true;
-        }
-
-        if fetch removeDiacritics, options["remove_diacritics"] {
-            // removeDiacritics is set
-        } else {
-            let removeDiacritics = false;
-        }
-
-        if fetch applyStem, options["stem"] {
-            // applyStem is set
-        } else {
-            let applyStem = false;
-        }
-
-        if fetch stemLanguage, options["stem_language"] {
-            // stemLanguage is set
-        } else {
-            let stemLanguage = "english";
-        }
-
-        if fetch stripNumbers, options["strip_numbers"] {
-            // stripNumbers is set
-        } else {
-            let stripNumbers = false;
-        }
-
-        // Build wordBreak options
-        let wordBreakOptions = ["strip_numbers": stripNumbers];
-
-        // Tokenize text
-        let tokens = self::wordBreak(text, locale, wordBreakOptions);
+        // intercepted by optimizer
+        return text_term_frequency(text, options, normalize);
+    }
 
-        // Process tokens
-        let processedTokens = [];
-        for term in tokens {
-            if removeDiacritics {
-                let term = self::removeDiacritics(term);
-            }
-            if toLowercase {
-                let term = self::lowercase(term, locale);
-            }
-            if applyStem {
-                let stemmedTerm = Snowball::stem(term, stemLanguage);
-                if stemmedTerm !== null {
-                    let term = stemmedTerm;
-                }
-            }
-            let processedTokens[] = term;
-        }
+    /**
+     * Built-in or registered stop-word list
+     *
+     * @param string name Language ("english", "fr", ...) or name given to registerStopWords()
+     * @return array List of lowercase words
+     */
+    public static function stopWords(string name = "english") -> array
+    {
+        // intercepted by optimizer
+        return text_stop_words(name);
+    }
 
-        // Count frequencies
-        let counts = [];
-        for term in processedTokens {
-            if fetch count, counts[term] {
-                let counts[term] = count + 1;
-            } else {
-                let counts[term] = 1;
-            }
-        }
+    /**
+     * Register a custom stop-word list for the life of the process
+     *
+     * The words are lowercased and hashed once; afterwards the list is used by
+     * name with the stop_words option of wordBreak(), termFrequency(), idf()
+     * and the vectorizers. Registering an existing name replaces the list
+     * (the same words again keep the current one, so a worker may register
+     * per request), and a registered name takes precedence over a built-in
+     * language.
+     *
+     * @param string name List name
+     * @param array words Stop words
+     * @return int Number of distinct words
+     */
+    public static function registerStopWords(string name, array words) -> int
+    {
+        // intercepted by optimizer
+        return text_stop_words_register(name, words);
+    }
 
-        // Normalize if requested
-        if normalize {
-            let total = count(processedTokens);
-            if total > 0 {
-                var normalizedCounts = [];
-                for key, count in counts {
-                    let normalizedValue = (double) count / (double) total;
-                    let normalizedCounts[key] = normalizedValue;
-                }
-                return normalizedCounts;
-            }
-        }
+    /**
+     * Share one string per distinct token for the rest of the request
+     *
+     * Opt-in: wordBreak(), wordBreakAll(), wordBreakStream(), termFrequency()
+     * and Snowball::stem() then return shared, refcounted strings for
+     * repeated tokens and stems instead of one copy per occurrence, with
+     * their hash precomputed so array insertions do not hash them again.
+     * At most limit distinct strings are kept; later new ones are copied as
+     * usual. 0 switches interning off and releases the table, which is also
+     * released at the end of the request.
+     *
+     * @param int limit Most distinct strings kept (default 1048576, 0 = off)
+     * @return int Number of strings the table held before the call
+     */
+    public static function internTokens(int limit = 1048576) -> int
+    {
+        // intercepted by optimizer
+        return cm_intern_configure(limit);
+    }
 
-        return counts;
+    /**
+     * Register custom word-break rules for the life of the process
+     *
+     * The rules use ICU's RBBI syntax and are compiled once; the break_rules
+     * option of wordBreak(), termFrequency(), idf() and the vectorizers then
+     * selects them by name, so tokens such as URLs, e-mail addresses or
+     * "C++" come out whole in one native pass. Segments whose rule status
+     * is 0 (no {tag}) are skipped like whitespace and punctuation. The
+     * compiled form is returned: registered again with binary = true (same
+     * ICU major version), it skips compilation.
+     * Registering identical rules again under the same name is cheap and
+     * keeps the current copy, so a worker may register them per request.
+     *
+     * @param string name Rule set name
+     * @param string rules RBBI rule source, or compiled rules with binary
+     * @param bool binary rules is the string returned by an earlier call
+     * @return string Compiled rules
+     */
+    public static function registerBreakRules(string name, string rules, bool binary = false) -> string
+    {
+        // intercepted by optimizer
+        return text_break_rules_register(name, rules, binary);
     }
 
     /**
@@ -209,6 +348,10 @@ class Text
      * - stem: bool (default false) - Apply stemming to terms
      * - stem_language: string (default "english") - Language for stemming
      * - strip_numbers: bool (default false) - Remove numeric tokens
+     * - stop_words: bool|string|array (default false) - Remove stop words, as in termFrequency()
+     * - break_rules: string (default none) - Registered word-break rules, as in termFrequency()
+     * - types, min_length, max_length: Token filters, as in termFrequency()
+     * - ngrams, char_ngrams: int|array (default none) - Score n-grams, as in termFrequency()
      * - smooth: bool (default true) - Use smooth IDF to prevent division by zero
      *
      * @param array documents Array of document strings
@@ -217,87 +360,24 @@ class Text
      */
     public static function idf(array documents, array options = []) -> array
     {
-        var locale, toLowercase, removeDiacritics, applyStem, stemLanguage, stripNumbers, smooth;
-        var doc, tokens, term, documentFrequency, stemmedTerm, wordBreakOptions;
-        var termsSeen, numDocuments, idfScores, key, df;
+        var smooth, doc, terms, documentFrequency, key, df, numDocuments, idfScores;
         double idfScore;
 
-        // Get options with defaults
-        if fetch locale, options["locale"] {
-            // locale is set
-        } else {
-            let locale = "en_US";
-        }
-
-        if fetch toLowercase, options["lowercase"] {
-            // toLowercase is set
-        } else {
-            let toLowercase = true;
-        }
-
-        if fetch removeDiacritics, options["remove_diacritics"] {
-            // removeDiacritics is set
-        } else {
-            let removeDiacritics = false;
-        }
-
-        if fetch applyStem, options["stem"] {
-            // applyStem is set
-        } else {
-            let applyStem = false;
-        }
-
-        if fetch stemLanguage, options["stem_language"] {
-            // stemLanguage is set
-        } else {
-            let stemLanguage = "english";
-        }
-
-        if fetch stripNumbers, options["strip_numbers"] {
-            // stripNumbers is set
-        } else {
-            let stripNumbers = false;
-        }
-
         if fetch smooth, options["smooth"] {
             // smooth is set
         } else {
             let smooth = true;
         }
 
-        // Build wordBreak options
-        let wordBreakOptions = ["strip_numbers": stripNumbers];
-
-        // Count document frequency (number of documents containing each term)
+        // Count document frequency (number of documents containing each term):
+        // the keys of termFrequency() are the distinct terms of a document
         let documentFrequency = [];
         let numDocuments = count(documents);
 
         for doc in documents {
-            // Get unique terms in this document
-            let tokens = self::wordBreak(doc, locale, wordBreakOptions);
-            let termsSeen = [];
-
-            for term in tokens {
-                // Process term
-                if removeDiacritics {
-                    let term = self::removeDiacritics(term);
-                }
-                if toLowercase {
-                    let term = self::lowercase(term, locale);
-                }
-                if applyStem {
-                    let stemmedTerm = Snowball::stem(term, stemLanguage);
-                    if stemmedTerm !== null {
-                        let term = stemmedTerm;
-                    }
-                }
+            let terms = self::termFrequency(doc, options);
 
-                // Mark term as seen in this document (only count once per document)
-                let termsSeen[term] = true;
-            }
-
-            // Increment document frequency for each unique term
-            for key, _ in termsSeen {
+            for key, _ in terms {
                 if fetch df, documentFrequency[key] {
                     let documentFrequency[key] = df + 1;
                 } else {
@@ -325,6 +405,70 @@ class Text
         return idfScores;
     }
 
+    /**
+     * idf() over files on disk, one document per file
+     *
+     * The files are mapped (mmap) and tokenized in place, front to back: no
+     * PHP string is created for their content and memory does not grow with
+     * their size, so corpora larger than RAM can be scored.
+     *
+     * @param array paths Paths of the document files
+     * @param array options Same as idf()
+     * @return array Associative array of term => IDF score
+     */
+    public static function idfFromFiles(array paths, array options = []) -> array
+    {
+        var smooth;
+
+        if !fetch smooth, options["smooth"] {
+            let smooth = true;
+        }
+
+        // intercepted by optimizer
+        return text_corpus_idf(paths, false, options, smooth);
+    }
+
+    /**
+     * idf() over a newline-delimited corpus file, one document per line
+     *
+     * Every line counts as a document, blank ones included; "\r\n" line
+     * endings are accepted. The file is mapped as in idfFromFiles().
+     *
+     * @param string path Path of the corpus file
+     * @param array options Same as idf()
+     * @return array Associative array of term => IDF score
+     */
+    public static function idfFromCorpus(string path, array options = []) -> array
+    {
+        var smooth;
+
+        if !fetch smooth, options["smooth"] {
+            let smooth = true;
+        }
+
+        // intercepted by optimizer
+        return text_corpus_idf(path, true, options, smooth);
+    }
+
+    /**
+     * termFrequency() of a whole file, mapped as in idfFromFiles()
+     *
+     * @param string path Path of the document file
+     * @param array options Same as termFrequency()
+     * @return array Associative array of term => frequency
+     */
+    public static function termFrequencyFromFile(string path, array options = []) -> array
+    {
+        var normalize;
+
+        if !fetch normalize, options["normalize"] {
+            let normalize = false;
+        }
+
+        // intercepted by optimizer
+        return text_term_frequency_file(path, options, normalize);
+    }
+
     /**
      * Calculate TF-IDF (Term Frequency-Inverse Document Frequency) scores
      *
@@ -368,4 +512,24 @@ class Text
 
         return tfidfScores;
     }
+
+    /**
+     * Hash a document (or an array of documents) into a fixed-width sparse vector
+     *
+     * Uses the same term pipeline as termFrequency() without keeping a
+     * vocabulary. See HashingVectorizer for the options (bits, alternate_sign,
+     * tf, norm, seed) and for dense and packed output.
+     *
+     * @param string|array text The document(s) to vectorize
+     * @param array options Configuration options
+     * @return array Sparse vector: column index => value
+     */
+    public static function hashVector(var text, array options = []) -> array
+    {
+        var vectorizer;
+
+        let vectorizer = new HashingVectorizer(options);
+
+        return vectorizer->transform(text);
+    }
 }
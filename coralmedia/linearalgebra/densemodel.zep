@@ -0,0 +1,158 @@
+namespace CoralMedia\LinearAlgebra;
+
+use CoralMedia\Constants;
+
+/**
+ * Fully connected feed-forward model
+ *
+ * Weights and biases are converted to packed float32 buffers once, when a
+ * layer is added or a model file is loaded. predict() then runs the whole
+ * forward pass natively: one cblas_sgemm per layer with the bias broadcast
+ * through beta = 1, followed by the layer activation, returning only the
+ * final output.
+ */
+class DenseModel
+{
+    protected layers = [];
+
+    /**
+     * @param array layers - List of layer specs with keys
+     *                       weights, bias, inputs, outputs and optional activation
+     */
+    public function __construct(array layers = [])
+    {
+        var layer, weights, bias, inputs, outputs, activation;
+
+        for layer in layers {
+            if !fetch weights, layer["weights"] {
+                throw new \ValueError("DenseModel: layer requires 'weights'");
+            }
+            if !fetch bias, layer["bias"] {
+                throw new \ValueError("DenseModel: layer requires 'bias'");
+            }
+            if !fetch inputs, layer["inputs"] {
+                throw new \ValueError("DenseModel: layer requires 'inputs'");
+            }
+            if !fetch outputs, layer["outputs"] {
+                throw new \ValueError("DenseModel: layer requires 'outputs'");
+            }
+            if !fetch activation, layer["activation"] {
+                let activation = Constants::LA_ACT_IDENTITY;
+            }
+
+            this->addLayer(weights, bias, inputs, outputs, activation);
+        }
+    }
+
+    /**
+     * Append a layer: Y = act(X · W + bias)
+     *
+     * @param array weights - W as flat row-major array (inputs × outputs)
+     * @param array bias - Bias vector (outputs)
+     * @param int inputs - Number of layer inputs
+     * @param int outputs - Number of layer outputs
+     * @param int activation - Activation (Constants::LA_ACT_*)
+     * @return DenseModel
+     */
+    public function addLayer(
+        array! weights,
+        array! bias,
+        int inputs,
+        int outputs,
+        int activation = Constants::LA_ACT_IDENTITY
+    ) -> <DenseModel>
+    {
+        if count(weights) != inputs * outputs {
+            throw new \ValueError("DenseModel: weights size must be inputs * outputs");
+        }
+
+        if count(bias) != outputs {
+            throw new \ValueError("DenseModel: bias size must be outputs");
+        }
+
+        let this->layers[] = [
+            "inputs": inputs,
+            "outputs": outputs,
+            "activation": activation,
+            "weights": linear_algebra_pack(weights),
+            "bias": linear_algebra_pack(bias)
+        ];
+
+        return this;
+    }
+
+    /**
+     * Run the forward pass for a batch of inputs
+     *
+     * @param array inputs - Inputs as flat row-major array (batch × inputs of first layer)
+     * @param int batch - Number of rows in the batch
+     * @return array - Output of the last layer as flat row-major array
+     */
+    public function predict(array! inputs, int batch = 1) -> array
+    {
+        // intercepted by optimizer
+        return linear_algebra_dense_forward(this->layers, inputs, batch);
+    }
+
+    /**
+     * Serialize the model to its binary format
+     *
+     * @return string
+     */
+    public function toBinary() -> string
+    {
+        return linear_algebra_dense_save(this->layers);
+    }
+
+    /**
+     * Replace the layers with the ones stored in binary model data
+     *
+     * @param string data - Output of toBinary()
+     * @return DenseModel
+     */
+    public function loadBinary(string data) -> <DenseModel>
+    {
+        let this->layers = linear_algebra_dense_load(data);
+
+        return this;
+    }
+
+    /**
+     * Write the model to a binary file
+     *
+     * @param string path
+     * @return bool
+     */
+    public function save(string path) -> bool
+    {
+        return file_put_contents(path, this->toBinary()) !== false;
+    }
+
+    /**
+     * Load a model written by save()
+     *
+     * @param string path
+     * @return DenseModel
+     */
+    public static function fromFile(string path) -> <DenseModel>
+    {
+        var data, model;
+
+        let data = file_get_contents(path);
+        if data === false {
+            throw new \RuntimeException("DenseModel: cannot read " . path);
+        }
+
+        let model = new DenseModel();
+
+        return model->loadBinary(data);
+    }
+
+    /**
+     * @return array - Layer specs with packed weights and biases
+     */
+    public function getLayers() -> array
+    {
+        return this->layers;
+    }
+}
@@ -0,0 +1,185 @@
+namespace CoralMedia\LinearAlgebra;
+
+/**
+ * K-means clustering
+ *
+ * Training runs natively: k-means++ seeding, assignment through the
+ * ‖x‖² − 2·x·c + ‖c‖² expansion on cblas_sgemm and centroid updates
+ * accumulated in parallel. With batch_size > 0 centroids are updated from
+ * random mini-batches instead of full passes over the data.
+ *
+ * Fitted centroids are kept as a packed float32 buffer, so a trained model
+ * can be serialized and used as a codebook: predict() returns the index of
+ * the nearest centroid for every row.
+ */
+class KMeans
+{
+    protected k;
+    protected maxIterations = 300;
+    protected tolerance = 0.0001;
+    protected batchSize = 0;
+    protected seed = 0;
+    protected threads = 0;
+
+    protected cols = 0;
+    protected centroids = null;
+    protected labels = [];
+    protected inertia = 0.0;
+    protected iterations = 0;
+
+    /**
+     * @param int k - Number of clusters
+     * @param array options - Optional keys:
+     *                        max_iter (300), tol (1e-4, relative to the mean feature variance),
+     *                        batch_size (0 = full Lloyd iterations), seed (0 = fixed default),
+     *                        threads (0 = one per CPU)
+     */
+    public function __construct(int k, array options = [])
+    {
+        var value;
+
+        if k <= 0 {
+            throw new \ValueError("KMeans: k must be > 0");
+        }
+
+        let this->k = k;
+
+        if fetch value, options["max_iter"] {
+            let this->maxIterations = (int) value;
+        }
+        if fetch value, options["tol"] {
+            let this->tolerance = (double) value;
+        }
+        if fetch value, options["batch_size"] {
+            let this->batchSize = (int) value;
+        }
+        if fetch value, options["seed"] {
+            let this->seed = (int) value;
+        }
+        if fetch value, options["threads"] {
+            let this->threads = (int) value;
+        }
+    }
+
+    /**
+     * Cluster the rows of x
+     *
+     * @param array x - Samples as flat row-major array (rows × cols)
+     * @param int rows - Number of samples
+     * @param int cols - Number of features
+     * @return array - [centroids (flat k × cols), labels, inertia, iterations]
+     */
+    public function fit(array! x, int rows, int cols) -> array
+    {
+        var result;
+
+        // intercepted by optimizer
+        let result = linear_algebra_kmeans(
+            x,
+            rows,
+            cols,
+            this->k,
+            this->maxIterations,
+            this->tolerance,
+            this->batchSize,
+            this->seed,
+            this->threads
+        );
+
+        let this->cols = cols;
+        let this->centroids = linear_algebra_pack(result["centroids"]);
+        let this->labels = result["labels"];
+        let this->inertia = result["inertia"];
+        let this->iterations = result["iterations"];
+
+        return result;
+    }
+
+    /**
+     * Index of the nearest centroid for every row
+     *
+     * @param array x - Samples as flat row-major array (rows × cols)
+     * @param int rows - Number of samples
+     * @return array
+     */
+    public function predict(array! x, int rows) -> array
+    {
+        if this->centroids === null {
+            throw new \RuntimeException("KMeans: model is not fitted");
+        }
+
+        // intercepted by optimizer
+        return linear_algebra_kmeans_assign(x, rows, this->cols, this->centroids, this->k);
+    }
+
+    /**
+     * Use existing centroids (e.g. a stored codebook) without training
+     *
+     * @param array|string centroids - Flat k × cols array or packed buffer
+     * @param int k - Number of centroids
+     * @param int cols - Number of features
+     * @return KMeans
+     */
+    public static function fromCentroids(var centroids, int k, int cols) -> <KMeans>
+    {
+        var model;
+
+        if typeof centroids == "array" {
+            let centroids = linear_algebra_pack(centroids);
+        }
+
+        if typeof centroids != "string" || strlen(centroids) != 4 * k * cols {
+            throw new \ValueError("KMeans: centroids size must be k * cols");
+        }
+
+        let model = new KMeans(k);
+        model->setCentroids(centroids, cols);
+
+        return model;
+    }
+
+    /**
+     * @param string centroids - Packed k × cols buffer
+     * @param int cols - Number of features
+     */
+    protected function setCentroids(string centroids, int cols) -> void
+    {
+        let this->centroids = centroids;
+        let this->cols = cols;
+    }
+
+    /**
+     * @return array - Centroids as flat row-major array (k × cols)
+     */
+    public function getCentroids() -> array
+    {
+        if this->centroids === null {
+            return [];
+        }
+
+        return linear_algebra_unpack(this->centroids);
+    }
+
+    /**
+     * @return string|null - Centroids as packed float32 buffer
+     */
+    public function getPackedCentroids()
+    {
+        return this->centroids;
+    }
+
+    public function getLabels() -> array
+    {
+        return this->labels;
+    }
+
+    public function getInertia() -> double
+    {
+        return this->inertia;
+    }
+
+    public function getIterations() -> int
+    {
+        return this->iterations;
+    }
+}
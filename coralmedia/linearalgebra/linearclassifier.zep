@@ -0,0 +1,270 @@
+namespace CoralMedia\LinearAlgebra;
+
+use CoralMedia\Constants;
+
+/**
+ * Linear classifier over sparse feature maps
+ *
+ * Documents are arrays of feature => weight, e.g. the output of Text::tfidf()
+ * or rows of a sparse matrix keyed by column id. Training is native: the
+ * feature index and a CSR matrix are built once, then logistic regression
+ * (LA_LOSS_LOG) or a linear SVM (LA_LOSS_HINGE) is fitted with SGD or AdaGrad
+ * and L2 regularization, using lock-free (Hogwild) updates across threads.
+ * More than two classes are handled one-vs-rest.
+ *
+ * The model is a feature index, a list of classes and a packed float32
+ * weight buffer, so it can be serialized with serialize() or toArray().
+ */
+class LinearClassifier
+{
+    protected loss = 0;
+    protected optimizer = 1;
+    protected epochs = 5;
+    protected learningRate = 0.1;
+    protected lambda = 0.0001;
+    protected seed = 0;
+    protected threads = 0;
+
+    protected classes = [];
+    protected features = [];
+    protected weights = null;
+    protected outputs = 0;
+
+    /**
+     * @param array options - Optional keys:
+     *                        loss (Constants::LA_LOSS_LOG), optimizer (Constants::LA_OPT_ADAGRAD),
+     *                        epochs (5), learning_rate (0.1), lambda (1e-4, L2),
+     *                        seed (0 = fixed default), threads (0 = one per CPU)
+     */
+    public function __construct(array options = [])
+    {
+        var value;
+
+        if fetch value, options["loss"] {
+            let this->loss = (int) value;
+        }
+        if fetch value, options["optimizer"] {
+            let this->optimizer = (int) value;
+        }
+        if fetch value, options["epochs"] {
+            let this->epochs = (int) value;
+        }
+        if fetch value, options["learning_rate"] {
+            let this->learningRate = (double) value;
+        }
+        if fetch value, options["lambda"] {
+            let this->lambda = (double) value;
+        }
+        if fetch value, options["seed"] {
+            let this->seed = (int) value;
+        }
+        if fetch value, options["threads"] {
+            let this->threads = (int) value;
+        }
+    }
+
+    /**
+     * Train on labelled documents
+     *
+     * @param array docs - List of feature => weight arrays
+     * @param array labels - Class label (int or string) per document
+     * @return LinearClassifier
+     */
+    public function fit(array! docs, array! labels) -> <LinearClassifier>
+    {
+        var model;
+
+        // intercepted by optimizer
+        let model = linear_algebra_linear_train(
+            array_values(docs),
+            array_values(labels),
+            this->loss,
+            this->optimizer,
+            this->epochs,
+            this->learningRate,
+            this->lambda,
+            this->seed,
+            this->threads
+        );
+
+        let this->classes = model["classes"];
+        let this->features = model["features"];
+        let this->weights = model["weights"];
+        let this->outputs = model["outputs"];
+
+        return this;
+    }
+
+    /**
+     * Predicted class label per document
+     *
+     * @param array docs - List of feature => weight arrays
+     * @return array
+     */
+    public function predict(array! docs) -> array
+    {
+        var indexes, index, key, labels = [];
+
+        this->assertFitted();
+
+        // intercepted by optimizer
+        let indexes = linear_algebra_linear_predict(this->features, this->weights, this->outputs, docs, false);
+
+        for key, index in indexes {
+            let labels[key] = this->classes[index];
+        }
+
+        return labels;
+    }
+
+    /**
+     * Raw scores w·x + b per document
+     *
+     * @param array docs - List of feature => weight arrays
+     * @return array - One score per document (binary) or one array of per-class scores
+     */
+    public function decisionFunction(array! docs) -> array
+    {
+        var scores, row, key, result = [];
+
+        this->assertFitted();
+
+        // intercepted by optimizer
+        let scores = linear_algebra_linear_predict(this->features, this->weights, this->outputs, docs, true);
+
+        if this->outputs > 1 {
+            return scores;
+        }
+
+        for key, row in scores {
+            let result[key] = row[0];
+        }
+
+        return result;
+    }
+
+    /**
+     * Class probabilities (logistic loss only), keyed by class label
+     *
+     * Binary models use the sigmoid of the score; one-vs-rest models
+     * normalize the per-class sigmoids.
+     *
+     * @param array docs - List of feature => weight arrays
+     * @return array
+     */
+    public function predictProba(array! docs) -> array
+    {
+        var scores, row, key, score, probs, result = [];
+        double p, total;
+        int i;
+
+        if this->loss != Constants::LA_LOSS_LOG {
+            throw new \RuntimeException("LinearClassifier: probabilities require the logistic loss");
+        }
+
+        this->assertFitted();
+
+        // intercepted by optimizer
+        let scores = linear_algebra_linear_predict(this->features, this->weights, this->outputs, docs, true);
+
+        for key, row in scores {
+            let probs = [];
+
+            if this->outputs == 1 {
+                let p = 1.0 / (1.0 + exp(-row[0]));
+                let probs[this->classes[0]] = 1.0 - p;
+                let probs[this->classes[1]] = p;
+            } else {
+                let total = 0.0;
+                for score in row {
+                    let total += 1.0 / (1.0 + exp(-score));
+                }
+                let i = 0;
+                for score in row {
+                    let probs[this->classes[i]] = (1.0 / (1.0 + exp(-score))) / total;
+                    let i++;
+                }
+            }
+
+            let result[key] = probs;
+        }
+
+        return result;
+    }
+
+    /**
+     * @return array - Model state (classes, features, packed weights, outputs, loss)
+     */
+    public function toArray() -> array
+    {
+        return [
+            "classes": this->classes,
+            "features": this->features,
+            "weights": this->weights,
+            "outputs": this->outputs,
+            "loss": this->loss
+        ];
+    }
+
+    /**
+     * Restore a model exported with toArray()
+     *
+     * @param array model
+     * @return LinearClassifier
+     */
+    public static function fromArray(array model) -> <LinearClassifier>
+    {
+        var classifier, classes, features, weights, outputs, loss;
+
+        if !fetch classes, model["classes"] {
+            throw new \ValueError("LinearClassifier: model requires 'classes'");
+        }
+        if !fetch features, model["features"] {
+            throw new \ValueError("LinearClassifier: model requires 'features'");
+        }
+        if !fetch weights, model["weights"] {
+            throw new \ValueError("LinearClassifier: model requires 'weights'");
+        }
+        if !fetch outputs, model["outputs"] {
+            throw new \ValueError("LinearClassifier: model requires 'outputs'");
+        }
+        if !fetch loss, model["loss"] {
+            let loss = Constants::LA_LOSS_LOG;
+        }
+
+        // One score for two classes, otherwise one per class
+        if typeof classes != "array" || count(classes) != (outputs == 1 ? 2 : outputs) {
+            throw new \ValueError("LinearClassifier: 'classes' does not match 'outputs'");
+        }
+
+        let classifier = new LinearClassifier(["loss": loss]);
+        classifier->setModel(classes, features, weights, outputs);
+
+        return classifier;
+    }
+
+    protected function setModel(array classes, array features, string weights, int outputs) -> void
+    {
+        let this->classes = classes;
+        let this->features = features;
+        let this->weights = weights;
+        let this->outputs = outputs;
+    }
+
+    public function getClasses() -> array
+    {
+        return this->classes;
+    }
+
+    public function getFeatures() -> array
+    {
+        return this->features;
+    }
+
+    protected function assertFitted() -> void
+    {
+        if this->weights === null {
+            throw new \RuntimeException("LinearClassifier: model is not fitted");
+        }
+    }
+}
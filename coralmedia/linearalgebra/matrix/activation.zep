@@ -0,0 +1,34 @@
+namespace CoralMedia\LinearAlgebra\Matrix;
+
+class Activation
+{
+    /**
+     * Apply an activation function to every element (or every row for
+     * softmax / log-softmax) of a matrix
+     *
+     * @param array a - Matrix A as flat row-major array
+     * @param int rows - Number of rows
+     * @param int cols - Number of columns
+     * @param int fn - Activation (Constants::LA_ACT_*)
+     * @return array - Result matrix as flat row-major array
+     */
+    public static function calc(array! a, int rows, int cols, int fn) -> array
+    {
+        // intercepted by optimizer
+        return linear_algebra_matrix_activation(a, rows, cols, fn);
+    }
+
+    /**
+     * Numerically stable log(sum(exp(row))) for every row
+     *
+     * @param array a - Matrix A as flat row-major array
+     * @param int rows - Number of rows
+     * @param int cols - Number of columns
+     * @return array - One value per row
+     */
+    public static function logSumExp(array! a, int rows, int cols) -> array
+    {
+        // intercepted by optimizer
+        return linear_algebra_matrix_logsumexp(a, rows, cols);
+    }
+}
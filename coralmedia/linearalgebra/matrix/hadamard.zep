@@ -16,4 +16,33 @@ class Hadamard
         // intercepted by optimizer
         return linear_algebra_matrix_hadamard(a, b, rows, cols);
     }
+
+    /**
+     * Affine transform followed by a Hadamard product: C[i] = (scale × A[i] + shift) × B[i]
+     *
+     * Fused by the optimizer into one native pass over A and B.
+     *
+     * @param array a - Matrix A as flat row-major array
+     * @param float scale - Multiplier for A
+     * @param float shift - Scalar added after scaling
+     * @param array b - Matrix B as flat row-major array
+     * @param int rows - Number of rows
+     * @param int cols - Number of columns
+     * @return array - Result matrix C as flat row-major array
+     */
+    public static function affine(array! a, float scale, float shift, array! b, int rows, int cols) -> array
+    {
+        // intercepted by optimizer (fused)
+        return linear_algebra_matrix_hadamard(
+            linear_algebra_matrix_add_scalar(
+                linear_algebra_matrix_scale(a, scale, rows, cols),
+                shift,
+                rows,
+                cols
+            ),
+            b,
+            rows,
+            cols
+        );
+    }
 }
@@ -27,4 +27,66 @@ class Matmul
         // intercepted by optimizer
         return linear_algebra_matmul(a, b, m, n, k, transpose_a, transpose_b);
     }
+
+    /**
+     * 3×3 product; sizes are literals, so the optimizer emits the unrolled
+     * stack kernel instead of a BLAS call
+     *
+     * @param array a - 3×3 matrix as flat row-major array
+     * @param array b - 3×3 matrix as flat row-major array
+     * @return array - 3×3 result as flat row-major array
+     */
+    public static function calc3x3(array! a, array! b) -> array
+    {
+        // intercepted by optimizer
+        return linear_algebra_matmul(a, b, 3, 3, 3, false, false);
+    }
+
+    /**
+     * 4×4 product (e.g. homogeneous transforms), unrolled like calc3x3()
+     *
+     * @param array a - 4×4 matrix as flat row-major array
+     * @param array b - 4×4 matrix as flat row-major array
+     * @return array - 4×4 result as flat row-major array
+     */
+    public static function calc4x4(array! a, array! b) -> array
+    {
+        // intercepted by optimizer
+        return linear_algebra_matmul(a, b, 4, 4, 4, false, false);
+    }
+
+    /**
+     * Matrix product plus a scalar: C = A × B + scalar
+     *
+     * Fused by the optimizer into one cblas_sgemm with beta = 1.
+     *
+     * @param array a - Matrix A as flat row-major array
+     * @param array b - Matrix B as flat row-major array
+     * @param int m - Number of rows in A
+     * @param int n - Number of columns in A (= rows in B)
+     * @param int k - Number of columns in B
+     * @param float scalar - Scalar added to every element
+     * @param bool transpose_a - Whether to transpose A
+     * @param bool transpose_b - Whether to transpose B
+     * @return array - Result matrix C as flat row-major array (m × k)
+     */
+    public static function addScalar(
+        array! a,
+        array! b,
+        int m,
+        int n,
+        int k,
+        float scalar,
+        bool transpose_a = false,
+        bool transpose_b = false
+    ) -> array
+    {
+        // intercepted by optimizer (fused)
+        return linear_algebra_matrix_add_scalar(
+            linear_algebra_matmul(a, b, m, n, k, transpose_a, transpose_b),
+            scalar,
+            m,
+            k
+        );
+    }
 }
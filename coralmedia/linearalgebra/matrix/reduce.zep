@@ -0,0 +1,24 @@
+namespace CoralMedia\LinearAlgebra\Matrix;
+
+class Reduce
+{
+    /**
+     * Reduce a matrix along an axis
+     *
+     * LA_AXIS_NONE reduces the whole matrix to a scalar, LA_AXIS_ROWS yields
+     * one value per row and LA_AXIS_COLS one value per column.
+     * Argmin/argmax return integer indexes (flat index for LA_AXIS_NONE).
+     *
+     * @param array a - Matrix A as flat row-major array
+     * @param int rows - Number of rows
+     * @param int cols - Number of columns
+     * @param int op - Reduction (Constants::LA_REDUCE_*)
+     * @param int axis - Axis (Constants::LA_AXIS_*)
+     * @return array|float|int - Scalar for LA_AXIS_NONE, array otherwise
+     */
+    public static function calc(array! a, int rows, int cols, int op, int axis = 0)
+    {
+        // intercepted by optimizer
+        return linear_algebra_matrix_reduce(a, rows, cols, op, axis);
+    }
+}
@@ -0,0 +1,28 @@
+namespace CoralMedia\LinearAlgebra;
+
+class Packed
+{
+    /**
+     * Convert a numeric array to a packed float32 binary string
+     *
+     * @param array x - Numeric values
+     * @return string - sizeof(float) * count(x) bytes, native byte order
+     */
+    public static function pack(array! x) -> string
+    {
+        // intercepted by optimizer
+        return linear_algebra_pack(x);
+    }
+
+    /**
+     * Convert a packed float32 binary string back to an array
+     *
+     * @param string packed - Output of pack()
+     * @return array
+     */
+    public static function unpack(string packed) -> array
+    {
+        // intercepted by optimizer
+        return linear_algebra_unpack(packed);
+    }
+}
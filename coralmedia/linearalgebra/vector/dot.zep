@@ -1,5 +1,7 @@
 namespace CoralMedia\LinearAlgebra\Vector;
 
+use CoralMedia\Constants;
+
 class Dot
 {
     public static function calc(array! a, array! b) -> float
@@ -7,4 +9,23 @@ class Dot
         // intercepted by optimizer
         return linear_algebra_dot(a, b);
     }
+
+    /**
+     * Cosine similarity: dot(normalize(a), normalize(b))
+     *
+     * The nested calls are fused by the optimizer into a single native call,
+     * so the normalized vectors never become PHP arrays.
+     *
+     * @param array a
+     * @param array b
+     * @return float
+     */
+    public static function cosine(array! a, array! b) -> float
+    {
+        // intercepted by optimizer (fused)
+        return linear_algebra_dot(
+            linear_algebra_vector_normalize(a, Constants::LA_NORM_L2),
+            linear_algebra_vector_normalize(b, Constants::LA_NORM_L2)
+        );
+    }
 }
\ No newline at end of file
@@ -2,8 +2,31 @@ namespace CoralMedia\Stemmer;
 
 class Snowball
 {
+    /**
+     * Stem a word with the Snowball algorithm of a language
+     *
+     * With the coralmedia.stem_cache_size ini setting above 0 (at most
+     * 1048576), each language memoizes up to that many words (least
+     * recently used evicted first) for the rest of the request.
+     *
+     * @param string word UTF-8 word
+     * @param string lang Snowball language name (default "english")
+     * @return string|null The stem, or null for an unknown language
+     */
     public static function stem(string word, string lang = "english") -> string | null
     {
+        // intercepted by optimizer
         return libstemmer_stem(word, lang);
     }
-}
\ No newline at end of file
+
+    /**
+     * Stem cache counters for this request
+     *
+     * @return array language => ['size', 'capacity', 'hits', 'misses', 'evictions']
+     */
+    public static function cacheStats() -> array
+    {
+        // intercepted by optimizer
+        return libstemmer_cache_stats();
+    }
+}
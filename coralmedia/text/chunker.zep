@@ -0,0 +1,84 @@
+namespace CoralMedia\Text;
+
+/**
+ * Token-budget chunker for embedding pipelines
+ *
+ * Splits a document into chunks of at most max_tokens words, as counted by
+ * Text::wordBreak(), in one native walk of the word and sentence boundaries.
+ *
+ * With soft boundaries (the default) a chunk is a run of whole sentences,
+ * and consecutive chunks share the trailing sentences of the previous one
+ * up to overlap words; a sentence longer than max_tokens is split at word
+ * boundaries, overlap words apart. With hard boundaries sentences are
+ * ignored: every chunk but the last has exactly max_tokens words, and
+ * consecutive chunks share overlap words.
+ *
+ * chunk() returns substrings; chunkOffsets() returns [start, end, tokens]
+ * byte ranges into the text (substr(text, start, end - start)).
+ */
+class Chunker
+{
+    protected maxTokens = 256;
+    protected overlap = 0;
+    protected hard = false;
+    protected locale = "en_US";
+
+    /**
+     * @param array options - Optional keys:
+     *                        max_tokens (256), overlap (0 words),
+     *                        boundary ("soft" or "hard"), locale ("en_US")
+     */
+    public function __construct(array options = [])
+    {
+        var value;
+
+        if fetch value, options["max_tokens"] {
+            let this->maxTokens = (int) value;
+        }
+        if fetch value, options["overlap"] {
+            let this->overlap = (int) value;
+        }
+        if fetch value, options["locale"] {
+            let this->locale = (string) value;
+        }
+        if fetch value, options["boundary"] {
+            if value !== "soft" && value !== "hard" {
+                throw new \ValueError("Chunker: boundary must be \"soft\" or \"hard\"");
+            }
+            let this->hard = value === "hard";
+        }
+
+        if this->maxTokens < 1 {
+            throw new \ValueError("Chunker: max_tokens must be > 0");
+        }
+
+        if this->overlap < 0 || this->overlap >= this->maxTokens {
+            throw new \ValueError("Chunker: overlap must be between 0 and max_tokens - 1");
+        }
+    }
+
+    /**
+     * @param string text - The document
+     * @return array - List of chunks (substrings of text)
+     */
+    public function chunk(string text) -> array
+    {
+        // intercepted by optimizer
+        return text_chunk(text, this->locale, this->maxTokens, this->overlap, this->hard, false);
+    }
+
+    /**
+     * @param string text - The document
+     * @return array - List of [start, end, tokens], end exclusive, in bytes
+     */
+    public function chunkOffsets(string text) -> array
+    {
+        // intercepted by optimizer
+        return text_chunk(text, this->locale, this->maxTokens, this->overlap, this->hard, true);
+    }
+
+    public function getMaxTokens() -> int
+    {
+        return this->maxTokens;
+    }
+}
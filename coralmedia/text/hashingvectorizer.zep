@@ -0,0 +1,129 @@
+namespace CoralMedia\Text;
+
+use CoralMedia\Constants;
+
+/**
+ * Feature-hashing vectorizer
+ *
+ * Documents go through the same pipeline as Text::termFrequency() (ICU word
+ * breaking, strip_numbers, remove_diacritics, lowercase, stem), natively,
+ * and every term is hashed with MurmurHash3 into one of 2^bits columns.
+ * No vocabulary is stored, so memory does not grow with the corpus and the
+ * vectorizer can be used on streams. With alternate_sign the hash also picks
+ * the sign of each term, so collisions cancel out in expectation.
+ *
+ * transform() returns sparse index => value vectors; transformDense() returns
+ * plain lists that feed LinearAlgebra::dot()/matmul() directly, and
+ * transformPacked() a float32 rows × 2^bits buffer (see LinearAlgebra::unpack()).
+ */
+class HashingVectorizer
+{
+    protected bits = 20;
+    protected alternateSign = true;
+    protected tf = 0;
+    protected norm = 1;
+    protected seed = 0;
+
+    protected pipeline = [];
+
+    /**
+     * @param array options - Optional keys:
+     *                        bits (20 → 2^20 columns), alternate_sign (true),
+     *                        tf (Constants::TEXT_TF_RAW), norm (Constants::TEXT_NORM_L2),
+     *                        seed (0), and the Text::termFrequency() keys locale,
+     *                        lowercase, remove_diacritics, stem, stem_language, strip_numbers,
+     *                        stop_words, break_rules, types, min_length, max_length,
+     *                        ngrams, char_ngrams
+     */
+    public function __construct(array options = [])
+    {
+        var value;
+
+        if fetch value, options["bits"] {
+            let this->bits = (int) value;
+        }
+        if fetch value, options["alternate_sign"] {
+            let this->alternateSign = (bool) value;
+        }
+        if fetch value, options["tf"] {
+            let this->tf = (int) value;
+        }
+        if fetch value, options["norm"] {
+            let this->norm = (int) value;
+        }
+        if fetch value, options["seed"] {
+            let this->seed = (int) value;
+        }
+
+        if this->bits < 1 || this->bits > 30 {
+            throw new \ValueError("HashingVectorizer: bits must be between 1 and 30");
+        }
+
+        let this->pipeline = options;
+    }
+
+    /**
+     * @param string|array text - A document, or an array of documents
+     * @return array - index => value, ascending index (one per document, keys preserved)
+     */
+    public function transform(var text) -> array
+    {
+        // intercepted by optimizer
+        return text_hash_vectorize(
+            text,
+            this->pipeline,
+            this->bits,
+            this->alternateSign,
+            this->tf,
+            this->norm,
+            this->seed,
+            Constants::TEXT_OUTPUT_SPARSE
+        );
+    }
+
+    /**
+     * @param string|array text - A document, or an array of documents
+     * @return array - List of 2^bits values (one per document, keys preserved)
+     */
+    public function transformDense(var text) -> array
+    {
+        // intercepted by optimizer
+        return text_hash_vectorize(
+            text,
+            this->pipeline,
+            this->bits,
+            this->alternateSign,
+            this->tf,
+            this->norm,
+            this->seed,
+            Constants::TEXT_OUTPUT_DENSE
+        );
+    }
+
+    /**
+     * @param string|array text - A document, or an array of documents
+     * @return string - Packed float32, one row of 2^bits values per document
+     */
+    public function transformPacked(var text) -> string
+    {
+        // intercepted by optimizer
+        return text_hash_vectorize(
+            text,
+            this->pipeline,
+            this->bits,
+            this->alternateSign,
+            this->tf,
+            this->norm,
+            this->seed,
+            Constants::TEXT_OUTPUT_PACKED
+        );
+    }
+
+    /**
+     * Number of columns (2^bits)
+     */
+    public function getFeatures() -> int
+    {
+        return 1 << this->bits;
+    }
+}
@@ -0,0 +1,144 @@
+namespace CoralMedia\Text;
+
+/**
+ * Streaming word tokenizer
+ *
+ * Reads a stream resource or a file in chunks and yields the same words as
+ * Text::wordBreak(), one at a time, so memory stays bounded by the chunk
+ * size whatever the size of the input. Each chunk is broken natively on its
+ * UTF-8 bytes up to its last whitespace (or punctuation, for scripts without
+ * spaces); the rest is carried over to the next chunk, so no word is split
+ * at a chunk edge.
+ *
+ * Keys are the running token number. A file path is opened and closed by
+ * the stream; a resource is left open. rewind() seeks back to where the
+ * stream was when it was handed over, which requires a seekable stream once
+ * iteration has started.
+ */
+class TokenStream implements \Iterator
+{
+    protected handle;
+    protected ownsHandle = false;
+    protected origin = 0;
+    protected locale = "en_US";
+    protected chunkSize = 65536;
+
+    protected carry = "";
+    protected tokens = [];
+    protected offset = 0;
+    protected position = 0;
+    protected started = false;
+    protected finished = false;
+
+    /**
+     * @param resource|string source - Readable stream resource, or a file path
+     * @param string locale - The locale (e.g., "en_US", "ja_JP", "th_TH")
+     * @param array options - Optional keys: chunk_size (65536 bytes read at a time)
+     */
+    public function __construct(var source, string locale = "en_US", array options = [])
+    {
+        var value, handle;
+
+        if fetch value, options["chunk_size"] {
+            let this->chunkSize = (int) value;
+        }
+
+        if this->chunkSize < 1 {
+            throw new \ValueError("TokenStream: chunk_size must be > 0");
+        }
+
+        if typeof source == "string" {
+            let handle = fopen(source, "rb");
+            if handle === false {
+                throw new \ValueError("TokenStream: cannot open '" . source . "'");
+            }
+            let this->ownsHandle = true;
+        } elseif typeof source == "resource" {
+            let handle = source;
+        } else {
+            throw new \TypeError("TokenStream: source must be a stream resource or a file path");
+        }
+
+        let this->handle = handle;
+        let this->locale = locale;
+        let this->origin = (int) ftell(handle);
+    }
+
+    public function __destruct()
+    {
+        if this->ownsHandle && typeof this->handle == "resource" {
+            fclose(this->handle);
+        }
+    }
+
+    public function rewind() -> void
+    {
+        if this->started {
+            if fseek(this->handle, this->origin) !== 0 {
+                throw new \ValueError("TokenStream: stream is not seekable");
+            }
+        }
+
+        let this->started = true;
+        let this->finished = false;
+        let this->carry = "";
+        let this->position = 0;
+
+        this->fill();
+    }
+
+    public function valid() -> bool
+    {
+        return this->offset < count(this->tokens);
+    }
+
+    public function current() -> var
+    {
+        return this->tokens[this->offset];
+    }
+
+    public function key() -> var
+    {
+        return this->position;
+    }
+
+    public function next() -> void
+    {
+        let this->offset++;
+        let this->position++;
+
+        if this->offset >= count(this->tokens) {
+            this->fill();
+        }
+    }
+
+    /**
+     * Read chunks until one yields words or the stream ends
+     */
+    protected function fill() -> void
+    {
+        var chunk, result;
+        string buffer;
+        bool last;
+
+        let this->tokens = [];
+        let this->offset = 0;
+
+        while empty this->tokens && !this->finished {
+            let chunk = fread(this->handle, this->chunkSize);
+            let last = chunk === false || feof(this->handle);
+            if chunk === false {
+                let chunk = "";
+            }
+
+            let buffer = this->carry . chunk;
+
+            // intercepted by optimizer
+            let result = icu_word_break_chunk(buffer, this->locale, last);
+
+            let this->tokens = result[0];
+            let this->carry = (string) substr(buffer, result[1]);
+            let this->finished = last;
+        }
+    }
+}
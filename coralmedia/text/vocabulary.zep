@@ -0,0 +1,296 @@
+namespace CoralMedia\Text;
+
+/**
+ * Vocabulary with integer term ids
+ *
+ * fit() runs the documents through the Text::termFrequency() pipeline
+ * natively, counts document frequencies, prunes with min_df / max_df /
+ * max_features and numbers the remaining terms 0..size-1 in byte order.
+ * encode() turns a document into a sparse id => weight vector with ascending
+ * ids: tf, idf and normalization are applied natively on integer ids, and
+ * the vectors feed LinearAlgebra::sparseDot()/sparseCosine() or
+ * LinearClassifier directly without carrying a copy of every term string.
+ *
+ * min_df and max_df are document counts when given as integers and
+ * proportions of the corpus when given as floats (1.0 = every document).
+ * The model (terms, document frequencies, packed float32 idf) can be
+ * exported with toArray() and restored with fromArray().
+ */
+class Vocabulary
+{
+    protected minDf = 1;
+    protected maxDf = 1.0;
+    protected maxFeatures = 0;
+    protected tf = 0;
+    protected norm = 1;
+    protected useIdf = true;
+    protected smooth = true;
+
+    protected pipeline = [];
+
+    protected terms = [];
+    protected index = [];
+    protected df = [];
+    protected idf = "";
+    protected documents = 0;
+
+    /**
+     * @param array options - Optional keys:
+     *                        min_df (1), max_df (1.0), max_features (0 = no limit),
+     *                        tf (Constants::TEXT_TF_RAW), norm (Constants::TEXT_NORM_L2),
+     *                        idf (true), smooth (true, as in Text::idf()), and the
+     *                        Text::termFrequency() keys locale, lowercase,
+     *                        remove_diacritics, stem, stem_language, strip_numbers, stop_words,
+     *                        break_rules, types, min_length, max_length, ngrams,
+     *                        char_ngrams
+     */
+    public function __construct(array options = [])
+    {
+        var value;
+
+        if fetch value, options["min_df"] {
+            let this->minDf = value;
+        }
+        if fetch value, options["max_df"] {
+            let this->maxDf = value;
+        }
+        if fetch value, options["max_features"] {
+            let this->maxFeatures = (int) value;
+        }
+        if fetch value, options["tf"] {
+            let this->tf = (int) value;
+        }
+        if fetch value, options["norm"] {
+            let this->norm = (int) value;
+        }
+        if fetch value, options["idf"] {
+            let this->useIdf = (bool) value;
+        }
+        if fetch value, options["smooth"] {
+            let this->smooth = (bool) value;
+        }
+
+        if this->minDf < 0 || this->maxDf < 0 {
+            throw new \ValueError("Vocabulary: min_df and max_df must not be negative");
+        }
+        if this->maxFeatures < 0 {
+            throw new \ValueError("Vocabulary: max_features must not be negative");
+        }
+
+        let this->pipeline = options;
+    }
+
+    /**
+     * Build the vocabulary from a corpus
+     *
+     * @param array documents - List of document strings
+     * @return Vocabulary
+     */
+    public function fit(array! documents) -> <Vocabulary>
+    {
+        var model;
+        int numDocuments;
+
+        let numDocuments = count(documents);
+
+        // Nothing to learn; min_df / max_df do not apply to an empty corpus
+        if numDocuments == 0 {
+            this->setModel([], [], "", 0);
+
+            return this;
+        }
+
+        // intercepted by optimizer
+        let model = text_vocabulary_fit(
+            documents,
+            this->pipeline,
+            this->documentCount(this->minDf, numDocuments),
+            this->documentCount(this->maxDf, numDocuments),
+            this->maxFeatures,
+            this->smooth
+        );
+
+        this->setModel(model["terms"], model["df"], model["idf"], model["documents"]);
+
+        return this;
+    }
+
+    /**
+     * Fit, then encode the same documents
+     *
+     * @param array documents - List of document strings
+     * @return array - One id => weight vector per document, keys preserved
+     */
+    public function fitEncode(array! documents) -> array
+    {
+        this->fit(documents);
+
+        return this->encode(documents);
+    }
+
+    /**
+     * @param string|array text - A document, or an array of documents
+     * @return array - id => weight, ascending id (one per document, keys preserved);
+     *                 terms outside the vocabulary are ignored
+     */
+    public function encode(var text) -> array
+    {
+        var idf = null;
+
+        if this->useIdf {
+            let idf = this->idf;
+        }
+
+        // intercepted by optimizer
+        return text_vocabulary_encode(
+            text,
+            this->pipeline,
+            this->index,
+            idf,
+            this->tf,
+            this->norm
+        );
+    }
+
+    /**
+     * Map an encoded vector back to terms
+     *
+     * @param array vector - id => weight
+     * @return array - term => weight
+     */
+    public function decode(array! vector) -> array
+    {
+        var id, weight, term, result = [];
+
+        for id, weight in vector {
+            if fetch term, this->terms[id] {
+                let result[term] = weight;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Id of a term, or -1 when it is not in the vocabulary
+     */
+    public function getId(string term) -> int
+    {
+        var id;
+
+        if fetch id, this->index[term] {
+            return (int) id;
+        }
+
+        return -1;
+    }
+
+    /**
+     * @return array - List of terms, indexed by id
+     */
+    public function getTerms() -> array
+    {
+        return this->terms;
+    }
+
+    /**
+     * @return array - term => id
+     */
+    public function getIndex() -> array
+    {
+        return this->index;
+    }
+
+    /**
+     * @return array - Document frequency per id
+     */
+    public function getDocumentFrequencies() -> array
+    {
+        return this->df;
+    }
+
+    /**
+     * @return array - IDF per id
+     */
+    public function getIdf() -> array
+    {
+        // intercepted by optimizer
+        return linear_algebra_unpack(this->idf);
+    }
+
+    public function size() -> int
+    {
+        return count(this->terms);
+    }
+
+    /**
+     * @return array - Model state (options, terms, df, packed idf, documents)
+     */
+    public function toArray() -> array
+    {
+        return [
+            "options": this->pipeline,
+            "terms": this->terms,
+            "df": this->df,
+            "idf": this->idf,
+            "documents": this->documents
+        ];
+    }
+
+    /**
+     * Restore a vocabulary exported with toArray()
+     *
+     * @param array model
+     * @return Vocabulary
+     */
+    public static function fromArray(array model) -> <Vocabulary>
+    {
+        var vocabulary, options, terms, df, idf, documents;
+
+        if !fetch terms, model["terms"] {
+            throw new \ValueError("Vocabulary: model requires 'terms'");
+        }
+        if !fetch df, model["df"] {
+            throw new \ValueError("Vocabulary: model requires 'df'");
+        }
+        if !fetch idf, model["idf"] {
+            throw new \ValueError("Vocabulary: model requires 'idf'");
+        }
+        if !fetch documents, model["documents"] {
+            throw new \ValueError("Vocabulary: model requires 'documents'");
+        }
+        if !fetch options, model["options"] {
+            let options = [];
+        }
+
+        if count(df) != count(terms) || strlen(idf) != 4 * count(terms) {
+            throw new \ValueError("Vocabulary: terms, df and idf sizes do not match");
+        }
+
+        let vocabulary = new Vocabulary(options);
+        vocabulary->setModel(array_values(terms), array_values(df), idf, documents);
+
+        return vocabulary;
+    }
+
+    protected function setModel(array terms, array df, string idf, int documents) -> void
+    {
+        let this->terms = terms;
+        let this->index = array_flip(terms);
+        let this->df = df;
+        let this->idf = idf;
+        let this->documents = documents;
+    }
+
+    /**
+     * min_df / max_df as a document count: floats are proportions of the corpus
+     */
+    protected function documentCount(var value, int numDocuments) -> double
+    {
+        if typeof value == "double" {
+            return (double) value * numDocuments;
+        }
+
+        return (double) value;
+    }
+}
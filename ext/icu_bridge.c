@@ -1,93 +1,314 @@
 #include "icu_bridge.h"
+#include "scratch.h"
+#include "intern.h"
 #include <unicode/ubrk.h>
 #include <unicode/ustring.h>
 #include <unicode/utypes.h>
 #include <unicode/utrans.h>
+#include <unicode/unorm2.h>
+#include <unicode/uchar.h>
+#include <unicode/utext.h>
 
-void icu_word_break(zend_string *text, const char *locale, zval *return_value)
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+ * Temporaries live in the scratch arena (scratch.h). Neither conversion
+ * needs a preflight pass: UTF-8 never takes more UTF-16 units than bytes,
+ * and a UTF-16 unit never takes more than 3 UTF-8 bytes.
+ */
+
+/* UTF-8 to UTF-16; extra reserves room for transforms that grow the text in place */
+static UChar *icu_to_u16(zend_string *text, int32_t extra, int32_t *u16_len, UErrorCode *status)
 {
-    // 1. Input validation
-    if (!text || ZSTR_LEN(text) == 0) {
-        array_init(return_value);
-        return;
+    int32_t capacity = (int32_t) ZSTR_LEN(text) + extra + 1;
+    UChar *u16 = (UChar*) cm_scratch_alloc(sizeof(UChar) * capacity);
+
+    u_strFromUTF8(u16, capacity, u16_len, ZSTR_VAL(text), (int32_t) ZSTR_LEN(text), status);
+
+    return u16;
+}
+
+/* UTF-16 to UTF-8: at most 3 bytes per UTF-16 unit. NULL after raising an error */
+static char *icu_to_u8(const UChar *u16, int32_t u16_len, int32_t *u8_len, UErrorCode *status, const char *fn)
+{
+    size_t capacity = (size_t) u16_len * 3 + 1;
+
+    if (capacity > INT32_MAX) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+        zend_value_error("%s: Text too large", fn);
+        return NULL;
     }
 
-    UErrorCode status = U_ZERO_ERROR;
+    char *u8 = (char*) cm_scratch_alloc(capacity);
 
-    // 2. UTF-8 to UTF-16 conversion
-    // ICU uses UTF-16 internally, PHP uses UTF-8
-    int32_t u16_len = 0;
-    UChar *u16_text = NULL;
+    u_strToUTF8(u8, (int32_t) capacity, u8_len, u16, u16_len, status);
 
-    // Pre-flight to get required buffer size
-    u_strFromUTF8(NULL, 0, &u16_len, ZSTR_VAL(text), ZSTR_LEN(text), &status);
-    if (status != U_BUFFER_OVERFLOW_ERROR && U_FAILURE(status)) {
-        zend_value_error("icu_word_break: UTF-8 conversion failed");
-        return;
+    return u8;
+}
+
+/*
+ * Fast paths. Most tokens are plain ASCII, and most of the rest only use
+ * Latin-1 letters (U+00C0-U+00FF, two bytes C3 xx): both are handled on
+ * the UTF-8 bytes directly, and ICU only sees other scripts and locales
+ * whose case rules differ (tr/az dotted and dotless i, lt dot above).
+ */
+
+zend_bool icu_is_ascii(const char *text, size_t len)
+{
+    size_t i = 0;
+
+#ifdef __SSE2__
+    for (; i + 16 <= len; i += 16) {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (text + i)))) {
+            return 0;
+        }
     }
+#endif
 
-    status = U_ZERO_ERROR;
-    u16_text = (UChar*) emalloc(sizeof(UChar) * (u16_len + 1));
-    u_strFromUTF8(u16_text, u16_len + 1, &u16_len, ZSTR_VAL(text), ZSTR_LEN(text), &status);
+    for (; i + 8 <= len; i += 8) {
+        uint64_t block;
 
-    if (U_FAILURE(status)) {
-        efree(u16_text);
-        zend_value_error("icu_word_break: UTF-8 to UTF-16 conversion failed");
-        return;
+        memcpy(&block, text + i, sizeof(block));
+        if (block & UINT64_C(0x8080808080808080)) {
+            return 0;
+        }
     }
 
-    // 3. Create ICU break iterator
-    UBreakIterator *bi = ubrk_open(UBRK_WORD, locale, u16_text, u16_len, &status);
-    if (U_FAILURE(status) || !bi) {
-        efree(u16_text);
-        zend_value_error("icu_word_break: Failed to create break iterator (invalid locale?)");
-        return;
+    for (; i < len; i++) {
+        if ((unsigned char) text[i] & 0x80) {
+            return 0;
+        }
     }
 
-    // 4. Iterate through boundaries and collect words
-    array_init(return_value);
+    return 1;
+}
+
+zend_bool icu_locale_simple_case(const char *locale)
+{
+    static const char special[][3] = { "tr", "az", "lt" };
+
+    if (!locale) {
+        return 1;
+    }
 
+    for (size_t i = 0; i < sizeof(special) / sizeof(special[0]); i++) {
+        if (strncasecmp(locale, special[i], 2) == 0
+            && (locale[2] == '\0' || locale[2] == '_' || locale[2] == '-' || locale[2] == '@')) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * Base letter of U+00C0-U+00FF once NFD marks are removed, 0 when the letter
+ * has no canonical decomposition (Æ, Ð, ×, Ø, Þ, ß, æ, ð, ÷, ø, þ)
+ */
+static const char latin1_base[64] = {
+    'A', 'A', 'A', 'A', 'A', 'A', 0,   'C', 'E', 'E', 'E', 'E', 'I', 'I', 'I', 'I',
+    0,   'N', 'O', 'O', 'O', 'O', 'O', 0,   0,   'U', 'U', 'U', 'U', 'Y', 0,   0,
+    'a', 'a', 'a', 'a', 'a', 'a', 0,   'c', 'e', 'e', 'e', 'e', 'i', 'i', 'i', 'i',
+    0,   'n', 'o', 'o', 'o', 'o', 'o', 0,   0,   'u', 'u', 'u', 'u', 'y', 0,   'y'
+};
+
+/* ASCII plus C2/C3 sequences only: U+0000-U+00FF */
+static zend_bool icu_is_latin1(const char *text, size_t len)
+{
+    const unsigned char *p = (const unsigned char *) text;
+
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] < 0x80) {
+            continue;
+        }
+        if ((p[i] != 0xC2 && p[i] != 0xC3) || i + 1 >= len || (p[i + 1] & 0xC0) != 0x80) {
+            return 0;
+        }
+        i++;
+    }
+
+    return 1;
+}
+
+/* Same length as the input: À-Þ (C3 80-9E, except × C3 97) move to à-þ (C3 A0-BE) */
+static zend_string *icu_latin1_lower(zend_string *text)
+{
+    zend_string *result = zend_string_alloc(ZSTR_LEN(text), 0);
+    const unsigned char *src = (const unsigned char *) ZSTR_VAL(text);
+    unsigned char *dst = (unsigned char *) ZSTR_VAL(result);
+    size_t len = ZSTR_LEN(text);
+
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = src[i];
+
+        if (c == 0xC3) {
+            unsigned char next = src[++i];
+
+            dst[i - 1] = c;
+            dst[i] = (next <= 0x9E && next != 0x97) ? next + 0x20 : next;
+        } else {
+            dst[i] = zend_tolower_ascii(c);
+        }
+    }
+    ZSTR_VAL(result)[len] = '\0';
+
+    return result;
+}
+
+/* Never longer than the input: accented letters become one ASCII byte */
+static zend_string *icu_latin1_strip(zend_string *text)
+{
+    zend_string *result = zend_string_alloc(ZSTR_LEN(text), 0);
+    const unsigned char *src = (const unsigned char *) ZSTR_VAL(text);
+    unsigned char *dst = (unsigned char *) ZSTR_VAL(result);
+    size_t len = ZSTR_LEN(text);
+    size_t out = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = src[i];
+
+        if (c == 0xC3 && latin1_base[src[i + 1] - 0x80]) {
+            dst[out++] = (unsigned char) latin1_base[src[++i] - 0x80];
+        } else if (c >= 0xC2) {
+            dst[out++] = c;
+            dst[out++] = src[++i];
+        } else {
+            dst[out++] = c;
+        }
+    }
+
+    ZSTR_LEN(result) = out;
+    ZSTR_VAL(result)[out] = '\0';
+
+    return result;
+}
+
+UTransliterator *icu_open_diacritics_transliterator(UErrorCode *status)
+{
+    // NFD = Decompose, remove nonspacing marks, NFC = Recompose
+    static const UChar trans_id[] = {
+        0x4E, 0x46, 0x44, 0x3B, 0x20,  // "NFD; "
+        0x5B, 0x3A, 0x4E, 0x6F, 0x6E, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x20, 0x4D, 0x61, 0x72, 0x6B, 0x3A, 0x5D, 0x20,  // "[[:Nonspacing Mark:]] "
+        0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x3B, 0x20,  // "Remove; "
+        0x4E, 0x46, 0x43,  // "NFC"
+        0x00
+    };
+
+    return utrans_openU(trans_id, -1, UTRANS_FORWARD, NULL, 0, NULL, status);
+}
+
+/*
+ * Each operation has a core that works on one string with handles opened
+ * by the caller. The single-string bridges open the handles for one call;
+ * the *_all bridges open them once and run the core over the whole array,
+ * preserving keys. Every element takes and releases its own scratch mark,
+ * so the arena buffer is reused from one element to the next.
+ */
+
+static void icu_batch_add(zval *out, zend_string *key, zend_ulong idx, zval *value)
+{
+    if (key) {
+        zend_hash_update(Z_ARRVAL_P(out), key, value);
+    } else {
+        zend_hash_index_update(Z_ARRVAL_P(out), idx, value);
+    }
+}
+
+static void icu_batch_fail(zval *return_value)
+{
+    zval_ptr_dtor(return_value);
+    ZVAL_NULL(return_value);
+}
+
+/* ---------- Word and sentence breaking ---------- */
+
+/* Segments of text as UTF-8 strings; words_only skips whitespace and punctuation */
+static int icu_break_text(UBreakIterator *bi, zend_string *text, zend_bool words_only, zval *out, const char *fn)
+{
+    array_init(out);
+
+    if (ZSTR_LEN(text) == 0) {
+        return SUCCESS;
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+
+    // 1. UTF-8 to UTF-16 conversion
+    // ICU uses UTF-16 internally, PHP uses UTF-8
+    cm_scratch_pos mark = cm_scratch_mark();
+    int32_t u16_len = 0;
+    UChar *u16_text = icu_to_u16(text, 0, &u16_len, &status);
+
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("%s: UTF-8 to UTF-16 conversion failed", fn);
+        return FAILURE;
+    }
+
+    ubrk_setText(bi, u16_text, u16_len, &status);
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("%s: Failed to set break iterator text", fn);
+        return FAILURE;
+    }
+
+    // 2. Iterate through boundaries and collect segments
     int32_t start = ubrk_first(bi);
     int32_t end = ubrk_next(bi);
 
     while (end != UBRK_DONE) {
-        // Check if this is a word (not whitespace/punctuation)
-        int32_t rule_status = ubrk_getRuleStatus(bi);
-
-        // UBRK_WORD_NONE = 0 (whitespace), other values = actual words
-        if (rule_status != UBRK_WORD_NONE) {
-            // Extract the word segment
-            int32_t word_len_u16 = end - start;
-            UChar *word_u16 = u16_text + start;
-
-            // Convert UTF-16 word back to UTF-8
-            int32_t word_len_u8 = 0;
-            u_strToUTF8(NULL, 0, &word_len_u8, word_u16, word_len_u16, &status);
-
-            if (status == U_BUFFER_OVERFLOW_ERROR) {
-                status = U_ZERO_ERROR;
-                char *word_u8 = (char*) emalloc(word_len_u8 + 1);
-                u_strToUTF8(word_u8, word_len_u8 + 1, &word_len_u8, word_u16, word_len_u16, &status);
-
-                if (U_SUCCESS(status)) {
-                    add_next_index_stringl(return_value, word_u8, word_len_u8);
-                }
+        // UBRK_WORD_NONE = 0 (whitespace, punctuation), other values = actual words
+        if (!words_only || ubrk_getRuleStatus(bi) != UBRK_WORD_NONE) {
+            // Convert the UTF-16 segment back to UTF-8
+            cm_scratch_pos segment_mark = cm_scratch_mark();
+            int32_t segment_len = 0;
+            char *segment = icu_to_u8(u16_text + start, end - start, &segment_len, &status, fn);
+
+            if (!segment) {
+                cm_scratch_release(mark);
+                return FAILURE;
+            }
 
-                efree(word_u8);
-                status = U_ZERO_ERROR;
+            if (U_SUCCESS(status)) {
+                if (words_only) {
+                    add_next_index_str(out, cm_intern(segment, segment_len));
+                } else {
+                    add_next_index_stringl(out, segment, segment_len);
+                }
             }
+
+            cm_scratch_release(segment_mark);
+            status = U_ZERO_ERROR;
         }
 
         start = end;
         end = ubrk_next(bi);
     }
 
-    // 5. Cleanup
-    ubrk_close(bi);
-    efree(u16_text);
+    cm_scratch_release(mark);
+
+    return SUCCESS;
 }
 
-void icu_sentence_break(zend_string *text, const char *locale, zval *return_value)
+static UBreakIterator *icu_open_break(UBreakIteratorType type, const char *locale, const char *fn)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    UBreakIterator *bi = ubrk_open(type, locale, NULL, 0, &status);
+
+    if (U_FAILURE(status) || !bi) {
+        if (bi) {
+            ubrk_close(bi);
+        }
+        zend_value_error("%s: Failed to create break iterator (invalid locale?)", fn);
+        return NULL;
+    }
+
+    return bi;
+}
+
+static void icu_break(zend_string *text, const char *locale, UBreakIteratorType type, zval *return_value, const char *fn)
 {
     // 1. Input validation
     if (!text || ZSTR_LEN(text) == 0) {
@@ -95,230 +316,804 @@ void icu_sentence_break(zend_string *text, const char *locale, zval *return_valu
         return;
     }
 
-    UErrorCode status = U_ZERO_ERROR;
+    // 2. Create ICU break iterator
+    UBreakIterator *bi = icu_open_break(type, locale, fn);
 
-    // 2. UTF-8 to UTF-16 conversion
-    int32_t u16_len = 0;
-    UChar *u16_text = NULL;
-
-    u_strFromUTF8(NULL, 0, &u16_len, ZSTR_VAL(text), ZSTR_LEN(text), &status);
-    if (status != U_BUFFER_OVERFLOW_ERROR && U_FAILURE(status)) {
-        zend_value_error("icu_sentence_break: UTF-8 conversion failed");
+    if (!bi) {
         return;
     }
 
-    status = U_ZERO_ERROR;
-    u16_text = (UChar*) emalloc(sizeof(UChar) * (u16_len + 1));
-    u_strFromUTF8(u16_text, u16_len + 1, &u16_len, ZSTR_VAL(text), ZSTR_LEN(text), &status);
+    // 3. Collect segments
+    if (icu_break_text(bi, text, type == UBRK_WORD, return_value, fn) == FAILURE) {
+        icu_batch_fail(return_value);
+    }
 
-    if (U_FAILURE(status)) {
-        efree(u16_text);
-        zend_value_error("icu_sentence_break: UTF-8 to UTF-16 conversion failed");
+    // 4. Cleanup
+    ubrk_close(bi);
+}
+
+static void icu_break_all(zval *texts, const char *locale, UBreakIteratorType type, zval *return_value, const char *fn)
+{
+    UBreakIterator *bi = icu_open_break(type, locale, fn);
+    zend_string *key;
+    zend_ulong idx;
+    zval *text;
+    zval segments;
+
+    if (!bi) {
         return;
     }
 
-    // 3. Create sentence break iterator
-    UBreakIterator *bi = ubrk_open(UBRK_SENTENCE, locale, u16_text, u16_len, &status);
-    if (U_FAILURE(status) || !bi) {
-        efree(u16_text);
-        zend_value_error("icu_sentence_break: Failed to create break iterator");
+    array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(texts)));
+
+    ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(texts), idx, key, text) {
+        if (Z_TYPE_P(text) != IS_STRING) {
+            zend_type_error("%s: all elements must be strings", fn);
+            icu_batch_fail(return_value);
+            break;
+        }
+
+        if (icu_break_text(bi, Z_STR_P(text), type == UBRK_WORD, &segments, fn) == FAILURE) {
+            zval_ptr_dtor(&segments);
+            icu_batch_fail(return_value);
+            break;
+        }
+
+        icu_batch_add(return_value, key, idx, &segments);
+    } ZEND_HASH_FOREACH_END();
+
+    ubrk_close(bi);
+}
+
+void icu_word_break(zend_string *text, const char *locale, zval *return_value)
+{
+    icu_break(text, locale, UBRK_WORD, return_value, "icu_word_break");
+}
+
+void icu_sentence_break(zend_string *text, const char *locale, zval *return_value)
+{
+    icu_break(text, locale, UBRK_SENTENCE, return_value, "icu_sentence_break");
+}
+
+void icu_word_break_all(zval *texts, const char *locale, zval *return_value)
+{
+    icu_break_all(texts, locale, UBRK_WORD, return_value, "icu_word_break_all");
+}
+
+void icu_sentence_break_all(zval *texts, const char *locale, zval *return_value)
+{
+    icu_break_all(texts, locale, UBRK_SENTENCE, return_value, "icu_sentence_break_all");
+}
+
+/* ---------- Streaming ---------- */
+
+/*
+ * Length of the prefix of a stream chunk whose words cannot change with
+ * what follows: up to and including the last ASCII whitespace, since
+ * UAX #29 never joins a word across it. 0 when the chunk has none.
+ */
+static size_t icu_stream_cut(const char *text, size_t len)
+{
+    for (size_t i = len; i > 0; i--) {
+        switch (text[i - 1]) {
+            case ' ': case '\t': case '\n': case '\r': case '\v': case '\f':
+                return i;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Cut for a chunk without ASCII whitespace: after the last non-word segment
+ * (punctuation, ideographic space) that is not the final one, where a
+ * dictionary-based run (CJK, Thai) ends. Failing that, the whole chunk is
+ * carried over until it reaches ICU_STREAM_CARRY_MAX bytes, then only the
+ * last two segments are held back so memory stays bounded.
+ */
+#define ICU_STREAM_CARRY_MAX (1 << 20)
+
+static int32_t icu_stream_hold_back(UBreakIterator *bi, size_t len)
+{
+    ubrk_last(bi);
+
+    for (int32_t b = ubrk_previous(bi); b != UBRK_DONE && b > 0; b = ubrk_previous(bi)) {
+        if (ubrk_getRuleStatus(bi) == UBRK_WORD_NONE) {
+            return b;
+        }
+    }
+
+    if (len < ICU_STREAM_CARRY_MAX) {
+        return 0;
+    }
+
+    ubrk_last(bi);
+    ubrk_previous(bi);
+
+    int32_t b = ubrk_previous(bi);
+
+    return b == UBRK_DONE ? 0 : b;
+}
+
+/*
+ * [words, consumed] for one chunk of a stream. The chunk is broken directly
+ * on UTF-8 (UText), so boundaries are byte offsets and no UTF-16 copy is
+ * made. Unless final, only the words before the last whitespace are
+ * returned (see icu_stream_hold_back() for chunks without any); a UTF-8
+ * sequence cut at the chunk edge always stays in the held-back part. The
+ * caller prepends text[consumed..] to the next chunk.
+ */
+void icu_word_break_chunk(zend_string *text, const char *locale, zend_bool final, zval *return_value)
+{
+    const char *fn = "icu_word_break_chunk";
+    const char *bytes = ZSTR_VAL(text);
+    size_t len = ZSTR_LEN(text);
+    size_t cut = final ? len : icu_stream_cut(bytes, len);
+    zend_bool hold_back = !final && cut == 0;
+    size_t span = hold_back ? len : cut;
+    zval words;
+
+    if (len > INT32_MAX) {
+        zend_value_error("%s: Chunk too large", fn);
         return;
     }
 
-    // 4. Collect sentences
-    array_init(return_value);
+    array_init(&words);
 
-    int32_t start = ubrk_first(bi);
-    int32_t end = ubrk_next(bi);
+    if (span > 0) {
+        UErrorCode status = U_ZERO_ERROR;
+        UBreakIterator *bi = icu_open_break(UBRK_WORD, locale, fn);
 
-    while (end != UBRK_DONE) {
-        int32_t sent_len_u16 = end - start;
-        UChar *sent_u16 = u16_text + start;
+        if (!bi) {
+            zval_ptr_dtor(&words);
+            return;
+        }
 
-        // Convert to UTF-8
-        int32_t sent_len_u8 = 0;
-        u_strToUTF8(NULL, 0, &sent_len_u8, sent_u16, sent_len_u16, &status);
+        UText *ut = utext_openUTF8(NULL, bytes, (int64_t) span, &status);
 
-        if (status == U_BUFFER_OVERFLOW_ERROR) {
-            status = U_ZERO_ERROR;
-            char *sent_u8 = (char*) emalloc(sent_len_u8 + 1);
-            u_strToUTF8(sent_u8, sent_len_u8 + 1, &sent_len_u8, sent_u16, sent_len_u16, &status);
+        if (U_SUCCESS(status)) {
+            ubrk_setUText(bi, ut, &status);
+        }
+        if (U_FAILURE(status)) {
+            utext_close(ut);
+            ubrk_close(bi);
+            zval_ptr_dtor(&words);
+            zend_value_error("%s: Failed to set break iterator text", fn);
+            return;
+        }
 
-            if (U_SUCCESS(status)) {
-                add_next_index_stringl(return_value, sent_u8, sent_len_u8);
-            }
+        int32_t limit = (int32_t) span;
 
-            efree(sent_u8);
-            status = U_ZERO_ERROR;
+        if (hold_back) {
+            limit = icu_stream_hold_back(bi, len);
+            cut = (size_t) limit;
         }
 
-        start = end;
-        end = ubrk_next(bi);
+        int32_t start = ubrk_first(bi);
+
+        for (int32_t end = ubrk_next(bi); end != UBRK_DONE && end <= limit; end = ubrk_next(bi)) {
+            if (ubrk_getRuleStatus(bi) != UBRK_WORD_NONE) {
+                add_next_index_str(&words, cm_intern(bytes + start, end - start));
+            }
+            start = end;
+        }
+
+        utext_close(ut);
+        ubrk_close(bi);
     }
 
-    // 5. Cleanup
-    ubrk_close(bi);
-    efree(u16_text);
+    array_init_size(return_value, 2);
+    add_next_index_zval(return_value, &words);
+    add_next_index_long(return_value, (zend_long) cut);
 }
 
-void icu_lowercase(zend_string *text, const char *locale, zval *return_value)
+/* ---------- Counting ---------- */
+
+/*
+ * Counts without segments: the iterators walk the UTF-8 bytes in place
+ * (UText), so there is no UTF-16 copy and nothing is allocated per token.
+ * Words and sentences are counted as wordBreak() and sentenceBreak()
+ * return them; graphemes are user-perceived characters. Ill-formed UTF-8
+ * reads as U+FFFD.
+ */
+
+#define ICU_COUNT_WORDS     0x01
+#define ICU_COUNT_SENTENCES 0x02
+#define ICU_COUNT_GRAPHEMES 0x04
+
+typedef struct {
+    zend_long words;
+    zend_long sentences;
+    zend_long graphemes;
+    zend_long word_graphemes;       /* graphemes inside words */
+} icu_text_counts;
+
+/* Break iterator of type over ut; NULL after raising an error */
+static UBreakIterator *icu_open_break_utext(UBreakIteratorType type, const char *locale, UText *ut, const char *fn)
 {
-    // 1. Input validation
-    if (!text || ZSTR_LEN(text) == 0) {
-        ZVAL_EMPTY_STRING(return_value);
-        return;
+    UErrorCode status = U_ZERO_ERROR;
+    UBreakIterator *bi = icu_open_break(type, locale, fn);
+
+    if (!bi) {
+        return NULL;
+    }
+
+    ubrk_setUText(bi, ut, &status);
+    if (U_FAILURE(status)) {
+        ubrk_close(bi);
+        zend_value_error("%s: Failed to set break iterator text", fn);
+        return NULL;
+    }
+
+    return bi;
+}
+
+static zend_long icu_count_segments(UBreakIterator *bi, zend_bool words_only)
+{
+    zend_long count = 0;
+
+    ubrk_first(bi);
+
+    while (ubrk_next(bi) != UBRK_DONE) {
+        if (!words_only || ubrk_getRuleStatus(bi) != UBRK_WORD_NONE) {
+            count++;
+        }
     }
 
+    return count;
+}
+
+/*
+ * Graphemes, and words with the graphemes inside them, in one walk: word
+ * boundaries are grapheme boundaries (UAX #29 WB4), so the word iterator
+ * only moves forward to the segment holding the current grapheme.
+ */
+static void icu_count_graphemes(UBreakIterator *chars, UBreakIterator *words, icu_text_counts *c)
+{
+    int32_t word_end = ubrk_first(words);
+    zend_bool in_word = 0;
+
+    ubrk_first(chars);
+
+    for (int32_t end = ubrk_next(chars); end != UBRK_DONE; end = ubrk_next(chars)) {
+        c->graphemes++;
+
+        while (word_end != UBRK_DONE && word_end < end) {
+            word_end = ubrk_next(words);
+            in_word = word_end != UBRK_DONE && ubrk_getRuleStatus(words) != UBRK_WORD_NONE;
+            c->words += in_word;
+        }
+
+        c->word_graphemes += in_word;
+    }
+}
+
+static int icu_count_text(zend_string *text, const char *locale, int what, icu_text_counts *c, const char *fn)
+{
     UErrorCode status = U_ZERO_ERROR;
+    UBreakIterator *words = NULL, *sentences = NULL, *chars = NULL;
+    int result = FAILURE;
 
-    // 2. UTF-8 to UTF-16 conversion
-    int32_t u16_len = 0;
-    UChar *u16_text = NULL;
+    memset(c, 0, sizeof(*c));
 
-    // Pre-flight to get required buffer size
-    u_strFromUTF8(NULL, 0, &u16_len, ZSTR_VAL(text), ZSTR_LEN(text), &status);
-    if (status != U_BUFFER_OVERFLOW_ERROR && U_FAILURE(status)) {
-        zend_value_error("icu_lowercase: UTF-8 conversion failed");
-        return;
+    if (ZSTR_LEN(text) == 0) {
+        return SUCCESS;
     }
 
-    status = U_ZERO_ERROR;
-    u16_text = (UChar*) emalloc(sizeof(UChar) * (u16_len + 1));
-    u_strFromUTF8(u16_text, u16_len + 1, &u16_len, ZSTR_VAL(text), ZSTR_LEN(text), &status);
+    if (ZSTR_LEN(text) > INT32_MAX) {
+        zend_value_error("%s: Text too large", fn);
+        return FAILURE;
+    }
+
+    UText *ut = utext_openUTF8(NULL, ZSTR_VAL(text), (int64_t) ZSTR_LEN(text), &status);
 
     if (U_FAILURE(status)) {
-        efree(u16_text);
-        zend_value_error("icu_lowercase: UTF-8 to UTF-16 conversion failed");
+        zend_value_error("%s: Failed to open text", fn);
+        return FAILURE;
+    }
+
+    /* Each iterator keeps its own shallow clone of ut */
+    if ((what & ICU_COUNT_WORDS) && !(words = icu_open_break_utext(UBRK_WORD, locale, ut, fn))) {
+        goto done;
+    }
+    if ((what & ICU_COUNT_SENTENCES) && !(sentences = icu_open_break_utext(UBRK_SENTENCE, locale, ut, fn))) {
+        goto done;
+    }
+    if ((what & ICU_COUNT_GRAPHEMES) && !(chars = icu_open_break_utext(UBRK_CHARACTER, locale, ut, fn))) {
+        goto done;
+    }
+
+    if (chars && words) {
+        icu_count_graphemes(chars, words, c);
+    } else if (chars) {
+        c->graphemes = icu_count_segments(chars, 0);
+    } else if (words) {
+        c->words = icu_count_segments(words, 1);
+    }
+
+    if (sentences) {
+        c->sentences = icu_count_segments(sentences, 0);
+    }
+
+    result = SUCCESS;
+
+done:
+    if (words) {
+        ubrk_close(words);
+    }
+    if (sentences) {
+        ubrk_close(sentences);
+    }
+    if (chars) {
+        ubrk_close(chars);
+    }
+    utext_close(ut);
+
+    return result;
+}
+
+void icu_count_words(zend_string *text, const char *locale, zval *return_value)
+{
+    icu_text_counts c;
+
+    if (icu_count_text(text, locale, ICU_COUNT_WORDS, &c, "icu_count_words") == SUCCESS) {
+        ZVAL_LONG(return_value, c.words);
+    }
+}
+
+void icu_count_sentences(zend_string *text, const char *locale, zval *return_value)
+{
+    icu_text_counts c;
+
+    if (icu_count_text(text, locale, ICU_COUNT_SENTENCES, &c, "icu_count_sentences") == SUCCESS) {
+        ZVAL_LONG(return_value, c.sentences);
+    }
+}
+
+void icu_text_stats(zend_string *text, const char *locale, zval *return_value)
+{
+    icu_text_counts c;
+
+    if (icu_count_text(text, locale, ICU_COUNT_WORDS | ICU_COUNT_SENTENCES | ICU_COUNT_GRAPHEMES, &c, "icu_text_stats") == FAILURE) {
         return;
     }
 
+    array_init_size(return_value, 5);
+    add_assoc_long(return_value, "words", c.words);
+    add_assoc_long(return_value, "sentences", c.sentences);
+    add_assoc_long(return_value, "graphemes", c.graphemes);
+    add_assoc_long(return_value, "bytes", (zend_long) ZSTR_LEN(text));
+    add_assoc_double(return_value, "avg_word_length", c.words ? (double) c.word_graphemes / (double) c.words : 0.0);
+}
+
+/* ---------- Lowercase ---------- */
+
+/* NULL after raising an error */
+static zend_string *icu_lowercase_text(zend_string *text, const char *locale, zend_bool simple_case, const char *fn)
+{
+    // 1. Input validation
+    if (ZSTR_LEN(text) == 0) {
+        return ZSTR_EMPTY_ALLOC();
+    }
+
+    // ASCII and Latin-1 without ICU; returns the input itself when already lowercase
+    if (simple_case) {
+        if (icu_is_ascii(ZSTR_VAL(text), ZSTR_LEN(text))) {
+            return zend_string_tolower(text);
+        }
+        if (icu_is_latin1(ZSTR_VAL(text), ZSTR_LEN(text))) {
+            return icu_latin1_lower(text);
+        }
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+
+    // 2. UTF-8 to UTF-16 conversion
+    cm_scratch_pos mark = cm_scratch_mark();
+    int32_t u16_len = 0;
+    UChar *u16_text = icu_to_u16(text, 0, &u16_len, &status);
+
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("%s: UTF-8 to UTF-16 conversion failed", fn);
+        return NULL;
+    }
+
     // 3. Apply lowercase transformation
-    // Allocate buffer for result (same size should be sufficient for lowercase)
-    UChar *u16_result = (UChar*) emalloc(sizeof(UChar) * (u16_len + 1));
+    // Same size is almost always sufficient; a few mappings expand (e.g. U+0130)
+    UChar *u16_result = (UChar*) cm_scratch_alloc(sizeof(UChar) * (u16_len + 1));
     int32_t result_len = u_strToLower(u16_result, u16_len + 1, u16_text, u16_len, locale, &status);
 
+    if (status == U_BUFFER_OVERFLOW_ERROR) {
+        status = U_ZERO_ERROR;
+        u16_result = (UChar*) cm_scratch_alloc(sizeof(UChar) * (result_len + 1));
+        result_len = u_strToLower(u16_result, result_len + 1, u16_text, u16_len, locale, &status);
+    }
+
     if (U_FAILURE(status)) {
-        efree(u16_text);
-        efree(u16_result);
-        zend_value_error("icu_lowercase: Case conversion failed");
-        return;
+        cm_scratch_release(mark);
+        zend_value_error("%s: Case conversion failed", fn);
+        return NULL;
     }
 
     // 4. Convert UTF-16 result back to UTF-8
     int32_t u8_len = 0;
-    u_strToUTF8(NULL, 0, &u8_len, u16_result, result_len, &status);
+    char *u8_result = icu_to_u8(u16_result, result_len, &u8_len, &status, fn);
 
-    if (status == U_BUFFER_OVERFLOW_ERROR) {
-        status = U_ZERO_ERROR;
-        char *u8_result = (char*) emalloc(u8_len + 1);
-        u_strToUTF8(u8_result, u8_len + 1, &u8_len, u16_result, result_len, &status);
+    if (!u8_result) {
+        cm_scratch_release(mark);
+        return NULL;
+    }
 
-        if (U_SUCCESS(status)) {
-            ZVAL_STRINGL(return_value, u8_result, u8_len);
-        } else {
-            ZVAL_EMPTY_STRING(return_value);
-        }
+    zend_string *result = U_SUCCESS(status) ? zend_string_init(u8_result, u8_len, 0) : ZSTR_EMPTY_ALLOC();
 
-        efree(u8_result);
-    } else {
+    // 5. Cleanup
+    cm_scratch_release(mark);
+
+    return result;
+}
+
+void icu_lowercase(zend_string *text, const char *locale, zval *return_value)
+{
+    if (!text) {
         ZVAL_EMPTY_STRING(return_value);
+        return;
     }
 
-    // 5. Cleanup
-    efree(u16_text);
-    efree(u16_result);
+    zend_string *result = icu_lowercase_text(text, locale, icu_locale_simple_case(locale), "icu_lowercase");
+
+    if (result) {
+        ZVAL_STR(return_value, result);
+    }
 }
 
-void icu_remove_diacritics(zend_string *text, zval *return_value)
+void icu_lowercase_all(zval *texts, const char *locale, zval *return_value)
+{
+    zend_bool simple_case = icu_locale_simple_case(locale);
+    zend_string *key;
+    zend_ulong idx;
+    zval *text;
+    zval lower;
+
+    array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(texts)));
+
+    ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(texts), idx, key, text) {
+        zend_string *result;
+
+        if (Z_TYPE_P(text) != IS_STRING) {
+            zend_type_error("icu_lowercase_all: all elements must be strings");
+            icu_batch_fail(return_value);
+            break;
+        }
+
+        if ((result = icu_lowercase_text(Z_STR_P(text), locale, simple_case, "icu_lowercase_all")) == NULL) {
+            icu_batch_fail(return_value);
+            break;
+        }
+
+        ZVAL_STR(&lower, result);
+        icu_batch_add(return_value, key, idx, &lower);
+    } ZEND_HASH_FOREACH_END();
+}
+
+/* ---------- Diacritic removal ---------- */
+
+/* The transliterator is opened on first use, for text outside Latin-1. NULL after raising an error */
+static zend_string *icu_remove_diacritics_text(zend_string *text, UTransliterator **trans, const char *fn)
 {
     // 1. Input validation
-    if (!text || ZSTR_LEN(text) == 0) {
-        ZVAL_EMPTY_STRING(return_value);
-        return;
+    if (ZSTR_LEN(text) == 0) {
+        return ZSTR_EMPTY_ALLOC();
+    }
+
+    // ASCII has no marks; Latin-1 letters map through a table
+    if (icu_is_ascii(ZSTR_VAL(text), ZSTR_LEN(text))) {
+        return zend_string_copy(text);
+    }
+    if (icu_is_latin1(ZSTR_VAL(text), ZSTR_LEN(text))) {
+        return icu_latin1_strip(text);
     }
 
     UErrorCode status = U_ZERO_ERROR;
 
-    // 2. UTF-8 to UTF-16 conversion
+    // 2. Create transliterator
+    if (!*trans) {
+        *trans = icu_open_diacritics_transliterator(&status);
+        if (U_FAILURE(status) || !*trans) {
+            zend_value_error("%s: Failed to create transliterator", fn);
+            return NULL;
+        }
+    }
+
+    // 3. UTF-8 to UTF-16 conversion
+    // Converted straight into the transliteration buffer, with extra space
+    // for potential expansion
+    cm_scratch_pos mark = cm_scratch_mark();
     int32_t u16_len = 0;
-    UChar *u16_text = NULL;
+    int32_t extra = (int32_t) ZSTR_LEN(text) + 9;
+    int32_t capacity = (int32_t) ZSTR_LEN(text) + extra + 1;
+    UChar *u16_result = icu_to_u16(text, extra, &u16_len, &status);
 
-    // Pre-flight to get required buffer size
-    u_strFromUTF8(NULL, 0, &u16_len, ZSTR_VAL(text), ZSTR_LEN(text), &status);
-    if (status != U_BUFFER_OVERFLOW_ERROR && U_FAILURE(status)) {
-        zend_value_error("icu_remove_diacritics: UTF-8 conversion failed");
-        return;
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("%s: UTF-8 to UTF-16 conversion failed", fn);
+        return NULL;
     }
 
-    status = U_ZERO_ERROR;
-    u16_text = (UChar*) emalloc(sizeof(UChar) * (u16_len + 1));
-    u_strFromUTF8(u16_text, u16_len + 1, &u16_len, ZSTR_VAL(text), ZSTR_LEN(text), &status);
+    // 4. Apply transliteration in place
+    int32_t result_len = u16_len;
+    int32_t limit = u16_len;
+
+    utrans_transUChars(*trans, u16_result, &result_len, capacity, 0, &limit, &status);
 
     if (U_FAILURE(status)) {
-        efree(u16_text);
-        zend_value_error("icu_remove_diacritics: UTF-8 to UTF-16 conversion failed");
-        return;
+        cm_scratch_release(mark);
+        zend_value_error("%s: Transliteration failed", fn);
+        return NULL;
     }
 
-    // 3. Create transliterator
-    // NFD = Decompose, remove nonspacing marks, NFC = Recompose
-    UChar trans_id[] = {
-        0x4E, 0x46, 0x44, 0x3B, 0x20,  // "NFD; "
-        0x5B, 0x3A, 0x4E, 0x6F, 0x6E, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x20, 0x4D, 0x61, 0x72, 0x6B, 0x3A, 0x5D, 0x20,  // "[[:Nonspacing Mark:]] "
-        0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x3B, 0x20,  // "Remove; "
-        0x4E, 0x46, 0x43,  // "NFC"
-        0x00
-    };
+    // 5. Convert UTF-16 result back to UTF-8
+    int32_t u8_len = 0;
+    char *u8_result = icu_to_u8(u16_result, result_len, &u8_len, &status, fn);
+
+    if (!u8_result) {
+        cm_scratch_release(mark);
+        return NULL;
+    }
+
+    zend_string *result = U_SUCCESS(status) ? zend_string_init(u8_result, u8_len, 0) : ZSTR_EMPTY_ALLOC();
+
+    // 6. Cleanup
+    cm_scratch_release(mark);
 
-    UTransliterator *trans = utrans_openU(trans_id, -1, UTRANS_FORWARD, NULL, 0, NULL, &status);
-    if (U_FAILURE(status) || !trans) {
-        efree(u16_text);
-        zend_value_error("icu_remove_diacritics: Failed to create transliterator");
+    return result;
+}
+
+void icu_remove_diacritics(zend_string *text, zval *return_value)
+{
+    UTransliterator *trans = NULL;
+
+    if (!text) {
+        ZVAL_EMPTY_STRING(return_value);
         return;
     }
 
-    // 4. Apply transliteration
-    // Allocate buffer with extra space for potential expansion
-    int32_t capacity = u16_len * 2 + 10;
-    UChar *u16_result = (UChar*) emalloc(sizeof(UChar) * capacity);
-    u_strncpy(u16_result, u16_text, u16_len);
-    u16_result[u16_len] = 0;
+    zend_string *result = icu_remove_diacritics_text(text, &trans, "icu_remove_diacritics");
 
-    int32_t result_len = u16_len;
-    int32_t limit = u16_len;
+    if (result) {
+        ZVAL_STR(return_value, result);
+    }
 
-    utrans_transUChars(trans, u16_result, &result_len, capacity, 0, &limit, &status);
+    if (trans) {
+        utrans_close(trans);
+    }
+}
 
-    if (U_FAILURE(status)) {
+void icu_remove_diacritics_all(zval *texts, zval *return_value)
+{
+    UTransliterator *trans = NULL;
+    zend_string *key;
+    zend_ulong idx;
+    zval *text;
+    zval stripped;
+
+    array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(texts)));
+
+    ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(texts), idx, key, text) {
+        zend_string *result;
+
+        if (Z_TYPE_P(text) != IS_STRING) {
+            zend_type_error("icu_remove_diacritics_all: all elements must be strings");
+            icu_batch_fail(return_value);
+            break;
+        }
+
+        if ((result = icu_remove_diacritics_text(Z_STR_P(text), &trans, "icu_remove_diacritics_all")) == NULL) {
+            icu_batch_fail(return_value);
+            break;
+        }
+
+        ZVAL_STR(&stripped, result);
+        icu_batch_add(return_value, key, idx, &stripped);
+    } ZEND_HASH_FOREACH_END();
+
+    if (trans) {
         utrans_close(trans);
-        efree(u16_text);
-        efree(u16_result);
-        zend_value_error("icu_remove_diacritics: Transliteration failed");
+    }
+}
+
+/*
+ * Unicode normalization with unorm2. The instances are process-wide ICU
+ * singletons: they are looked up once and kept. A quick check runs first,
+ * so text that is already in the requested form is returned as the same
+ * zend_string; otherwise only the part after the normalized prefix is
+ * normalized.
+ */
+
+typedef struct {
+    const char *name;
+    const char *data;               /* ICU normalization data */
+    UNormalization2Mode mode;
+} icu_norm_form;
+
+static const icu_norm_form icu_norm_forms[] = {
+    { "NFC",           "nfc",     UNORM2_COMPOSE },
+    { "NFD",           "nfc",     UNORM2_DECOMPOSE },
+    { "NFKC",          "nfkc",    UNORM2_COMPOSE },
+    { "NFKD",          "nfkc",    UNORM2_DECOMPOSE },
+    { "NFKC_Casefold", "nfkc_cf", UNORM2_COMPOSE },
+};
+
+#define ICU_NORM_FORMS (sizeof(icu_norm_forms) / sizeof(icu_norm_forms[0]))
+#define ICU_NORM_CASEFOLD 4
+
+/* [form][0] = the form itself, [form][1] = its decomposition (mark stripping) */
+static const UNormalizer2 *icu_norm_cache[ICU_NORM_FORMS][2];
+
+static const UNormalizer2 *icu_normalizer(size_t form, zend_bool decompose, UErrorCode *status)
+{
+    const UNormalizer2 **slot = &icu_norm_cache[form][decompose];
+
+    if (!*slot) {
+        *slot = unorm2_getInstance(NULL, icu_norm_forms[form].data,
+            decompose ? UNORM2_DECOMPOSE : icu_norm_forms[form].mode, status);
+    }
+
+    return *slot;
+}
+
+/* Whole-string normalization into the scratch arena */
+static UChar *icu_norm_apply(const UNormalizer2 *n, const UChar *src, int32_t len, int32_t *out_len, UErrorCode *status)
+{
+    int32_t capacity = len * 2 + 16;
+    UChar *dst = (UChar*) cm_scratch_alloc(sizeof(UChar) * capacity);
+
+    *out_len = unorm2_normalize(n, src, len, dst, capacity, status);
+
+    if (*status == U_BUFFER_OVERFLOW_ERROR) {
+        *status = U_ZERO_ERROR;
+        dst = (UChar*) cm_scratch_alloc(sizeof(UChar) * (*out_len + 1));
+        *out_len = unorm2_normalize(n, src, len, dst, *out_len + 1, status);
+    }
+
+    return dst;
+}
+
+/* Normalize src[span..len) onto the already-normalized prefix src[0..span) */
+static UChar *icu_norm_tail(const UNormalizer2 *n, const UChar *src, int32_t len, int32_t span, int32_t *out_len, UErrorCode *status)
+{
+    int32_t capacity = span + (len - span) * 2 + 16;
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        UChar *dst = (UChar*) cm_scratch_alloc(sizeof(UChar) * capacity);
+
+        memcpy(dst, src, sizeof(UChar) * span);
+        *out_len = unorm2_normalizeSecondAndAppend(n, dst, span, capacity, src + span, len - span, status);
+
+        if (*status != U_BUFFER_OVERFLOW_ERROR) {
+            return dst;
+        }
+        *status = U_ZERO_ERROR;
+        capacity = *out_len + 1;
+    }
+
+    *status = U_BUFFER_OVERFLOW_ERROR;
+    return NULL;
+}
+
+/* Drop nonspacing marks (Mn) in place */
+static int32_t icu_strip_marks(UChar *text, int32_t len)
+{
+    int32_t out = 0;
+    int32_t i = 0;
+
+    while (i < len) {
+        int32_t start = i;
+        UChar32 c;
+
+        U16_NEXT(text, i, len, c);
+        if (u_charType(c) != U_NON_SPACING_MARK) {
+            while (start < i) {
+                text[out++] = text[start++];
+            }
+        }
+    }
+
+    return out;
+}
+
+void icu_normalize(zend_string *text, const char *form, zend_bool strip_marks, zval *return_value)
+{
+    size_t f;
+
+    for (f = 0; f < ICU_NORM_FORMS; f++) {
+        if (strcasecmp(form, icu_norm_forms[f].name) == 0) {
+            break;
+        }
+    }
+
+    if (f == ICU_NORM_FORMS) {
+        zend_value_error("icu_normalize: unknown form '%s' (NFC, NFD, NFKC, NFKD or NFKC_Casefold)", form);
         return;
     }
 
-    // 5. Convert UTF-16 result back to UTF-8
-    int32_t u8_len = 0;
-    u_strToUTF8(NULL, 0, &u8_len, u16_result, result_len, &status);
+    // 1. ASCII is in every form already; only case folding changes it
+    if (icu_is_ascii(ZSTR_VAL(text), ZSTR_LEN(text))) {
+        if (f == ICU_NORM_CASEFOLD) {
+            ZVAL_STR(return_value, zend_string_tolower(text));
+        } else {
+            ZVAL_STR_COPY(return_value, text);
+        }
+        return;
+    }
 
-    if (status == U_BUFFER_OVERFLOW_ERROR) {
-        status = U_ZERO_ERROR;
-        char *u8_result = (char*) emalloc(u8_len + 1);
-        u_strToUTF8(u8_result, u8_len + 1, &u8_len, u16_result, result_len, &status);
+    UErrorCode status = U_ZERO_ERROR;
+    const UNormalizer2 *n = icu_normalizer(f, 0, &status);
+    const UNormalizer2 *d = strip_marks ? icu_normalizer(f, 1, &status) : NULL;
 
+    if (U_FAILURE(status)) {
+        zend_value_error("icu_normalize: failed to load %s normalization data", icu_norm_forms[f].name);
+        return;
+    }
+
+    // 2. UTF-8 to UTF-16 conversion
+    cm_scratch_pos mark = cm_scratch_mark();
+    int32_t u16_len = 0;
+    UChar *u16_text = icu_to_u16(text, 0, &u16_len, &status);
+
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("icu_normalize: UTF-8 to UTF-16 conversion failed");
+        return;
+    }
+
+    // 3. Normalize
+    UChar *u16_result;
+    int32_t result_len = 0;
+
+    if (strip_marks) {
+        // Decompose, drop the marks, then recompose for the composed forms
+        u16_result = icu_norm_apply(d, u16_text, u16_len, &result_len, &status);
         if (U_SUCCESS(status)) {
-            ZVAL_STRINGL(return_value, u8_result, u8_len);
-        } else {
-            ZVAL_EMPTY_STRING(return_value);
+            result_len = icu_strip_marks(u16_result, result_len);
+            if (icu_norm_forms[f].mode == UNORM2_COMPOSE) {
+                u16_result = icu_norm_apply(n, u16_result, result_len, &result_len, &status);
+            }
+        }
+    } else {
+        int32_t span = unorm2_spanQuickCheckYes(n, u16_text, u16_len, &status);
+
+        if (U_SUCCESS(status) && span == u16_len) {
+            // Already normalized: no copy
+            cm_scratch_release(mark);
+            ZVAL_STR_COPY(return_value, text);
+            return;
         }
 
-        efree(u8_result);
+        u16_result = icu_norm_tail(n, u16_text, u16_len, span, &result_len, &status);
+    }
+
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("icu_normalize: normalization failed");
+        return;
+    }
+
+    // 4. Convert UTF-16 result back to UTF-8
+    int32_t u8_len = 0;
+    char *u8_result = icu_to_u8(u16_result, result_len, &u8_len, &status, "icu_normalize");
+
+    if (!u8_result) {
+        cm_scratch_release(mark);
+        return;
+    }
+
+    if (U_SUCCESS(status)) {
+        ZVAL_STRINGL(return_value, u8_result, u8_len);
     } else {
         ZVAL_EMPTY_STRING(return_value);
     }
 
-    // 6. Cleanup
-    utrans_close(trans);
-    efree(u16_text);
-    efree(u16_result);
+    // 5. Cleanup
+    cm_scratch_release(mark);
 }
@@ -2,10 +2,34 @@
 #define CORALMEDIA_ICU_BRIDGE_H
 
 #include "php.h"
+#include <unicode/utrans.h>
 
 void icu_word_break(zend_string *text, const char *locale, zval *return_value);
 void icu_sentence_break(zend_string *text, const char *locale, zval *return_value);
 void icu_lowercase(zend_string *text, const char *locale, zval *return_value);
 void icu_remove_diacritics(zend_string *text, zval *return_value);
+void icu_normalize(zend_string *text, const char *form, zend_bool strip_marks, zval *return_value);
+
+/* Array in, array out: one set of ICU handles for the batch, keys preserved */
+void icu_word_break_all(zval *texts, const char *locale, zval *return_value);
+void icu_sentence_break_all(zval *texts, const char *locale, zval *return_value);
+void icu_lowercase_all(zval *texts, const char *locale, zval *return_value);
+void icu_remove_diacritics_all(zval *texts, zval *return_value);
+
+/* One chunk of a stream: [words, bytes consumed]; the rest is carried to the next chunk */
+void icu_word_break_chunk(zend_string *text, const char *locale, zend_bool final, zval *return_value);
+
+/* Counts only, no segments: int, int, and [words, sentences, graphemes, bytes, avg_word_length] */
+void icu_count_words(zend_string *text, const char *locale, zval *return_value);
+void icu_count_sentences(zend_string *text, const char *locale, zval *return_value);
+void icu_text_stats(zend_string *text, const char *locale, zval *return_value);
+
+/* No byte >= 0x80 (SSE2 when available) */
+zend_bool icu_is_ascii(const char *text, size_t len);
+/* ASCII lowercasing agrees with ICU for this locale (not tr, az, lt) */
+zend_bool icu_locale_simple_case(const char *locale);
+
+/* "NFD; [:Nonspacing Mark:] Remove; NFC", shared with the text pipeline */
+UTransliterator *icu_open_diacritics_transliterator(UErrorCode *status);
 
 #endif
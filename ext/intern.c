@@ -0,0 +1,80 @@
+#include "intern.h"
+#include "scratch.h"
+
+typedef struct {
+    HashTable *table;       /* string => the same string */
+    zend_long limit;        /* 0 = off */
+} cm_intern_state;
+
+CM_TLS cm_intern_state intern;
+
+static void intern_release(void)
+{
+    if (intern.table) {
+        zend_hash_destroy(intern.table);
+        efree(intern.table);
+        intern.table = NULL;
+    }
+}
+
+void cm_intern_rshutdown(void)
+{
+    intern_release();
+    intern.limit = 0;
+}
+
+zend_bool cm_intern_active(void)
+{
+    return intern.limit > 0;
+}
+
+zend_string *cm_intern(const char *str, size_t len)
+{
+    if (intern.limit == 0) {
+        return zend_string_init(str, len, 0);
+    }
+
+    /* One character strings are interned by the engine already */
+    if (len <= 1) {
+        return len ? ZSTR_CHAR((zend_uchar) str[0]) : ZSTR_EMPTY_ALLOC();
+    }
+
+    zval *found = zend_hash_str_find(intern.table, str, len);
+
+    if (found) {
+        return zend_string_copy(Z_STR_P(found));
+    }
+
+    zend_string *s = zend_string_init(str, len, 0);
+
+    zend_string_hash_val(s);
+
+    if ((zend_long) zend_hash_num_elements(intern.table) < intern.limit) {
+        zval zv;
+
+        /* The table holds a reference as key and one as value */
+        ZVAL_STR_COPY(&zv, s);
+        zend_hash_add_new(intern.table, s, &zv);
+    }
+
+    return s;
+}
+
+void cm_intern_configure(zend_long limit, zval *return_value)
+{
+    if (limit < 0) {
+        zend_value_error("internTokens(): limit must not be negative");
+        return;
+    }
+
+    ZVAL_LONG(return_value, intern.table ? (zend_long) zend_hash_num_elements(intern.table) : 0);
+
+    if (limit == 0) {
+        intern_release();
+    } else if (!intern.table) {
+        intern.table = emalloc(sizeof(HashTable));
+        zend_hash_init(intern.table, 1024, NULL, ZVAL_PTR_DTOR, 0);
+    }
+
+    intern.limit = limit;
+}
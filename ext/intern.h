@@ -0,0 +1,34 @@
+#ifndef CORALMEDIA_INTERN_H
+#define CORALMEDIA_INTERN_H
+
+#include "php.h"
+
+/*
+ * Opt-in per-request intern table for tokens and stems.
+ *
+ * Word breaking and stemming create one zend_string per occurrence, so
+ * "the" is allocated once for every time it appears. With the table on
+ * (Text::internTokens()), every token and stem is looked up first and a
+ * new reference to the existing string is returned instead: repeated
+ * tokens share one refcounted string, and since its hash is computed when
+ * it enters the table, inserting it as an array key does not hash it again.
+ *
+ * The table holds at most limit distinct strings; once full, new strings
+ * are created as usual and only those already held are shared. It is
+ * released and switched off at the end of every request.
+ */
+
+#define CM_INTERN_DEFAULT_LIMIT (1 << 20)   /* distinct strings */
+
+void cm_intern_rshutdown(void);
+
+/* Table on for this request */
+zend_bool cm_intern_active(void);
+
+/* New reference to str; a plain new string when the table is off or full */
+zend_string *cm_intern(const char *str, size_t len);
+
+/* Text::internTokens(): limit > 0 switches the table on, 0 switches it off and releases it; returns the number of strings it held */
+void cm_intern_configure(zend_long limit, zval *return_value);
+
+#endif
@@ -55,4 +55,37 @@ void linear_algebra_matrix_add_scalar_zval(zval *a, double scalar, int rows, int
 void linear_algebra_matrix_multiply_scalar_zval(zval *a, double scalar, int rows, int cols, zval *return_value);
 void linear_algebra_matrix_divide_scalar_zval(zval *a, double scalar, int rows, int cols, zval *return_value);
 
+/* Reductions (sum, mean, variance, min, max, argmin, argmax) */
+void linear_algebra_matrix_reduce_zval(zval *a, int rows, int cols, int op, int axis, zval *return_value);
+
+/* Row-wise activations (relu, sigmoid, tanh, gelu, softmax, log-softmax) */
+void linear_algebra_matrix_activation_zval(zval *a, int rows, int cols, int fn, zval *return_value);
+void linear_algebra_matrix_logsumexp_zval(zval *a, int rows, int cols, zval *return_value);
+
+/* Fused chains, emitted by the optimizers for nested calls */
+double linear_algebra_dot_normalized_zval(zval *a, int method_a, zval *b, int method_b);
+void linear_algebra_affine_hadamard_zval(zval *a, double scale, double shift, zval *b, int rows, int cols, const char *fn, int b_index, zval *return_value);
+void linear_algebra_matmul_add_scalar_zval(zval *a, zval *b, int m, int n, int k, zend_bool transpose_a, zend_bool transpose_b, double scalar, int rows, int cols, zval *return_value);
+
+/* Packed float32 buffers */
+void linear_algebra_pack_zval(zval *x, zval *return_value);
+void linear_algebra_unpack_zval(zval *packed, zval *return_value);
+
+/* Dense (fully connected) model */
+void linear_algebra_dense_forward_zval(zval *layers, zval *x, int batch, zval *return_value);
+void linear_algebra_dense_save_zval(zval *layers, zval *return_value);
+void linear_algebra_dense_load_zval(zval *data, zval *return_value);
+
+/* K-means clustering */
+void linear_algebra_kmeans_zval(zval *x, int rows, int cols, int k, int max_iter, double tol, int batch_size, zend_long seed, int threads, zval *return_value);
+void linear_algebra_kmeans_assign_zval(zval *x, int rows, int cols, zval *centroids, int k, zval *return_value);
+
+/* Sparse linear classifiers (logistic regression, linear SVM) */
+void linear_algebra_linear_train_zval(zval *docs, zval *labels, int loss, int optimizer, int epochs, double eta0, double lambda, zend_long seed, int threads, zval *return_value);
+void linear_algebra_linear_predict_zval(zval *features, zval *weights, int outputs, zval *docs, zend_bool scores, zval *return_value);
+
+/* Sparse vectors (id or term => weight) */
+double linear_algebra_sparse_dot_zval(zval *a, zval *b);
+double linear_algebra_sparse_cosine_zval(zval *a, zval *b);
+
 #endif /* LAPACK_BRIDGE_H */
\ No newline at end of file
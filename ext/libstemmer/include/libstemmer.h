@@ -55,6 +55,14 @@ struct sb_stemmer * sb_stemmer_new(const char * algorithm, const char * charenc)
  */
 void                sb_stemmer_delete(struct sb_stemmer * stemmer);
 
+/** Free the lookup indexes shared by all stemmers.
+ *
+ *  The runtime indexes each among table on first use and keeps the
+ *  indexes for the life of the process. Call this only once no stemmer
+ *  is in use in any thread, e.g. at module shutdown.
+ */
+void                sb_stemmer_release_indexes(void);
+
 /** Stem a word.
  *
  *  The return value is owned by the stemmer - it must not be freed or
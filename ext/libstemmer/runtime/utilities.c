@@ -209,6 +209,96 @@ extern int eq_v_b(struct SN_env * z, const symbol * p) {
     return eq_s_b(z, SIZE(p), p);
 }
 
+/* Dispatch index for find_among/find_among_b. An among table is sorted by
+ * its strings (by their reversed strings for find_among_b), so the entries
+ * whose first (last) byte is b are v[first[b]] .. v[first[b + 1] - 1], with
+ * an empty string, if any, at v[0]. One byte of input then narrows the
+ * binary search to those entries instead of the whole table.
+ *
+ * The generated modules keep their tables static, so there is no list to
+ * build the indexes from up front: each is built on the first lookup in its
+ * table and published with an atomic compare-and-swap into a fixed,
+ * pointer-keyed slot array, lock-free for threaded builds. Readers never see
+ * a partly built index. Small tables, a full slot array and compilers
+ * without the GCC atomic builtins keep the plain binary search.
+ */
+
+#define AMONG_INDEX_SLOTS 1024      /* power of two, well above the tables in all modules */
+#define AMONG_INDEX_PROBES 16
+#define AMONG_INDEX_MIN_SIZE 8      /* smaller tables: the search is as fast */
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AMONG_INDEX 1
+#endif
+
+#ifdef AMONG_INDEX
+
+struct among_index {
+    const struct among * v;
+    int backward;
+    unsigned short first[257];
+};
+
+static struct among_index * among_indexes[AMONG_INDEX_SLOTS];
+
+static struct among_index * among_index_build(const struct among * v, int v_size, int backward) {
+    struct among_index * x;
+    int b, k = 0;
+
+    if (v_size > 0xFFFF) return NULL;
+    x = (struct among_index *) malloc(sizeof(struct among_index));
+    if (x == NULL) return NULL;
+    x->v = v;
+    x->backward = backward;
+
+    if (v[0].s_size == 0) k = 1;
+    for (b = 0; b < 256; b++) {
+        while (k < v_size && (backward ? v[k].s[v[k].s_size - 1] : v[k].s[0]) < b) k++;
+        x->first[b] = k;
+    }
+    x->first[256] = v_size;
+    return x;
+}
+
+static const struct among_index * among_index_get(const struct among * v, int v_size, int backward) {
+    unsigned h = (unsigned) (((size_t) v >> 4) * 2654435761u) & (AMONG_INDEX_SLOTS - 1);
+    struct among_index * built = NULL;
+    int probe;
+
+    for (probe = 0; probe < AMONG_INDEX_PROBES; probe++, h = (h + 1) & (AMONG_INDEX_SLOTS - 1)) {
+        struct among_index * x = __atomic_load_n(&among_indexes[h], __ATOMIC_ACQUIRE);
+
+        if (x == NULL) {
+            if (built == NULL && (built = among_index_build(v, v_size, backward)) == NULL) return NULL;
+            if (__atomic_compare_exchange_n(&among_indexes[h], &x, built, 0,
+                                            __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)) {
+                return built;
+            }
+            /* Another thread took the slot first: x is now its index */
+        }
+        if (x->v == v && x->backward == backward) {
+            free(built);
+            return x;
+        }
+    }
+    free(built);
+    return NULL;
+}
+
+extern void sb_stemmer_release_indexes(void) {
+    int h;
+    for (h = 0; h < AMONG_INDEX_SLOTS; h++) {
+        free(among_indexes[h]);
+        among_indexes[h] = NULL;
+    }
+}
+
+#else
+
+extern void sb_stemmer_release_indexes(void) {}
+
+#endif
+
 extern int find_among(struct SN_env * z, const struct among * v, int v_size) {
 
     int i = 0;
@@ -224,6 +314,36 @@ extern int find_among(struct SN_env * z, const struct among * v, int v_size) {
 
     int first_key_inspected = 0;
 
+#ifdef AMONG_INDEX
+    const struct among_index * x;
+
+    if (v_size >= AMONG_INDEX_MIN_SIZE && c < l && (x = among_index_get(v, v_size, 0)) != NULL) {
+        /* Every entry in [i + 1, j) shares q[0]; i is a sentinel until an entry <= q is found */
+        int lo = x->first[q[0]] - 1;
+        i = lo;
+        j = x->first[q[0] + 1];
+        common_i = common_j = 1;
+
+        while (j - i > 1) {
+            int k = i + ((j - i) >> 1);
+            int diff = 0;
+            int common = common_i < common_j ? common_i : common_j;
+            w = v + k;
+            {
+                int i2; for (i2 = common; i2 < w->s_size; i2++) {
+                    if (c + common == l) { diff = -1; break; }
+                    diff = q[common] - w->s[i2];
+                    if (diff != 0) break;
+                    common++;
+                }
+            }
+            if (diff < 0) { j = k; common_j = common; }
+                     else { i = k; common_i = common; }
+        }
+        /* Nothing with q[0] fits: only an empty string can */
+        if (i == lo) { i = 0; common_i = 0; }
+    } else
+#endif
     while(1) {
         int k = i + ((j - i) >> 1);
         int diff = 0;
@@ -284,6 +404,34 @@ extern int find_among_b(struct SN_env * z, const struct among * v, int v_size) {
 
     int first_key_inspected = 0;
 
+#ifdef AMONG_INDEX
+    const struct among_index * x;
+
+    if (v_size >= AMONG_INDEX_MIN_SIZE && c > lb && (x = among_index_get(v, v_size, 1)) != NULL) {
+        int lo = x->first[q[0]] - 1;
+        i = lo;
+        j = x->first[q[0] + 1];
+        common_i = common_j = 1;
+
+        while (j - i > 1) {
+            int k = i + ((j - i) >> 1);
+            int diff = 0;
+            int common = common_i < common_j ? common_i : common_j;
+            w = v + k;
+            {
+                int i2; for (i2 = w->s_size - 1 - common; i2 >= 0; i2--) {
+                    if (c - common == lb) { diff = -1; break; }
+                    diff = q[- common] - w->s[i2];
+                    if (diff != 0) break;
+                    common++;
+                }
+            }
+            if (diff < 0) { j = k; common_j = common; }
+                     else { i = k; common_i = common; }
+        }
+        if (i == lo) { i = 0; common_i = 0; }
+    } else
+#endif
     while(1) {
         int k = i + ((j - i) >> 1);
         int diff = 0;
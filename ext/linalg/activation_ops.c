@@ -0,0 +1,214 @@
+#include "../lapack_bridge.h"
+#include "../linalg_internal.h"
+
+#include <math.h>
+
+/* ---------- Kernels ---------- */
+
+/*
+ * Kernels work in place on a row-major rows × cols float buffer, so they can
+ * be chained directly after cblas_sgemm without another copy. Loops are kept
+ * branch-free where possible so the compiler can vectorize them.
+ */
+
+#define LA_GELU_C0 0.7978845608028654f /* sqrt(2 / pi) */
+#define LA_GELU_C1 0.044715f
+
+static float row_max(const float *x, int n)
+{
+    float m = x[0];
+    for (int j = 1; j < n; j++) {
+        m = x[j] > m ? x[j] : m;
+    }
+    return m;
+}
+
+/* log(sum(exp(x))) of one row, shifted by the row max to avoid overflow */
+float la_row_logsumexp(const float *x, int n)
+{
+    float m = row_max(x, n);
+    float sum = 0.0f;
+
+    if (isinf(m)) {
+        return m;
+    }
+
+    for (int j = 0; j < n; j++) {
+        sum += expf(x[j] - m);
+    }
+
+    return m + logf(sum);
+}
+
+/*
+ * (Log-)softmax of a row whose max m is infinite, where shifting by m gives
+ * inf - inf: the limit puts equal mass on the +INF entries and none on the
+ * rest, or spreads it evenly when every entry is -INF.
+ */
+static void row_softmax_infinite(float *row, int n, float m, int log_space)
+{
+    int hits = 0;
+
+    for (int j = 0; j < n; j++) {
+        hits += m < 0.0f || row[j] == m;
+    }
+
+    float p = 1.0f / (float) hits;
+
+    for (int j = 0; j < n; j++) {
+        float v = (m < 0.0f || row[j] == m) ? p : 0.0f;
+        row[j] = log_space ? logf(v) : v;
+    }
+}
+
+void la_activation_apply(float *x, int rows, int cols, int fn)
+{
+    size_t size = (size_t) rows * cols;
+
+    switch (fn) {
+        case LA_ACT_IDENTITY:
+            break;
+
+        case LA_ACT_RELU:
+            for (size_t i = 0; i < size; i++) {
+                x[i] = x[i] > 0.0f ? x[i] : 0.0f;
+            }
+            break;
+
+        case LA_ACT_SIGMOID:
+            for (size_t i = 0; i < size; i++) {
+                x[i] = 1.0f / (1.0f + expf(-x[i]));
+            }
+            break;
+
+        case LA_ACT_TANH:
+            for (size_t i = 0; i < size; i++) {
+                x[i] = tanhf(x[i]);
+            }
+            break;
+
+        case LA_ACT_GELU:
+            /* tanh approximation (Hendrycks & Gimpel) */
+            for (size_t i = 0; i < size; i++) {
+                float v = x[i];
+                x[i] = 0.5f * v * (1.0f + tanhf(LA_GELU_C0 * (v + LA_GELU_C1 * v * v * v)));
+            }
+            break;
+
+        case LA_ACT_SOFTMAX:
+            for (int r = 0; r < rows; r++) {
+                float *row = x + (size_t) r * cols;
+                float m = row_max(row, cols);
+                float sum = 0.0f;
+                if (isinf(m)) {
+                    row_softmax_infinite(row, cols, m, 0);
+                    continue;
+                }
+                for (int j = 0; j < cols; j++) {
+                    row[j] = expf(row[j] - m);
+                    sum += row[j];
+                }
+                float inv = 1.0f / sum;
+                for (int j = 0; j < cols; j++) {
+                    row[j] *= inv;
+                }
+            }
+            break;
+
+        case LA_ACT_LOG_SOFTMAX:
+            for (int r = 0; r < rows; r++) {
+                float *row = x + (size_t) r * cols;
+                float lse = la_row_logsumexp(row, cols);
+                if (isinf(lse)) {
+                    row_softmax_infinite(row, cols, lse, 1);
+                    continue;
+                }
+                for (int j = 0; j < cols; j++) {
+                    row[j] -= lse;
+                }
+            }
+            break;
+    }
+}
+
+/* ---------- ACTIVATIONS ---------- */
+
+void linear_algebra_matrix_activation_zval(
+    zval *a,
+    int rows,
+    int cols,
+    int fn,
+    zval *return_value
+) {
+    if (Z_TYPE_P(a) != IS_ARRAY) {
+        zend_type_error("activation(a, rows, cols, fn) expects an array");
+        return;
+    }
+
+    if (fn < LA_ACT_IDENTITY || fn > LA_ACT_LOG_SOFTMAX) {
+        zend_value_error("activation(): invalid activation function");
+        return;
+    }
+
+    HashTable *ha = Z_ARRVAL_P(a);
+    int size = rows * cols;
+    int a_size = zend_hash_num_elements(ha);
+
+    if (rows <= 0 || cols <= 0) {
+        zend_value_error("activation(): rows and cols must be > 0");
+        return;
+    }
+
+    if (a_size != size) {
+        zend_value_error("activation(): matrix size mismatch (expected %d, got %d)", size, a_size);
+        return;
+    }
+
+    float *fa = emalloc(sizeof(float) * size);
+    fill_float_array_from_php_array(a, fa, size);
+
+    la_activation_apply(fa, rows, cols, fn);
+
+    array_init_size(return_value, size);
+    for (int i = 0; i < size; i++) {
+        add_next_index_double(return_value, (double) fa[i]);
+    }
+
+    efree(fa);
+}
+
+void linear_algebra_matrix_logsumexp_zval(
+    zval *a,
+    int rows,
+    int cols,
+    zval *return_value
+) {
+    if (Z_TYPE_P(a) != IS_ARRAY) {
+        zend_type_error("logSumExp(a, rows, cols) expects an array");
+        return;
+    }
+
+    HashTable *ha = Z_ARRVAL_P(a);
+    int size = rows * cols;
+    int a_size = zend_hash_num_elements(ha);
+
+    if (rows <= 0 || cols <= 0) {
+        zend_value_error("logSumExp(): rows and cols must be > 0");
+        return;
+    }
+
+    if (a_size != size) {
+        zend_value_error("logSumExp(): matrix size mismatch (expected %d, got %d)", size, a_size);
+        return;
+    }
+
+    float *fa = emalloc(sizeof(float) * size);
+    fill_float_array_from_php_array(a, fa, size);
+
+    array_init_size(return_value, rows);
+    for (int r = 0; r < rows; r++) {
+        add_next_index_double(return_value, (double) la_row_logsumexp(fa + (size_t) r * cols, cols));
+    }
+
+    efree(fa);
+}
@@ -0,0 +1,358 @@
+#include "../lapack_bridge.h"
+#include "../linalg_internal.h"
+
+#ifdef USE_SYSTEM_LAPACK
+    #include <cblas.h>
+#else
+    #error "System OpenBLAS required"
+#endif
+
+#include <string.h>
+
+/*
+ * Dense layers keep their parameters as packed float32 strings
+ * (see linear_algebra_pack_zval), so a model is converted from PHP arrays
+ * once and every forward pass reads the weights in place.
+ *
+ * Layer array keys: "inputs", "outputs", "activation",
+ * "weights" (inputs × outputs, row-major) and "bias" (outputs).
+ */
+
+#define LA_DENSE_MAGIC   "CMDN"
+#define LA_DENSE_VERSION 1
+
+/* ---------- PACK / UNPACK ---------- */
+
+void linear_algebra_pack_zval(zval *x, zval *return_value)
+{
+    if (Z_TYPE_P(x) != IS_ARRAY) {
+        zend_type_error("pack(x) expects an array");
+        return;
+    }
+
+    size_t n = zend_hash_num_elements(Z_ARRVAL_P(x));
+    zend_string *packed = zend_string_alloc(sizeof(float) * n, 0);
+
+    fill_float_array_from_php_array(x, (float *) ZSTR_VAL(packed), n);
+    ZSTR_VAL(packed)[ZSTR_LEN(packed)] = '\0';
+
+    ZVAL_STR(return_value, packed);
+}
+
+void linear_algebra_unpack_zval(zval *packed, zval *return_value)
+{
+    if (Z_TYPE_P(packed) != IS_STRING) {
+        zend_type_error("unpack(packed) expects a string");
+        return;
+    }
+
+    if (Z_STRLEN_P(packed) % sizeof(float) != 0) {
+        zend_value_error("unpack(): packed length must be a multiple of %d bytes", (int) sizeof(float));
+        return;
+    }
+
+    size_t n = Z_STRLEN_P(packed) / sizeof(float);
+    const float *v = (const float *) Z_STRVAL_P(packed);
+
+    array_init_size(return_value, n);
+    for (size_t i = 0; i < n; i++) {
+        add_next_index_double(return_value, (double) v[i]);
+    }
+}
+
+/* ---------- LAYER ACCESS ---------- */
+
+typedef struct {
+    int inputs;
+    int outputs;
+    int activation;
+    const float *weights;
+    const float *bias;
+} la_dense_layer;
+
+static int dense_layer_from_zval(zval *layer, int index, la_dense_layer *out)
+{
+    if (Z_TYPE_P(layer) != IS_ARRAY) {
+        zend_type_error("DenseModel: layer %d must be an array", index);
+        return 0;
+    }
+
+    HashTable *ht = Z_ARRVAL_P(layer);
+    zval *zin  = zend_hash_str_find(ht, ZEND_STRL("inputs"));
+    zval *zout = zend_hash_str_find(ht, ZEND_STRL("outputs"));
+    zval *zact = zend_hash_str_find(ht, ZEND_STRL("activation"));
+    zval *zw   = zend_hash_str_find(ht, ZEND_STRL("weights"));
+    zval *zb   = zend_hash_str_find(ht, ZEND_STRL("bias"));
+
+    if (!zin || !zout || !zw || !zb) {
+        zend_value_error("DenseModel: layer %d requires inputs, outputs, weights and bias", index);
+        return 0;
+    }
+
+    if (Z_TYPE_P(zw) != IS_STRING || Z_TYPE_P(zb) != IS_STRING) {
+        zend_type_error("DenseModel: layer %d weights and bias must be packed strings", index);
+        return 0;
+    }
+
+    out->inputs = (int) zval_get_long(zin);
+    out->outputs = (int) zval_get_long(zout);
+    out->activation = zact ? (int) zval_get_long(zact) : LA_ACT_IDENTITY;
+
+    if (out->inputs <= 0 || out->outputs <= 0) {
+        zend_value_error("DenseModel: layer %d inputs and outputs must be > 0", index);
+        return 0;
+    }
+
+    if (out->activation < LA_ACT_IDENTITY || out->activation > LA_ACT_LOG_SOFTMAX) {
+        zend_value_error("DenseModel: layer %d has an invalid activation", index);
+        return 0;
+    }
+
+    if (Z_STRLEN_P(zw) != sizeof(float) * out->inputs * out->outputs) {
+        zend_value_error("DenseModel: layer %d weights size mismatch (expected %d floats)", index, out->inputs * out->outputs);
+        return 0;
+    }
+
+    if (Z_STRLEN_P(zb) != sizeof(float) * out->outputs) {
+        zend_value_error("DenseModel: layer %d bias size mismatch (expected %d floats)", index, out->outputs);
+        return 0;
+    }
+
+    out->weights = (const float *) Z_STRVAL_P(zw);
+    out->bias = (const float *) Z_STRVAL_P(zb);
+
+    return 1;
+}
+
+/* ---------- FORWARD PASS ---------- */
+
+void linear_algebra_dense_forward_zval(
+    zval *layers,
+    zval *x,
+    int batch,
+    zval *return_value
+) {
+    if (Z_TYPE_P(layers) != IS_ARRAY || Z_TYPE_P(x) != IS_ARRAY) {
+        zend_type_error("DenseModel::predict() expects an array of inputs");
+        return;
+    }
+
+    HashTable *hl = Z_ARRVAL_P(layers);
+    int num_layers = zend_hash_num_elements(hl);
+
+    if (num_layers == 0) {
+        zend_value_error("DenseModel: model has no layers");
+        return;
+    }
+
+    if (batch <= 0) {
+        zend_value_error("DenseModel: batch must be > 0");
+        return;
+    }
+
+    la_dense_layer *spec = emalloc(sizeof(la_dense_layer) * num_layers);
+    int i = 0, max_width = 0;
+    zval *zl;
+
+    ZEND_HASH_FOREACH_VAL(hl, zl) {
+        if (!dense_layer_from_zval(zl, i, &spec[i])) {
+            efree(spec);
+            return;
+        }
+        if (i > 0 && spec[i].inputs != spec[i - 1].outputs) {
+            zend_value_error("DenseModel: layer %d expects %d inputs but layer %d produces %d",
+                i, spec[i].inputs, i - 1, spec[i - 1].outputs);
+            efree(spec);
+            return;
+        }
+        if (spec[i].inputs > max_width) max_width = spec[i].inputs;
+        if (spec[i].outputs > max_width) max_width = spec[i].outputs;
+        i++;
+    } ZEND_HASH_FOREACH_END();
+
+    int x_size = zend_hash_num_elements(Z_ARRVAL_P(x));
+    if (x_size != batch * spec[0].inputs) {
+        zend_value_error("DenseModel: input size mismatch (expected %d, got %d)", batch * spec[0].inputs, x_size);
+        efree(spec);
+        return;
+    }
+
+    /* Two ping-pong activation buffers sized for the widest layer */
+    float *cur = emalloc(sizeof(float) * batch * max_width);
+    float *next = emalloc(sizeof(float) * batch * max_width);
+
+    fill_float_array_from_php_array(x, cur, x_size);
+
+    for (i = 0; i < num_layers; i++) {
+        la_dense_layer *l = &spec[i];
+
+        /* Broadcast the bias into C, then C = X·W + C (beta = 1) */
+        for (int r = 0; r < batch; r++) {
+            memcpy(next + (size_t) r * l->outputs, l->bias, sizeof(float) * l->outputs);
+        }
+
+        cblas_sgemm(
+            CblasRowMajor,
+            CblasNoTrans,
+            CblasNoTrans,
+            batch,          // rows in result
+            l->outputs,     // cols in result
+            l->inputs,      // shared dimension
+            1.0f,           // alpha
+            cur, l->inputs,
+            l->weights, l->outputs,
+            1.0f,           // beta: keep the broadcast bias
+            next, l->outputs
+        );
+
+        la_activation_apply(next, batch, l->outputs, l->activation);
+
+        float *tmp = cur;
+        cur = next;
+        next = tmp;
+    }
+
+    int out_size = batch * spec[num_layers - 1].outputs;
+
+    array_init_size(return_value, out_size);
+    for (i = 0; i < out_size; i++) {
+        add_next_index_double(return_value, (double) cur[i]);
+    }
+
+    efree(cur);
+    efree(next);
+    efree(spec);
+}
+
+/* ---------- BINARY FORMAT ---------- */
+
+/*
+ * Layout (native byte order):
+ *   char[4]  "CMDN"
+ *   uint32   version
+ *   uint32   layer count
+ *   per layer: uint32 inputs, uint32 outputs, uint32 activation,
+ *              float32[inputs * outputs] weights, float32[outputs] bias
+ */
+
+void linear_algebra_dense_save_zval(zval *layers, zval *return_value)
+{
+    if (Z_TYPE_P(layers) != IS_ARRAY) {
+        zend_type_error("DenseModel::save() expects an array of layers");
+        return;
+    }
+
+    HashTable *hl = Z_ARRVAL_P(layers);
+    int num_layers = zend_hash_num_elements(hl);
+    la_dense_layer *spec = emalloc(sizeof(la_dense_layer) * (num_layers ? num_layers : 1));
+    size_t total = 4 + 2 * sizeof(uint32_t);
+    int i = 0;
+    zval *zl;
+
+    ZEND_HASH_FOREACH_VAL(hl, zl) {
+        if (!dense_layer_from_zval(zl, i, &spec[i])) {
+            efree(spec);
+            return;
+        }
+        total += 3 * sizeof(uint32_t)
+               + sizeof(float) * ((size_t) spec[i].inputs * spec[i].outputs + spec[i].outputs);
+        i++;
+    } ZEND_HASH_FOREACH_END();
+
+    zend_string *blob = zend_string_alloc(total, 0);
+    char *p = ZSTR_VAL(blob);
+    uint32_t u;
+
+    memcpy(p, LA_DENSE_MAGIC, 4); p += 4;
+    u = LA_DENSE_VERSION;     memcpy(p, &u, sizeof(u)); p += sizeof(u);
+    u = (uint32_t) num_layers; memcpy(p, &u, sizeof(u)); p += sizeof(u);
+
+    for (i = 0; i < num_layers; i++) {
+        size_t w_bytes = sizeof(float) * spec[i].inputs * spec[i].outputs;
+        size_t b_bytes = sizeof(float) * spec[i].outputs;
+
+        u = (uint32_t) spec[i].inputs;     memcpy(p, &u, sizeof(u)); p += sizeof(u);
+        u = (uint32_t) spec[i].outputs;    memcpy(p, &u, sizeof(u)); p += sizeof(u);
+        u = (uint32_t) spec[i].activation; memcpy(p, &u, sizeof(u)); p += sizeof(u);
+        memcpy(p, spec[i].weights, w_bytes); p += w_bytes;
+        memcpy(p, spec[i].bias, b_bytes);    p += b_bytes;
+    }
+
+    *p = '\0';
+    efree(spec);
+
+    ZVAL_STR(return_value, blob);
+}
+
+void linear_algebra_dense_load_zval(zval *data, zval *return_value)
+{
+    if (Z_TYPE_P(data) != IS_STRING) {
+        zend_type_error("DenseModel::fromFile() expects binary model data");
+        return;
+    }
+
+    const char *p = Z_STRVAL_P(data);
+    const char *end = p + Z_STRLEN_P(data);
+    uint32_t version, num_layers;
+
+    if (end - p < (ptrdiff_t) (4 + 2 * sizeof(uint32_t)) || memcmp(p, LA_DENSE_MAGIC, 4) != 0) {
+        zend_value_error("DenseModel: not a CoralMedia dense model file");
+        return;
+    }
+    p += 4;
+    memcpy(&version, p, sizeof(version));       p += sizeof(version);
+    memcpy(&num_layers, p, sizeof(num_layers)); p += sizeof(num_layers);
+
+    if (version != LA_DENSE_VERSION) {
+        zend_value_error("DenseModel: unsupported model version %u", version);
+        return;
+    }
+
+    /* Every layer has at least its header: bounds the count before it sizes anything */
+    if ((size_t) (end - p) / (3 * sizeof(uint32_t)) < num_layers) {
+        zend_value_error("DenseModel: model file is truncated");
+        return;
+    }
+
+    array_init_size(return_value, num_layers);
+
+    for (uint32_t i = 0; i < num_layers; i++) {
+        uint32_t in, out, act;
+
+        if (end - p < (ptrdiff_t) (3 * sizeof(uint32_t))) {
+            goto truncated;
+        }
+        memcpy(&in, p, sizeof(in));   p += sizeof(in);
+        memcpy(&out, p, sizeof(out)); p += sizeof(out);
+        memcpy(&act, p, sizeof(act)); p += sizeof(act);
+
+        size_t avail = (size_t) (end - p) / sizeof(float);
+
+        if (out > avail || (out > 0 && in > (avail - out) / out)) {
+            goto truncated;
+        }
+
+        size_t w_bytes = sizeof(float) * (size_t) in * out;
+        size_t b_bytes = sizeof(float) * (size_t) out;
+
+        if ((size_t) (end - p) < w_bytes + b_bytes) {
+            goto truncated;
+        }
+
+        zval layer;
+        array_init_size(&layer, 5);
+        add_assoc_long(&layer, "inputs", (zend_long) in);
+        add_assoc_long(&layer, "outputs", (zend_long) out);
+        add_assoc_long(&layer, "activation", (zend_long) act);
+        add_assoc_stringl(&layer, "weights", p, w_bytes); p += w_bytes;
+        add_assoc_stringl(&layer, "bias", p, b_bytes);    p += b_bytes;
+        add_next_index_zval(return_value, &layer);
+    }
+
+    return;
+
+truncated:
+    zval_ptr_dtor(return_value);
+    ZVAL_NULL(return_value);
+    zend_value_error("DenseModel: model file is truncated");
+}
@@ -0,0 +1,263 @@
+#include "../lapack_bridge.h"
+#include "../linalg_internal.h"
+#include "../linalg_small.h"
+#include "../scratch.h"
+
+#ifdef USE_SYSTEM_LAPACK
+    #include <cblas.h>
+#else
+    #error "System OpenBLAS required"
+#endif
+
+#include <math.h>
+
+/*
+ * Fused chains of linear algebra calls.
+ *
+ * The optimizers emit these when Zephir code nests the corresponding calls,
+ * e.g. linear_algebra_dot(linear_algebra_vector_normalize(a, 1), ...).
+ * PHP arrays are read once and written once; every intermediate stays in a
+ * float buffer. Validation and error messages follow the unfused calls.
+ */
+
+/* Norm of v for a normalize() method; -1 on invalid method */
+static float fused_norm(const float *v, int n, int method)
+{
+    switch (method) {
+        case LA_NORM_L1:
+            return cblas_sasum(n, v, 1);
+
+        case LA_NORM_L2:
+            return cblas_snrm2(n, v, 1);
+
+        case LA_NORM_LINF:
+            return fabsf(v[cblas_isamax(n, v, 1)]);
+    }
+
+    return -1.0f;
+}
+
+/* ---------- dot(normalize(a), normalize(b)) ---------- */
+
+/*
+ * method_a / method_b select the normalization of each operand;
+ * LA_FUSED_RAW leaves the operand as is.
+ */
+double linear_algebra_dot_normalized_zval(zval *a, int method_a, zval *b, int method_b)
+{
+    zval *operands[2] = { a, b };
+    int methods[2] = { method_a, method_b };
+    float *values[2] = { NULL, NULL };
+    float norms[2] = { 1.0f, 1.0f };
+    int sizes[2] = { 0, 0 };
+    double result = 0.0;
+    cm_scratch_pos mark = cm_scratch_mark();
+
+    /* Checked in the order the unfused calls run: normalize(a), normalize(b), then dot() */
+    for (int i = 0; i < 2; i++) {
+        if (methods[i] == LA_FUSED_RAW) {
+            continue;
+        }
+        if (Z_TYPE_P(operands[i]) != IS_ARRAY) {
+            zend_type_error("normalize(x, method) expects an array");
+            goto done;
+        }
+
+        sizes[i] = (int) zend_hash_num_elements(Z_ARRVAL_P(operands[i]));
+        if (sizes[i] == 0) {
+            zend_value_error("normalize(): vector must not be empty");
+            goto done;
+        }
+
+        values[i] = cm_scratch_alloc(sizeof(float) * sizes[i]);
+        fill_float_array_from_php_array(operands[i], values[i], sizes[i]);
+
+        norms[i] = fused_norm(values[i], sizes[i], methods[i]);
+        if (norms[i] < 0.0f) {
+            zend_value_error("normalize(): invalid method (0=L1, 1=L2, 2=L∞)");
+            goto done;
+        }
+        if (norms[i] == 0.0f) {
+            zend_value_error("normalize(): cannot normalize zero-norm vector");
+            goto done;
+        }
+    }
+
+    if (Z_TYPE_P(a) != IS_ARRAY || Z_TYPE_P(b) != IS_ARRAY) {
+        zend_type_error("dot(a, b) expects two arrays");
+        goto done;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        if (!values[i]) {
+            sizes[i] = (int) zend_hash_num_elements(Z_ARRVAL_P(operands[i]));
+            values[i] = cm_scratch_alloc(sizeof(float) * (sizes[i] > 0 ? sizes[i] : 1));
+            fill_float_array_from_php_array(operands[i], values[i], sizes[i]);
+        }
+    }
+
+    int n = sizes[0];
+
+    if (n == 0 || n != sizes[1]) {
+        zend_value_error("Vectors must be non-empty and same length");
+        goto done;
+    }
+
+    float dot = n <= LA_SMALL_DOT_MAX ? la_small_sdot(values[0], values[1], n) : cblas_sdot(n, values[0], 1, values[1], 1);
+    result = (double) dot / ((double) norms[0] * (double) norms[1]);
+
+done:
+    cm_scratch_release(mark);
+
+    return result;
+}
+
+/* ---------- hadamard(addScalar(scale(a, s), t), b) ---------- */
+
+void linear_algebra_affine_hadamard_zval(
+    zval *a,
+    double scale,
+    double shift,
+    zval *b,
+    int rows,
+    int cols,
+    const char *fn,
+    int b_index,
+    zval *return_value
+) {
+    /* Checked in the order the unfused calls run: fn(a) for the innermost
+     * call of the chain, then matrixHadamard() with b at position b_index */
+    if (Z_TYPE_P(a) != IS_ARRAY) {
+        zend_type_error("%s(a, scalar) expects an array", fn);
+        return;
+    }
+
+    int size = rows * cols;
+    int a_size = zend_hash_num_elements(Z_ARRVAL_P(a));
+
+    if (a_size != size) {
+        zend_value_error("%s(): matrix size mismatch (expected %d, got %d)", fn, size, a_size);
+        return;
+    }
+
+    if (size == 0) {
+        zend_value_error("%s(): matrix must not be empty", fn);
+        return;
+    }
+
+    if (Z_TYPE_P(b) != IS_ARRAY) {
+        zend_type_error("matrixHadamard(a, b) expects two arrays");
+        return;
+    }
+
+    int b_size = zend_hash_num_elements(Z_ARRVAL_P(b));
+
+    if (b_size != size) {
+        zend_value_error("matrixHadamard(): matrix %c size mismatch (expected %d, got %d)", b_index ? 'B' : 'A', size, b_size);
+        return;
+    }
+
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *fa = cm_scratch_alloc(sizeof(float) * size);
+    float *fb = cm_scratch_alloc(sizeof(float) * size);
+    float s = (float) scale;
+    float t = (float) shift;
+
+    fill_float_array_from_php_array(a, fa, size);
+    fill_float_array_from_php_array(b, fb, size);
+
+    for (int i = 0; i < size; i++) {
+        fa[i] = (s * fa[i] + t) * fb[i];
+    }
+
+    array_init_size(return_value, size);
+    for (int i = 0; i < size; i++) {
+        add_next_index_double(return_value, (double) fa[i]);
+    }
+
+    cm_scratch_release(mark);
+}
+
+/* ---------- addScalar(matmul(a, b), t) ---------- */
+
+void linear_algebra_matmul_add_scalar_zval(
+    zval *a,
+    zval *b,
+    int m,
+    int n,
+    int k,
+    zend_bool transpose_a,
+    zend_bool transpose_b,
+    double scalar,
+    int rows,
+    int cols,
+    zval *return_value
+) {
+    if (Z_TYPE_P(a) != IS_ARRAY || Z_TYPE_P(b) != IS_ARRAY) {
+        zend_type_error("matmul(a, b) expects two arrays");
+        return;
+    }
+
+    if (m <= 0 || n <= 0 || k <= 0) {
+        zend_value_error("matmul(): m, n and k must be > 0");
+        return;
+    }
+
+    int a_expected = transpose_a ? (n * m) : (m * n);
+    int b_expected = transpose_b ? (k * n) : (n * k);
+    int a_size = zend_hash_num_elements(Z_ARRVAL_P(a));
+    int b_size = zend_hash_num_elements(Z_ARRVAL_P(b));
+
+    if (a_size != a_expected) {
+        zend_value_error("matmul(): matrix A size mismatch (expected %d, got %d)", a_expected, a_size);
+        return;
+    }
+
+    if (b_size != b_expected) {
+        zend_value_error("matmul(): matrix B size mismatch (expected %d, got %d)", b_expected, b_size);
+        return;
+    }
+
+    if (rows * cols != m * k) {
+        zend_value_error("matrixAddScalar(): matrix size mismatch (expected %d, got %d)", rows * cols, m * k);
+        return;
+    }
+
+    if (m * k == 0) {
+        zend_value_error("matrixAddScalar(): matrix must not be empty");
+        return;
+    }
+
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *ma = cm_scratch_alloc(sizeof(float) * a_size);
+    float *mb = cm_scratch_alloc(sizeof(float) * b_size);
+    float *mc = cm_scratch_alloc(sizeof(float) * m * k);
+    float t = (float) scalar;
+
+    fill_float_array_from_php_array(a, ma, a_size);
+    fill_float_array_from_php_array(b, mb, b_size);
+
+    for (int i = 0; i < m * k; i++) {
+        mc[i] = t;
+    }
+
+    /* Row-major so C can be written back directly; beta = 1 adds the scalar */
+    cblas_sgemm(
+        CblasRowMajor,
+        transpose_a ? CblasTrans : CblasNoTrans,
+        transpose_b ? CblasTrans : CblasNoTrans,
+        m, k, n,
+        1.0f,
+        ma, transpose_a ? m : n,
+        mb, transpose_b ? n : k,
+        1.0f,
+        mc, k
+    );
+
+    array_init_size(return_value, m * k);
+    for (int i = 0; i < m * k; i++) {
+        add_next_index_double(return_value, (double) mc[i]);
+    }
+
+    cm_scratch_release(mark);
+}
@@ -0,0 +1,577 @@
+#include "../lapack_bridge.h"
+#include "../linalg_internal.h"
+
+#ifdef USE_SYSTEM_LAPACK
+    #include <cblas.h>
+#else
+    #error "System OpenBLAS required"
+#endif
+
+#include <math.h>
+#include <string.h>
+#include <float.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/*
+ * k-means over a row-major n × d float buffer.
+ *
+ * Distances use ‖x‖² − 2·x·c + ‖c‖², so the expensive part of every
+ * assignment step is one cblas_sgemm per block of rows. Centroid sums are
+ * accumulated in parallel: each worker owns a private k × d accumulator for
+ * a slice of rows and the partial sums are reduced afterwards.
+ *
+ * la_kmeans_fit() works on plain buffers so native code (e.g. codebook
+ * training for vector quantization) can reuse it without PHP arrays.
+ */
+
+#define LA_KMEANS_BLOCK       4096    /* rows per GEMM block */
+#define LA_KMEANS_MAX_THREADS 16
+#define LA_KMEANS_MIN_WORK    65536   /* rows × dims below which we stay single-threaded */
+
+/* ---------- RNG (xorshift64*) ---------- */
+
+static uint64_t km_rand(uint64_t *state)
+{
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+static double km_uniform(uint64_t *state)
+{
+    return (double) (km_rand(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/* ---------- Helpers ---------- */
+
+static void row_norms(const float *x, int n, int d, float *out)
+{
+    for (int i = 0; i < n; i++) {
+        out[i] = cblas_sdot(d, x + (size_t) i * d, 1, x + (size_t) i * d, 1);
+    }
+}
+
+/*
+ * Assign every row to its nearest centroid.
+ * Returns the inertia (sum of squared distances); per-row distances go to dist.
+ */
+static double assign_labels(
+    const float *x, const float *x_norms, int n, int d,
+    const float *c, const float *c_norms, int k,
+    float *gram, int *labels, float *dist
+) {
+    double inertia = 0.0;
+
+    for (int start = 0; start < n; start += LA_KMEANS_BLOCK) {
+        int rows = (n - start < LA_KMEANS_BLOCK) ? (n - start) : LA_KMEANS_BLOCK;
+
+        /* G = X_block · Cᵀ  (rows × k) */
+        cblas_sgemm(
+            CblasRowMajor, CblasNoTrans, CblasTrans,
+            rows, k, d,
+            1.0f, x + (size_t) start * d, d,
+            c, d,
+            0.0f, gram, k
+        );
+
+        for (int i = 0; i < rows; i++) {
+            const float *g = gram + (size_t) i * k;
+            float best = FLT_MAX;
+            int best_j = 0;
+
+            for (int j = 0; j < k; j++) {
+                float dj = c_norms[j] - 2.0f * g[j];
+                if (dj < best) {
+                    best = dj;
+                    best_j = j;
+                }
+            }
+
+            best += x_norms[start + i];
+            if (best < 0.0f) best = 0.0f; /* rounding */
+
+            labels[start + i] = best_j;
+            if (dist) dist[start + i] = best;
+            inertia += best;
+        }
+    }
+
+    return inertia;
+}
+
+/* ---------- k-means++ ---------- */
+
+static void init_plus_plus(
+    const float *x, const float *x_norms, int n, int d, int k,
+    uint64_t *rng, float *c, float *min_dist, float *scratch
+) {
+    int first = (int) (km_rand(rng) % (uint64_t) n);
+    memcpy(c, x + (size_t) first * d, sizeof(float) * d);
+
+    /* D(x)² to the first centroid via one GEMV */
+    float cn = cblas_sdot(d, c, 1, c, 1);
+    cblas_sgemv(CblasRowMajor, CblasNoTrans, n, d, 1.0f, x, d, c, 1, 0.0f, scratch, 1);
+    for (int i = 0; i < n; i++) {
+        float v = x_norms[i] - 2.0f * scratch[i] + cn;
+        min_dist[i] = v > 0.0f ? v : 0.0f;
+    }
+
+    for (int j = 1; j < k; j++) {
+        double total = 0.0;
+        for (int i = 0; i < n; i++) total += min_dist[i];
+
+        int pick = n - 1;
+        if (total > 0.0) {
+            double r = km_uniform(rng) * total;
+            double acc = 0.0;
+            for (int i = 0; i < n; i++) {
+                acc += min_dist[i];
+                if (acc >= r) {
+                    pick = i;
+                    break;
+                }
+            }
+        } else {
+            pick = (int) (km_rand(rng) % (uint64_t) n);
+        }
+
+        float *cj = c + (size_t) j * d;
+        memcpy(cj, x + (size_t) pick * d, sizeof(float) * d);
+
+        cn = cblas_sdot(d, cj, 1, cj, 1);
+        cblas_sgemv(CblasRowMajor, CblasNoTrans, n, d, 1.0f, x, d, cj, 1, 0.0f, scratch, 1);
+        for (int i = 0; i < n; i++) {
+            float v = x_norms[i] - 2.0f * scratch[i] + cn;
+            if (v < min_dist[i]) min_dist[i] = v > 0.0f ? v : 0.0f;
+        }
+    }
+}
+
+/* ---------- Parallel centroid accumulation ---------- */
+
+typedef struct {
+    const float *x;
+    const int *labels;
+    int d;
+    int k;
+    int start;
+    int end;
+    double *sums;   /* k × d, owned by the worker */
+    int *counts;    /* k, owned by the worker */
+} km_accum_job;
+
+static void *accumulate_worker(void *arg)
+{
+    km_accum_job *job = (km_accum_job *) arg;
+    int d = job->d;
+
+    memset(job->sums, 0, sizeof(double) * job->k * d);
+    memset(job->counts, 0, sizeof(int) * job->k);
+
+    for (int i = job->start; i < job->end; i++) {
+        int l = job->labels[i];
+        const float *xi = job->x + (size_t) i * d;
+        double *s = job->sums + (size_t) l * d;
+        for (int t = 0; t < d; t++) {
+            s[t] += xi[t];
+        }
+        job->counts[l]++;
+    }
+
+    return NULL;
+}
+
+static int resolve_threads(int threads, int n, int d)
+{
+    if ((size_t) n * d < LA_KMEANS_MIN_WORK) {
+        return 1;
+    }
+    if (threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (int) cpus : 1;
+    }
+    if (threads > LA_KMEANS_MAX_THREADS) threads = LA_KMEANS_MAX_THREADS;
+    if (threads > n) threads = n;
+    return threads;
+}
+
+/* New centroids from labels; returns the summed squared centroid shift. Zeroes dist[] of re-seeded points */
+static double update_centroids(
+    const float *x, const int *labels, int n, int d, int k, int threads,
+    float *dist, float *c, double *sums, int *counts
+) {
+    km_accum_job jobs[LA_KMEANS_MAX_THREADS];
+    pthread_t tids[LA_KMEANS_MAX_THREADS];
+    int spawned[LA_KMEANS_MAX_THREADS];
+    int chunk = (n + threads - 1) / threads;
+
+    for (int t = 0; t < threads; t++) {
+        jobs[t].x = x;
+        jobs[t].labels = labels;
+        jobs[t].d = d;
+        jobs[t].k = k;
+        jobs[t].start = t * chunk;
+        jobs[t].end = (t + 1) * chunk < n ? (t + 1) * chunk : n;
+        jobs[t].sums = sums + (size_t) t * k * d;
+        jobs[t].counts = counts + (size_t) t * k;
+        spawned[t] = 0;
+    }
+
+    for (int t = 1; t < threads; t++) {
+        spawned[t] = pthread_create(&tids[t], NULL, accumulate_worker, &jobs[t]) == 0;
+        if (!spawned[t]) {
+            accumulate_worker(&jobs[t]);
+        }
+    }
+    accumulate_worker(&jobs[0]);
+    for (int t = 1; t < threads; t++) {
+        if (spawned[t]) pthread_join(tids[t], NULL);
+    }
+
+    /* Reduce the per-worker partial sums into slot 0 */
+    for (int t = 1; t < threads; t++) {
+        for (size_t i = 0; i < (size_t) k * d; i++) sums[i] += jobs[t].sums[i];
+        for (int j = 0; j < k; j++) counts[j] += jobs[t].counts[j];
+    }
+
+    double shift = 0.0;
+
+    for (int j = 0; j < k; j++) {
+        float *cj = c + (size_t) j * d;
+
+        if (counts[j] == 0) {
+            /* Empty cluster: re-seed with the point farthest from its centroid */
+            int far = 0;
+            for (int i = 1; i < n; i++) {
+                if (dist[i] > dist[far]) far = i;
+            }
+            for (int t = 0; t < d; t++) {
+                float v = x[(size_t) far * d + t];
+                shift += (double) (v - cj[t]) * (v - cj[t]);
+                cj[t] = v;
+            }
+            /* Avoid picking the same point twice */
+            dist[far] = 0.0f;
+            continue;
+        }
+
+        double inv = 1.0 / counts[j];
+        for (int t = 0; t < d; t++) {
+            float v = (float) (sums[(size_t) j * d + t] * inv);
+            shift += (double) (v - cj[t]) * (v - cj[t]);
+            cj[t] = v;
+        }
+    }
+
+    return shift;
+}
+
+/* ---------- Mini-batch (Sculley 2010) ---------- */
+
+static int minibatch_iterations(
+    const float *x, const float *x_norms, int n, int d, int k,
+    const la_kmeans_options *opts, uint64_t *rng, float *c, float *c_norms
+) {
+    int b = opts->batch_size < n ? opts->batch_size : n;
+    float *bx = emalloc(sizeof(float) * b * d);
+    float *bn = emalloc(sizeof(float) * b);
+    float *gram = emalloc(sizeof(float) * (size_t) (b < LA_KMEANS_BLOCK ? b : LA_KMEANS_BLOCK) * k);
+    int *bl = emalloc(sizeof(int) * b);
+    double *seen = ecalloc(k, sizeof(double));
+    int iter;
+
+    for (iter = 0; iter < opts->max_iter; iter++) {
+        for (int i = 0; i < b; i++) {
+            int r = (int) (km_rand(rng) % (uint64_t) n);
+            memcpy(bx + (size_t) i * d, x + (size_t) r * d, sizeof(float) * d);
+            bn[i] = x_norms[r];
+        }
+
+        row_norms(c, k, d, c_norms);
+        assign_labels(bx, bn, b, d, c, c_norms, k, gram, bl, NULL);
+
+        double shift = 0.0;
+        for (int i = 0; i < b; i++) {
+            int l = bl[i];
+            float *cl = c + (size_t) l * d;
+            const float *xi = bx + (size_t) i * d;
+            float eta = (float) (1.0 / ++seen[l]);
+            for (int t = 0; t < d; t++) {
+                float delta = eta * (xi[t] - cl[t]);
+                cl[t] += delta;
+                shift += (double) delta * delta;
+            }
+        }
+
+        if (shift <= opts->tol) {
+            iter++;
+            break;
+        }
+    }
+
+    efree(bx);
+    efree(bn);
+    efree(gram);
+    efree(bl);
+    efree(seen);
+
+    return iter;
+}
+
+/* ---------- Driver ---------- */
+
+/* sklearn-style tolerance: relative to the mean per-feature variance */
+static double scaled_tolerance(const float *x, int n, int d, double tol)
+{
+    double total = 0.0;
+
+    for (int t = 0; t < d; t++) {
+        double mean = 0.0, sq = 0.0;
+        for (int i = 0; i < n; i++) {
+            double v = x[(size_t) i * d + t];
+            mean += v;
+            sq += v * v;
+        }
+        mean /= n;
+        total += sq / n - mean * mean;
+    }
+
+    return tol * (total / d);
+}
+
+int la_kmeans_fit(
+    const float *x, int n, int d,
+    const la_kmeans_options *opts,
+    float *centroids, int *labels, double *inertia_out
+) {
+    int k = opts->k;
+    uint64_t rng = opts->seed ? (uint64_t) opts->seed : 0x9E3779B97F4A7C15ULL;
+    int block = n < LA_KMEANS_BLOCK ? n : LA_KMEANS_BLOCK;
+    double tol = scaled_tolerance(x, n, d, opts->tol);
+    int iter = 0;
+
+    la_kmeans_options local = *opts;
+    local.tol = tol;
+
+    float *x_norms = emalloc(sizeof(float) * n);
+    float *c_norms = emalloc(sizeof(float) * k);
+    float *dist = emalloc(sizeof(float) * n);
+    float *gram = emalloc(sizeof(float) * (size_t) block * k);
+
+    row_norms(x, n, d, x_norms);
+
+    float *scratch = emalloc(sizeof(float) * n);
+    init_plus_plus(x, x_norms, n, d, k, &rng, centroids, dist, scratch);
+    efree(scratch);
+
+    if (opts->batch_size > 0) {
+        iter = minibatch_iterations(x, x_norms, n, d, k, &local, &rng, centroids, c_norms);
+    } else {
+        int threads = resolve_threads(opts->threads, n, d);
+        double *sums = emalloc(sizeof(double) * threads * k * d);
+        int *counts = emalloc(sizeof(int) * threads * k);
+
+        while (iter < opts->max_iter) {
+            row_norms(centroids, k, d, c_norms);
+            assign_labels(x, x_norms, n, d, centroids, c_norms, k, gram, labels, dist);
+            iter++;
+
+            if (update_centroids(x, labels, n, d, k, threads, dist, centroids, sums, counts) <= tol) {
+                break;
+            }
+        }
+
+        efree(sums);
+        efree(counts);
+    }
+
+    /* Final labels and inertia against the returned centroids */
+    row_norms(centroids, k, d, c_norms);
+    *inertia_out = assign_labels(x, x_norms, n, d, centroids, c_norms, k, gram, labels, NULL);
+
+    efree(x_norms);
+    efree(c_norms);
+    efree(dist);
+    efree(gram);
+
+    return iter;
+}
+
+void la_kmeans_assign(
+    const float *x, int n, int d,
+    const float *centroids, int k,
+    int *labels, float *dist
+) {
+    int block = n < LA_KMEANS_BLOCK ? n : LA_KMEANS_BLOCK;
+    float *x_norms = emalloc(sizeof(float) * n);
+    float *c_norms = emalloc(sizeof(float) * k);
+    float *gram = emalloc(sizeof(float) * (size_t) block * k);
+
+    row_norms(x, n, d, x_norms);
+    row_norms(centroids, k, d, c_norms);
+    assign_labels(x, x_norms, n, d, centroids, c_norms, k, gram, labels, dist);
+
+    efree(x_norms);
+    efree(c_norms);
+    efree(gram);
+}
+
+/* ---------- K-MEANS ---------- */
+
+void linear_algebra_kmeans_zval(
+    zval *x,
+    int rows,
+    int cols,
+    int k,
+    int max_iter,
+    double tol,
+    int batch_size,
+    zend_long seed,
+    int threads,
+    zval *return_value
+) {
+    if (Z_TYPE_P(x) != IS_ARRAY) {
+        zend_type_error("kmeans(x, rows, cols, k) expects an array");
+        return;
+    }
+
+    if (rows <= 0 || cols <= 0) {
+        zend_value_error("kmeans(): rows and cols must be > 0");
+        return;
+    }
+
+    if (k <= 0 || k > rows) {
+        zend_value_error("kmeans(): k must be between 1 and the number of rows (%d)", rows);
+        return;
+    }
+
+    if (max_iter <= 0) {
+        zend_value_error("kmeans(): max_iter must be > 0");
+        return;
+    }
+
+    if (tol < 0.0 || batch_size < 0) {
+        zend_value_error("kmeans(): tolerance and batch_size must be >= 0");
+        return;
+    }
+
+    int size = rows * cols;
+    int x_size = zend_hash_num_elements(Z_ARRVAL_P(x));
+
+    if (x_size != size) {
+        zend_value_error("kmeans(): matrix size mismatch (expected %d, got %d)", size, x_size);
+        return;
+    }
+
+    la_kmeans_options opts = {
+        .k = k,
+        .max_iter = max_iter,
+        .tol = tol,
+        .batch_size = batch_size,
+        .seed = seed,
+        .threads = threads
+    };
+
+    float *fx = emalloc(sizeof(float) * size);
+    float *c = emalloc(sizeof(float) * k * cols);
+    int *labels = emalloc(sizeof(int) * rows);
+    double inertia = 0.0;
+
+    fill_float_array_from_php_array(x, fx, size);
+
+    int iterations = la_kmeans_fit(fx, rows, cols, &opts, c, labels, &inertia);
+
+    zval zc, zl;
+
+    array_init_size(&zc, k * cols);
+    for (int i = 0; i < k * cols; i++) {
+        add_next_index_double(&zc, (double) c[i]);
+    }
+
+    array_init_size(&zl, rows);
+    for (int i = 0; i < rows; i++) {
+        add_next_index_long(&zl, (zend_long) labels[i]);
+    }
+
+    array_init_size(return_value, 4);
+    add_assoc_zval(return_value, "centroids", &zc);
+    add_assoc_zval(return_value, "labels", &zl);
+    add_assoc_double(return_value, "inertia", inertia);
+    add_assoc_long(return_value, "iterations", (zend_long) iterations);
+
+    efree(fx);
+    efree(c);
+    efree(labels);
+}
+
+void linear_algebra_kmeans_assign_zval(
+    zval *x,
+    int rows,
+    int cols,
+    zval *centroids,
+    int k,
+    zval *return_value
+) {
+    if (Z_TYPE_P(x) != IS_ARRAY) {
+        zend_type_error("kmeansAssign(x, rows, cols, centroids, k) expects an array");
+        return;
+    }
+
+    if (Z_TYPE_P(centroids) != IS_ARRAY && Z_TYPE_P(centroids) != IS_STRING) {
+        zend_type_error("kmeansAssign(): centroids must be an array or a packed string");
+        return;
+    }
+
+    if (rows <= 0 || cols <= 0 || k <= 0) {
+        zend_value_error("kmeansAssign(): rows, cols and k must be > 0");
+        return;
+    }
+
+    int size = rows * cols;
+    int x_size = zend_hash_num_elements(Z_ARRVAL_P(x));
+
+    if (x_size != size) {
+        zend_value_error("kmeansAssign(): matrix size mismatch (expected %d, got %d)", size, x_size);
+        return;
+    }
+
+    size_t c_size = Z_TYPE_P(centroids) == IS_STRING
+        ? Z_STRLEN_P(centroids) / sizeof(float)
+        : zend_hash_num_elements(Z_ARRVAL_P(centroids));
+
+    if (c_size != (size_t) k * cols
+        || (Z_TYPE_P(centroids) == IS_STRING && Z_STRLEN_P(centroids) % sizeof(float) != 0)) {
+        zend_value_error("kmeansAssign(): centroids size mismatch (expected %d)", k * cols);
+        return;
+    }
+
+    float *fx = emalloc(sizeof(float) * size);
+    float *fc = NULL;
+    const float *c;
+    int *labels = emalloc(sizeof(int) * rows);
+
+    fill_float_array_from_php_array(x, fx, size);
+
+    if (Z_TYPE_P(centroids) == IS_STRING) {
+        c = (const float *) Z_STRVAL_P(centroids);
+    } else {
+        fc = emalloc(sizeof(float) * k * cols);
+        fill_float_array_from_php_array(centroids, fc, k * cols);
+        c = fc;
+    }
+
+    la_kmeans_assign(fx, rows, cols, c, k, labels, NULL);
+
+    array_init_size(return_value, rows);
+    for (int i = 0; i < rows; i++) {
+        add_next_index_long(return_value, (zend_long) labels[i]);
+    }
+
+    efree(fx);
+    if (fc) efree(fc);
+    efree(labels);
+}
@@ -0,0 +1,481 @@
+#include "../lapack_bridge.h"
+#include "../linalg_internal.h"
+
+#include <math.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/*
+ * Linear classifiers over sparse rows.
+ *
+ * Every document is a PHP array of feature => weight (term => tf-idf, or
+ * column id => value). Training maps feature keys to columns once, builds a
+ * CSR matrix and runs SGD or AdaGrad over it; with several threads the
+ * shuffled samples are split between workers that update the shared weights
+ * without locks (Hogwild). L2 regularization is applied to the coordinates a
+ * sample touches, which keeps every update sparse.
+ *
+ * Weights are stored as packed float32: outputs × (dims + 1), row-major, the
+ * bias being the last column. Binary problems use a single output whose
+ * positive side is class 1; otherwise there is one output per class
+ * (one-vs-rest).
+ */
+
+#define LA_LINEAR_MAX_THREADS 16
+#define LA_LINEAR_MIN_WORK    4096   /* non-zeros below which we stay single-threaded */
+#define LA_ADAGRAD_EPS        1e-8f
+
+typedef struct {
+    int n;
+    int dims;
+    int outputs;
+    int *row_ptr;
+    int *col;
+    float *val;
+    int *y;
+} la_sparse_set;
+
+typedef struct {
+    const la_sparse_set *set;
+    float *w;
+    float *g2;
+    const int *perm;
+    int start;
+    int end;
+    int loss;
+    int optimizer;
+    float eta0;
+    float lambda;
+    double t0;       /* samples seen in earlier epochs, for the SGD schedule */
+} la_linear_job;
+
+static uint64_t lin_rand(uint64_t *state)
+{
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+/* d loss / d z for label y in {-1, +1} */
+static inline float loss_gradient(int loss, float z, float y)
+{
+    float yz = y * z;
+
+    if (loss == LA_LOSS_HINGE) {
+        return yz < 1.0f ? -y : 0.0f;
+    }
+
+    /* logistic: -y · σ(−yz), evaluated without overflow */
+    if (yz > 0.0f) {
+        float e = expf(-yz);
+        return -y * e / (1.0f + e);
+    }
+    return -y / (1.0f + expf(yz));
+}
+
+static void *linear_worker(void *arg)
+{
+    la_linear_job *job = (la_linear_job *) arg;
+    const la_sparse_set *s = job->set;
+    int stride = s->dims + 1;
+
+    for (int p = job->start; p < job->end; p++) {
+        int i = job->perm[p];
+        int from = s->row_ptr[i];
+        int to = s->row_ptr[i + 1];
+
+        float lr = job->eta0;
+        if (job->optimizer == LA_OPT_SGD) {
+            /* Bottou's schedule: eta0 / (1 + eta0·lambda·t) */
+            lr = job->eta0 / (1.0f + job->eta0 * job->lambda * (float) (job->t0 + (p - job->start)));
+        }
+
+        for (int o = 0; o < s->outputs; o++) {
+            float *w = job->w + (size_t) o * stride;
+            float *g2 = job->g2 ? job->g2 + (size_t) o * stride : NULL;
+            float y;
+
+            if (s->outputs == 1) {
+                y = s->y[i] == 1 ? 1.0f : -1.0f;
+            } else {
+                y = s->y[i] == o ? 1.0f : -1.0f;
+            }
+
+            float z = w[s->dims];
+            for (int k = from; k < to; k++) {
+                z += w[s->col[k]] * s->val[k];
+            }
+
+            float g = loss_gradient(job->loss, z, y);
+
+            for (int k = from; k < to; k++) {
+                int j = s->col[k];
+                float gj = g * s->val[k] + job->lambda * w[j];
+                if (g2) {
+                    g2[j] += gj * gj;
+                    w[j] -= job->eta0 * gj / (sqrtf(g2[j]) + LA_ADAGRAD_EPS);
+                } else {
+                    w[j] -= lr * gj;
+                }
+            }
+
+            if (g != 0.0f) {
+                if (g2) {
+                    g2[s->dims] += g * g;
+                    w[s->dims] -= job->eta0 * g / (sqrtf(g2[s->dims]) + LA_ADAGRAD_EPS);
+                } else {
+                    w[s->dims] -= lr * g;
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static int linear_threads(int threads, int nnz, int n)
+{
+    if (nnz < LA_LINEAR_MIN_WORK) {
+        return 1;
+    }
+    if (threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (int) cpus : 1;
+    }
+    if (threads > LA_LINEAR_MAX_THREADS) threads = LA_LINEAR_MAX_THREADS;
+    if (threads > n) threads = n;
+    return threads;
+}
+
+/* Column of a feature key, or -1 when unknown */
+static zend_long feature_column(HashTable *features, zend_string *key, zend_ulong h)
+{
+    zval *col = key ? zend_hash_find(features, key) : zend_hash_index_find(features, h);
+
+    return col ? Z_LVAL_P(col) : -1;
+}
+
+/* ---------- TRAINING ---------- */
+
+void linear_algebra_linear_train_zval(
+    zval *docs,
+    zval *labels,
+    int loss,
+    int optimizer,
+    int epochs,
+    double eta0,
+    double lambda,
+    zend_long seed,
+    int threads,
+    zval *return_value
+) {
+    if (Z_TYPE_P(docs) != IS_ARRAY || Z_TYPE_P(labels) != IS_ARRAY) {
+        zend_type_error("linearTrain(docs, labels) expects arrays");
+        return;
+    }
+
+    if (loss != LA_LOSS_LOG && loss != LA_LOSS_HINGE) {
+        zend_value_error("linearTrain(): invalid loss");
+        return;
+    }
+
+    if (optimizer != LA_OPT_SGD && optimizer != LA_OPT_ADAGRAD) {
+        zend_value_error("linearTrain(): invalid optimizer");
+        return;
+    }
+
+    if (epochs <= 0 || eta0 <= 0.0 || lambda < 0.0) {
+        zend_value_error("linearTrain(): epochs and learning_rate must be > 0, lambda >= 0");
+        return;
+    }
+
+    HashTable *hd = Z_ARRVAL_P(docs);
+    HashTable *hl = Z_ARRVAL_P(labels);
+    int n = zend_hash_num_elements(hd);
+
+    if (n == 0) {
+        zend_value_error("linearTrain(): no documents");
+        return;
+    }
+
+    if ((int) zend_hash_num_elements(hl) != n) {
+        zend_value_error("linearTrain(): expected %d labels, got %d", n, (int) zend_hash_num_elements(hl));
+        return;
+    }
+
+    /* Class index per sample, in order of first appearance */
+    zval classes, class_map, features;
+    int *y = emalloc(sizeof(int) * n);
+    int i = 0;
+    zval *label;
+
+    array_init(&classes);
+    array_init(&class_map);
+
+    ZEND_HASH_FOREACH_VAL(hl, label) {
+        zval *found = NULL;
+        zval idx;
+
+        if (Z_TYPE_P(label) == IS_STRING) {
+            /* Numeric strings share the integer's class, as array keys do */
+            found = zend_symtable_find(Z_ARRVAL(class_map), Z_STR_P(label));
+        } else if (Z_TYPE_P(label) == IS_LONG) {
+            found = zend_hash_index_find(Z_ARRVAL(class_map), Z_LVAL_P(label));
+        } else {
+            zend_type_error("linearTrain(): labels must be int or string");
+            zval_ptr_dtor(&classes);
+            zval_ptr_dtor(&class_map);
+            efree(y);
+            return;
+        }
+
+        if (!found) {
+            ZVAL_LONG(&idx, zend_hash_num_elements(Z_ARRVAL(classes)));
+            if (Z_TYPE_P(label) == IS_STRING) {
+                found = zend_symtable_update(Z_ARRVAL(class_map), Z_STR_P(label), &idx);
+            } else {
+                found = zend_hash_index_update(Z_ARRVAL(class_map), Z_LVAL_P(label), &idx);
+            }
+            Z_TRY_ADDREF_P(label);
+            add_next_index_zval(&classes, label);
+        }
+
+        y[i++] = (int) Z_LVAL_P(found);
+    } ZEND_HASH_FOREACH_END();
+
+    zval_ptr_dtor(&class_map);
+
+    int n_classes = zend_hash_num_elements(Z_ARRVAL(classes));
+
+    if (n_classes < 2) {
+        zend_value_error("linearTrain(): at least two classes are required");
+        zval_ptr_dtor(&classes);
+        efree(y);
+        return;
+    }
+
+    /* Feature index and CSR rows */
+    la_sparse_set s;
+    int nnz = 0;
+    zval *doc;
+
+    ZEND_HASH_FOREACH_VAL(hd, doc) {
+        if (Z_TYPE_P(doc) != IS_ARRAY) {
+            zend_type_error("linearTrain(): every document must be an array of feature => weight");
+            zval_ptr_dtor(&classes);
+            efree(y);
+            return;
+        }
+        nnz += zend_hash_num_elements(Z_ARRVAL_P(doc));
+    } ZEND_HASH_FOREACH_END();
+
+    s.n = n;
+    s.outputs = n_classes == 2 ? 1 : n_classes;
+    s.y = y;
+    s.row_ptr = emalloc(sizeof(int) * (n + 1));
+    s.col = emalloc(sizeof(int) * (nnz > 0 ? nnz : 1));
+    s.val = emalloc(sizeof(float) * (nnz > 0 ? nnz : 1));
+
+    array_init(&features);
+
+    int k = 0;
+    i = 0;
+
+    ZEND_HASH_FOREACH_VAL(hd, doc) {
+        zend_string *key;
+        zend_ulong h;
+        zval *v;
+
+        s.row_ptr[i++] = k;
+
+        ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(doc), h, key, v) {
+            zend_long col = feature_column(Z_ARRVAL(features), key, h);
+
+            if (col < 0) {
+                zval zcol;
+                col = zend_hash_num_elements(Z_ARRVAL(features));
+                ZVAL_LONG(&zcol, col);
+                if (key) {
+                    zend_hash_update(Z_ARRVAL(features), key, &zcol);
+                } else {
+                    zend_hash_index_update(Z_ARRVAL(features), h, &zcol);
+                }
+            }
+
+            s.col[k] = (int) col;
+            s.val[k] = (float) zval_get_double(v);
+            k++;
+        } ZEND_HASH_FOREACH_END();
+    } ZEND_HASH_FOREACH_END();
+
+    s.row_ptr[n] = k;
+    s.dims = zend_hash_num_elements(Z_ARRVAL(features));
+
+    /* Shared weights (and AdaGrad accumulators) */
+    size_t w_size = (size_t) s.outputs * (s.dims + 1);
+    zend_string *packed = zend_string_alloc(sizeof(float) * w_size, 0);
+    float *w = (float *) ZSTR_VAL(packed);
+    float *g2 = optimizer == LA_OPT_ADAGRAD ? ecalloc(w_size, sizeof(float)) : NULL;
+    int *perm = emalloc(sizeof(int) * n);
+    uint64_t rng = seed ? (uint64_t) seed : 0x9E3779B97F4A7C15ULL;
+
+    memset(w, 0, sizeof(float) * w_size);
+    ZSTR_VAL(packed)[ZSTR_LEN(packed)] = '\0';
+
+    for (i = 0; i < n; i++) perm[i] = i;
+
+    int workers = linear_threads(threads, nnz, n);
+    la_linear_job jobs[LA_LINEAR_MAX_THREADS];
+    pthread_t tids[LA_LINEAR_MAX_THREADS];
+    int spawned[LA_LINEAR_MAX_THREADS];
+    int chunk = (n + workers - 1) / workers;
+
+    for (int e = 0; e < epochs; e++) {
+        /* Fisher–Yates shuffle */
+        for (i = n - 1; i > 0; i--) {
+            int j = (int) (lin_rand(&rng) % (uint64_t) (i + 1));
+            int tmp = perm[i];
+            perm[i] = perm[j];
+            perm[j] = tmp;
+        }
+
+        for (int t = 0; t < workers; t++) {
+            jobs[t].set = &s;
+            jobs[t].w = w;
+            jobs[t].g2 = g2;
+            jobs[t].perm = perm;
+            jobs[t].start = t * chunk < n ? t * chunk : n;
+            jobs[t].end = (t + 1) * chunk < n ? (t + 1) * chunk : n;
+            jobs[t].loss = loss;
+            jobs[t].optimizer = optimizer;
+            jobs[t].eta0 = (float) eta0;
+            jobs[t].lambda = (float) lambda;
+            jobs[t].t0 = (double) e * n;
+            spawned[t] = 0;
+        }
+
+        for (int t = 1; t < workers; t++) {
+            spawned[t] = pthread_create(&tids[t], NULL, linear_worker, &jobs[t]) == 0;
+            if (!spawned[t]) {
+                linear_worker(&jobs[t]);
+            }
+        }
+        linear_worker(&jobs[0]);
+        for (int t = 1; t < workers; t++) {
+            if (spawned[t]) pthread_join(tids[t], NULL);
+        }
+    }
+
+    array_init_size(return_value, 6);
+    add_assoc_zval(return_value, "classes", &classes);
+    add_assoc_zval(return_value, "features", &features);
+    add_assoc_str(return_value, "weights", packed);
+    add_assoc_long(return_value, "dims", s.dims);
+    add_assoc_long(return_value, "outputs", s.outputs);
+    add_assoc_long(return_value, "loss", loss);
+
+    if (g2) efree(g2);
+    efree(perm);
+    efree(s.row_ptr);
+    efree(s.col);
+    efree(s.val);
+    efree(y);
+}
+
+/* ---------- PREDICTION ---------- */
+
+void linear_algebra_linear_predict_zval(
+    zval *features,
+    zval *weights,
+    int outputs,
+    zval *docs,
+    zend_bool scores,
+    zval *return_value
+) {
+    if (Z_TYPE_P(features) != IS_ARRAY || Z_TYPE_P(docs) != IS_ARRAY) {
+        zend_type_error("linearPredict(features, weights, outputs, docs) expects arrays");
+        return;
+    }
+
+    if (Z_TYPE_P(weights) != IS_STRING) {
+        zend_type_error("linearPredict(): weights must be a packed string");
+        return;
+    }
+
+    HashTable *hf = Z_ARRVAL_P(features);
+    int dims = zend_hash_num_elements(hf);
+
+    if (outputs <= 0 || Z_STRLEN_P(weights) != sizeof(float) * (size_t) outputs * (dims + 1)) {
+        zend_value_error("linearPredict(): weights do not match %d features × %d outputs", dims, outputs);
+        return;
+    }
+
+    /* A restored model's columns index the packed weights: all must be in range */
+    zval *col;
+    ZEND_HASH_FOREACH_VAL(hf, col) {
+        if (Z_TYPE_P(col) != IS_LONG || Z_LVAL_P(col) < 0 || Z_LVAL_P(col) >= dims) {
+            zend_value_error("linearPredict(): feature columns must be integers between 0 and %d", dims - 1);
+            return;
+        }
+    } ZEND_HASH_FOREACH_END();
+
+    const float *w = (const float *) Z_STRVAL_P(weights);
+    int stride = dims + 1;
+    float *z = emalloc(sizeof(float) * outputs);
+    zval *doc;
+
+    array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(docs)));
+
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(docs), doc) {
+        zend_string *key;
+        zend_ulong h;
+        zval *v;
+
+        if (Z_TYPE_P(doc) != IS_ARRAY) {
+            zend_type_error("linearPredict(): every document must be an array of feature => weight");
+            zval_ptr_dtor(return_value);
+            ZVAL_NULL(return_value);
+            efree(z);
+            return;
+        }
+
+        for (int o = 0; o < outputs; o++) {
+            z[o] = w[(size_t) o * stride + dims];
+        }
+
+        /* One pass over the document's non-zeros updates every class score */
+        ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(doc), h, key, v) {
+            zend_long col = feature_column(hf, key, h);
+            if (col < 0) {
+                continue;
+            }
+            float x = (float) zval_get_double(v);
+            for (int o = 0; o < outputs; o++) {
+                z[o] += w[(size_t) o * stride + col] * x;
+            }
+        } ZEND_HASH_FOREACH_END();
+
+        if (scores) {
+            zval row;
+            array_init_size(&row, outputs);
+            for (int o = 0; o < outputs; o++) {
+                add_next_index_double(&row, (double) z[o]);
+            }
+            add_next_index_zval(return_value, &row);
+        } else if (outputs == 1) {
+            add_next_index_long(return_value, z[0] > 0.0f ? 1 : 0);
+        } else {
+            int best = 0;
+            for (int o = 1; o < outputs; o++) {
+                if (z[o] > z[best]) best = o;
+            }
+            add_next_index_long(return_value, best);
+        }
+    } ZEND_HASH_FOREACH_END();
+
+    efree(z);
+}
@@ -1,5 +1,7 @@
 #include "../lapack_bridge.h"
 #include "../linalg_internal.h"
+#include "../linalg_small.h"
+#include "../scratch.h"
 
 #ifdef USE_SYSTEM_LAPACK
     #include <cblas.h>
@@ -48,6 +50,8 @@ void linear_algebra_svd_zval(
         return;
     }
 
+    cm_scratch_pos mark = cm_scratch_mark();
+
     /* Optional outputs */
     float *U  = NULL;
     float *VT = NULL;
@@ -55,31 +59,31 @@ void linear_algebra_svd_zval(
     if (jobz == LA_SVD_REDUCED) {
         ldu  = m;
         ldvt = k;
-        U  = emalloc(sizeof(float) * m * k);
-        VT = emalloc(sizeof(float) * k * n);
+        U  = cm_scratch_alloc(sizeof(float) * m * k);
+        VT = cm_scratch_alloc(sizeof(float) * k * n);
     }
     else if (jobz == LA_SVD_FULL) {
         ldu  = m;
         ldvt = n;
-        U  = emalloc(sizeof(float) * m * m);
-        VT = emalloc(sizeof(float) * n * n);
+        U  = cm_scratch_alloc(sizeof(float) * m * m);
+        VT = cm_scratch_alloc(sizeof(float) * n * n);
     }
     else { /* 'N' */
         ldu = ldvt = 1; /* not referenced by LAPACK when jobz='N' */
     }
 
     /* Matrix A (column-major) */
-    float *A = emalloc(sizeof(float) * m * n);
+    float *A = cm_scratch_alloc(sizeof(float) * m * n);
     fill_matrix_col_major(x, A, m, n);
 
     /* Singular values */
-    float *S = emalloc(sizeof(float) * k);
+    float *S = cm_scratch_alloc(sizeof(float) * k);
 
     /* Workspace query */
     float *work = NULL;
     int lwork = -1;
     float wkopt = 0.0f;
-    int *iwork = emalloc(sizeof(int) * (8 * k));
+    int *iwork = cm_scratch_alloc(sizeof(int) * (8 * k));
 
     sgesdd_(
         &jobz, &m, &n,
@@ -102,7 +106,7 @@ void linear_algebra_svd_zval(
         goto cleanup;
     }
 
-    work = emalloc(sizeof(float) * lwork);
+    work = cm_scratch_alloc(sizeof(float) * lwork);
 
     /* Compute */
     sgesdd_(
@@ -153,12 +157,7 @@ void linear_algebra_svd_zval(
     }
 
 cleanup:
-    if (A) efree(A);
-    if (S) efree(S);
-    if (iwork) efree(iwork);
-    if (U) efree(U);
-    if (VT) efree(VT);
-    if (work) efree(work);
+    cm_scratch_release(mark);
 }
 
 /* ---------- MATRIX MULTIPLICATION ---------- */
@@ -178,6 +177,11 @@ void linear_algebra_matmul_zval(
         return;
     }
 
+    if (m <= 0 || n <= 0 || k <= 0) {
+        zend_value_error("matmul(): m, n and k must be > 0");
+        return;
+    }
+
     HashTable *ha = Z_ARRVAL_P(a);
     HashTable *hb = Z_ARRVAL_P(b);
 
@@ -198,10 +202,29 @@ void linear_algebra_matmul_zval(
         return;
     }
 
+    // Small operands: stack buffers and a plain row-major kernel instead of BLAS
+    if (a_size <= LA_SMALL_MATMUL_MAX && b_size <= LA_SMALL_MATMUL_MAX && m * k <= LA_SMALL_MATMUL_MAX) {
+        float sa[LA_SMALL_MATMUL_MAX];
+        float sb[LA_SMALL_MATMUL_MAX];
+        float sc[LA_SMALL_MATMUL_MAX];
+
+        fill_float_array_from_php_array(a, sa, a_size);
+        fill_float_array_from_php_array(b, sb, b_size);
+
+        la_small_sgemm(sa, sb, sc, m, n, k, transpose_a, transpose_b);
+
+        array_init_size(return_value, m * k);
+        for (int i = 0; i < m * k; i++) {
+            add_next_index_double(return_value, (double) sc[i]);
+        }
+        return;
+    }
+
     // Allocate matrices
-    float *ma = emalloc(sizeof(float) * a_size);
-    float *mb = emalloc(sizeof(float) * b_size);
-    float *mc = emalloc(sizeof(float) * m * k);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *ma = cm_scratch_alloc(sizeof(float) * a_size);
+    float *mb = cm_scratch_alloc(sizeof(float) * b_size);
+    float *mc = cm_scratch_alloc(sizeof(float) * m * k);
 
     // Fill matrix A (convert from row-major to column-major for BLAS)
     fill_matrix_col_major(a, ma, transpose_a ? n : m, transpose_a ? m : n);
@@ -259,9 +282,7 @@ void linear_algebra_matmul_zval(
         }
     }
 
-    efree(ma);
-    efree(mb);
-    efree(mc);
+    cm_scratch_release(mark);
 }
 
 /* ---------- ELEMENT-WISE OPERATIONS ---------- */
@@ -300,8 +321,9 @@ void linear_algebra_matrix_add_zval(
         return;
     }
 
-    float *fa = emalloc(sizeof(float) * size);
-    float *fb = emalloc(sizeof(float) * size);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *fa = cm_scratch_alloc(sizeof(float) * size);
+    float *fb = cm_scratch_alloc(sizeof(float) * size);
 
     int i = 0;
     zval *val;
@@ -320,8 +342,7 @@ void linear_algebra_matrix_add_zval(
         add_next_index_double(return_value, (double)(fa[i] + fb[i]));
     }
 
-    efree(fa);
-    efree(fb);
+    cm_scratch_release(mark);
 }
 
 void linear_algebra_matrix_subtract_zval(
@@ -358,8 +379,9 @@ void linear_algebra_matrix_subtract_zval(
         return;
     }
 
-    float *fa = emalloc(sizeof(float) * size);
-    float *fb = emalloc(sizeof(float) * size);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *fa = cm_scratch_alloc(sizeof(float) * size);
+    float *fb = cm_scratch_alloc(sizeof(float) * size);
 
     int i = 0;
     zval *val;
@@ -378,8 +400,7 @@ void linear_algebra_matrix_subtract_zval(
         add_next_index_double(return_value, (double)(fa[i] - fb[i]));
     }
 
-    efree(fa);
-    efree(fb);
+    cm_scratch_release(mark);
 }
 
 void linear_algebra_matrix_hadamard_zval(
@@ -416,8 +437,9 @@ void linear_algebra_matrix_hadamard_zval(
         return;
     }
 
-    float *fa = emalloc(sizeof(float) * size);
-    float *fb = emalloc(sizeof(float) * size);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *fa = cm_scratch_alloc(sizeof(float) * size);
+    float *fb = cm_scratch_alloc(sizeof(float) * size);
 
     int i = 0;
     zval *val;
@@ -436,8 +458,7 @@ void linear_algebra_matrix_hadamard_zval(
         add_next_index_double(return_value, (double)(fa[i] * fb[i]));
     }
 
-    efree(fa);
-    efree(fb);
+    cm_scratch_release(mark);
 }
 
 void linear_algebra_matrix_divide_zval(
@@ -474,8 +495,9 @@ void linear_algebra_matrix_divide_zval(
         return;
     }
 
-    float *fa = emalloc(sizeof(float) * size);
-    float *fb = emalloc(sizeof(float) * size);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *fa = cm_scratch_alloc(sizeof(float) * size);
+    float *fb = cm_scratch_alloc(sizeof(float) * size);
 
     int i = 0;
     zval *val;
@@ -492,16 +514,14 @@ void linear_algebra_matrix_divide_zval(
     array_init_size(return_value, size);
     for (i = 0; i < size; i++) {
         if (fb[i] == 0.0f) {
-            efree(fa);
-            efree(fb);
+            cm_scratch_release(mark);
             zend_value_error("matrixDivide(): division by zero at element %d", i);
             return;
         }
         add_next_index_double(return_value, (double)(fa[i] / fb[i]));
     }
 
-    efree(fa);
-    efree(fb);
+    cm_scratch_release(mark);
 }
 
 /* ---------- SCALAR OPERATIONS ---------- */
@@ -532,7 +552,8 @@ void linear_algebra_matrix_scale_zval(
         return;
     }
 
-    float *fa = emalloc(sizeof(float) * size);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *fa = cm_scratch_alloc(sizeof(float) * size);
 
     int i = 0;
     zval *val;
@@ -547,7 +568,7 @@ void linear_algebra_matrix_scale_zval(
         add_next_index_double(return_value, (double)(fa[i] * scalar_f));
     }
 
-    efree(fa);
+    cm_scratch_release(mark);
 }
 
 void linear_algebra_matrix_add_scalar_zval(
@@ -576,7 +597,8 @@ void linear_algebra_matrix_add_scalar_zval(
         return;
     }
 
-    float *fa = emalloc(sizeof(float) * size);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *fa = cm_scratch_alloc(sizeof(float) * size);
 
     int i = 0;
     zval *val;
@@ -591,7 +613,7 @@ void linear_algebra_matrix_add_scalar_zval(
         add_next_index_double(return_value, (double)(fa[i] + scalar_f));
     }
 
-    efree(fa);
+    cm_scratch_release(mark);
 }
 
 void linear_algebra_matrix_multiply_scalar_zval(
@@ -620,7 +642,8 @@ void linear_algebra_matrix_multiply_scalar_zval(
         return;
     }
 
-    float *fa = emalloc(sizeof(float) * size);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *fa = cm_scratch_alloc(sizeof(float) * size);
 
     int i = 0;
     zval *val;
@@ -635,7 +658,7 @@ void linear_algebra_matrix_multiply_scalar_zval(
         add_next_index_double(return_value, (double)(fa[i] * scalar_f));
     }
 
-    efree(fa);
+    cm_scratch_release(mark);
 }
 
 void linear_algebra_matrix_divide_scalar_zval(
@@ -669,7 +692,8 @@ void linear_algebra_matrix_divide_scalar_zval(
         return;
     }
 
-    float *fa = emalloc(sizeof(float) * size);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *fa = cm_scratch_alloc(sizeof(float) * size);
 
     int i = 0;
     zval *val;
@@ -684,5 +708,5 @@ void linear_algebra_matrix_divide_scalar_zval(
         add_next_index_double(return_value, (double)(fa[i] / scalar_f));
     }
 
-    efree(fa);
+    cm_scratch_release(mark);
 }
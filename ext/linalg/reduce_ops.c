@@ -0,0 +1,227 @@
+#include "../lapack_bridge.h"
+#include "../linalg_internal.h"
+
+#ifdef USE_SYSTEM_LAPACK
+    #include <cblas.h>
+#else
+    #error "System OpenBLAS required"
+#endif
+
+#include <math.h>
+#include <string.h>
+
+/* ---------- Kernels ---------- */
+
+/*
+ * All kernels read a row-major rows × cols buffer. Per-column reductions walk
+ * the matrix row by row and update a cols-wide accumulator, so the inner loop
+ * is always contiguous and vectorizable.
+ */
+
+/* Sum / mean via GEMV against a ones vector */
+static void reduce_sum(const float *x, int rows, int cols, int axis, float *out)
+{
+    if (axis == LA_AXIS_ROWS) {
+        float *ones = emalloc(sizeof(float) * cols);
+        for (int j = 0; j < cols; j++) ones[j] = 1.0f;
+
+        cblas_sgemv(CblasRowMajor, CblasNoTrans, rows, cols,
+                    1.0f, x, cols, ones, 1, 0.0f, out, 1);
+        efree(ones);
+    } else {
+        float *ones = emalloc(sizeof(float) * rows);
+        for (int i = 0; i < rows; i++) ones[i] = 1.0f;
+
+        cblas_sgemv(CblasRowMajor, CblasTrans, rows, cols,
+                    1.0f, x, cols, ones, 1, 0.0f, out, 1);
+        efree(ones);
+    }
+}
+
+/* Population variance, two-pass (mean first) for numerical stability */
+static void reduce_variance(const float *x, int rows, int cols, int axis, float *out)
+{
+    if (axis == LA_AXIS_ROWS) {
+        reduce_sum(x, rows, cols, axis, out);
+        for (int i = 0; i < rows; i++) {
+            const float *row = x + (size_t) i * cols;
+            float mean = out[i] / (float) cols;
+            float acc = 0.0f;
+            for (int j = 0; j < cols; j++) {
+                float d = row[j] - mean;
+                acc += d * d;
+            }
+            out[i] = acc / (float) cols;
+        }
+    } else {
+        float *mean = emalloc(sizeof(float) * cols);
+        reduce_sum(x, rows, cols, axis, mean);
+        for (int j = 0; j < cols; j++) {
+            mean[j] /= (float) rows;
+            out[j] = 0.0f;
+        }
+        for (int i = 0; i < rows; i++) {
+            const float *row = x + (size_t) i * cols;
+            for (int j = 0; j < cols; j++) {
+                float d = row[j] - mean[j];
+                out[j] += d * d;
+            }
+        }
+        for (int j = 0; j < cols; j++) {
+            out[j] /= (float) rows;
+        }
+        efree(mean);
+    }
+}
+
+/* Min / max; when idx is non-NULL the winning position is recorded too */
+static void reduce_extreme(const float *x, int rows, int cols, int axis, int want_max, float *out, int *idx)
+{
+    if (axis == LA_AXIS_ROWS) {
+        for (int i = 0; i < rows; i++) {
+            const float *row = x + (size_t) i * cols;
+            float best = row[0];
+            int best_j = 0;
+            for (int j = 1; j < cols; j++) {
+                if (want_max ? (row[j] > best) : (row[j] < best)) {
+                    best = row[j];
+                    best_j = j;
+                }
+            }
+            out[i] = best;
+            if (idx) idx[i] = best_j;
+        }
+        return;
+    }
+
+    memcpy(out, x, sizeof(float) * cols);
+    if (idx) memset(idx, 0, sizeof(int) * cols);
+
+    for (int i = 1; i < rows; i++) {
+        const float *row = x + (size_t) i * cols;
+        if (idx) {
+            for (int j = 0; j < cols; j++) {
+                int better = want_max ? (row[j] > out[j]) : (row[j] < out[j]);
+                out[j] = better ? row[j] : out[j];
+                idx[j] = better ? i : idx[j];
+            }
+        } else if (want_max) {
+            for (int j = 0; j < cols; j++) {
+                out[j] = row[j] > out[j] ? row[j] : out[j];
+            }
+        } else {
+            for (int j = 0; j < cols; j++) {
+                out[j] = row[j] < out[j] ? row[j] : out[j];
+            }
+        }
+    }
+}
+
+/* ---------- MATRIX REDUCTIONS ---------- */
+
+void linear_algebra_matrix_reduce_zval(
+    zval *a,
+    int rows,
+    int cols,
+    int op,
+    int axis,
+    zval *return_value
+) {
+    if (Z_TYPE_P(a) != IS_ARRAY) {
+        zend_type_error("matrixReduce(a, rows, cols) expects an array");
+        return;
+    }
+
+    if (op < LA_REDUCE_SUM || op > LA_REDUCE_ARGMAX) {
+        zend_value_error("matrixReduce(): invalid operation");
+        return;
+    }
+
+    if (axis != LA_AXIS_NONE && axis != LA_AXIS_ROWS && axis != LA_AXIS_COLS) {
+        zend_value_error("matrixReduce(): invalid axis (0=none, 1=rows, 2=cols)");
+        return;
+    }
+
+    HashTable *ha = Z_ARRVAL_P(a);
+    int size = rows * cols;
+    int a_size = zend_hash_num_elements(ha);
+
+    if (rows <= 0 || cols <= 0) {
+        zend_value_error("matrixReduce(): rows and cols must be > 0");
+        return;
+    }
+
+    if (a_size != size) {
+        zend_value_error("matrixReduce(): matrix size mismatch (expected %d, got %d)", size, a_size);
+        return;
+    }
+
+    float *fa = emalloc(sizeof(float) * size);
+    fill_float_array_from_php_array(a, fa, size);
+
+    /* A whole-matrix reduction is a row reduction over a 1 × size view */
+    int r_rows = rows;
+    int r_cols = cols;
+    int r_axis = axis;
+
+    if (axis == LA_AXIS_NONE) {
+        r_rows = 1;
+        r_cols = size;
+        r_axis = LA_AXIS_ROWS;
+    }
+
+    int out_n = (r_axis == LA_AXIS_ROWS) ? r_rows : r_cols;
+    int count = (r_axis == LA_AXIS_ROWS) ? r_cols : r_rows;
+
+    float *out = emalloc(sizeof(float) * out_n);
+    int *idx = NULL;
+
+    switch (op) {
+        case LA_REDUCE_SUM:
+            reduce_sum(fa, r_rows, r_cols, r_axis, out);
+            break;
+
+        case LA_REDUCE_MEAN:
+            reduce_sum(fa, r_rows, r_cols, r_axis, out);
+            for (int i = 0; i < out_n; i++) {
+                out[i] /= (float) count;
+            }
+            break;
+
+        case LA_REDUCE_VAR:
+            reduce_variance(fa, r_rows, r_cols, r_axis, out);
+            break;
+
+        case LA_REDUCE_MIN:
+        case LA_REDUCE_MAX:
+            reduce_extreme(fa, r_rows, r_cols, r_axis, op == LA_REDUCE_MAX, out, NULL);
+            break;
+
+        case LA_REDUCE_ARGMIN:
+        case LA_REDUCE_ARGMAX:
+            idx = emalloc(sizeof(int) * out_n);
+            reduce_extreme(fa, r_rows, r_cols, r_axis, op == LA_REDUCE_ARGMAX, out, idx);
+            break;
+    }
+
+    if (axis == LA_AXIS_NONE) {
+        if (idx) {
+            ZVAL_LONG(return_value, (zend_long) idx[0]);
+        } else {
+            ZVAL_DOUBLE(return_value, (double) out[0]);
+        }
+    } else {
+        array_init_size(return_value, out_n);
+        for (int i = 0; i < out_n; i++) {
+            if (idx) {
+                add_next_index_long(return_value, (zend_long) idx[i]);
+            } else {
+                add_next_index_double(return_value, (double) out[i]);
+            }
+        }
+    }
+
+    if (idx) efree(idx);
+    efree(out);
+    efree(fa);
+}
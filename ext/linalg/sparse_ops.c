@@ -0,0 +1,76 @@
+#include "../lapack_bridge.h"
+#include "../linalg_internal.h"
+
+#include <math.h>
+
+/*
+ * Sparse vectors are PHP arrays of key => weight: integer ids from
+ * Vocabulary::encode() or HashingVectorizer::transform(), or terms from
+ * Text::tfidf(). Only keys present in both operands contribute, so the
+ * smaller array is walked and each key looked up in the larger one.
+ */
+
+static double sparse_dot(HashTable *a, HashTable *b)
+{
+    if (zend_hash_num_elements(a) > zend_hash_num_elements(b)) {
+        HashTable *t = a;
+        a = b;
+        b = t;
+    }
+
+    zend_string *key;
+    zend_ulong idx;
+    zval *val;
+    zval *other;
+    double sum = 0.0;
+
+    ZEND_HASH_FOREACH_KEY_VAL(a, idx, key, val) {
+        other = key ? zend_hash_find(b, key) : zend_hash_index_find(b, idx);
+        if (other) {
+            sum += zval_get_double(val) * zval_get_double(other);
+        }
+    } ZEND_HASH_FOREACH_END();
+
+    return sum;
+}
+
+static double sparse_norm2(HashTable *a)
+{
+    zval *val;
+    double sum = 0.0;
+
+    ZEND_HASH_FOREACH_VAL(a, val) {
+        double v = zval_get_double(val);
+        sum += v * v;
+    } ZEND_HASH_FOREACH_END();
+
+    return sqrt(sum);
+}
+
+double linear_algebra_sparse_dot_zval(zval *a, zval *b)
+{
+    if (Z_TYPE_P(a) != IS_ARRAY || Z_TYPE_P(b) != IS_ARRAY) {
+        zend_type_error("sparseDot(a, b) expects two arrays");
+        return 0.0;
+    }
+
+    return sparse_dot(Z_ARRVAL_P(a), Z_ARRVAL_P(b));
+}
+
+/* 0.0 when either vector is empty or all zeros */
+double linear_algebra_sparse_cosine_zval(zval *a, zval *b)
+{
+    if (Z_TYPE_P(a) != IS_ARRAY || Z_TYPE_P(b) != IS_ARRAY) {
+        zend_type_error("sparseCosine(a, b) expects two arrays");
+        return 0.0;
+    }
+
+    double na = sparse_norm2(Z_ARRVAL_P(a));
+    double nb = sparse_norm2(Z_ARRVAL_P(b));
+
+    if (na == 0.0 || nb == 0.0) {
+        return 0.0;
+    }
+
+    return sparse_dot(Z_ARRVAL_P(a), Z_ARRVAL_P(b)) / (na * nb);
+}
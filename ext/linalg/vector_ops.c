@@ -1,5 +1,7 @@
 #include "../lapack_bridge.h"
 #include "../linalg_internal.h"
+#include "../linalg_small.h"
+#include "../scratch.h"
 
 #ifdef USE_SYSTEM_LAPACK
     #include <cblas.h>
@@ -27,20 +29,32 @@ double linear_algebra_dot_zval(zval *a, zval *b)
         return 0.0;
     }
 
-    float *va = emalloc(sizeof(float) * n);
-    float *vb = emalloc(sizeof(float) * n);
-
     int i = 0;
     zval *val;
 
+    /* Short vectors: stack buffers, no BLAS call */
+    if (n <= LA_SMALL_DOT_MAX) {
+        float sa[LA_SMALL_DOT_MAX];
+        float sb[LA_SMALL_DOT_MAX];
+
+        ZEND_HASH_FOREACH_VAL(ht_a, val) { sa[i++] = (float) zval_get_double(val); } ZEND_HASH_FOREACH_END();
+        i = 0;
+        ZEND_HASH_FOREACH_VAL(ht_b, val) { sb[i++] = (float) zval_get_double(val); } ZEND_HASH_FOREACH_END();
+
+        return (double) la_small_sdot(sa, sb, n);
+    }
+
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *va = cm_scratch_alloc(sizeof(float) * n);
+    float *vb = cm_scratch_alloc(sizeof(float) * n);
+
     ZEND_HASH_FOREACH_VAL(ht_a, val) { va[i++] = (float) zval_get_double(val); } ZEND_HASH_FOREACH_END();
     i = 0;
     ZEND_HASH_FOREACH_VAL(ht_b, val) { vb[i++] = (float) zval_get_double(val); } ZEND_HASH_FOREACH_END();
 
     float result = cblas_sdot(n, va, 1, vb, 1);
 
-    efree(va);
-    efree(vb);
+    cm_scratch_release(mark);
 
     return (double) result;
 }
@@ -62,7 +76,8 @@ double linear_algebra_norm_zval(zval *x, int method)
         return 0.0;
     }
 
-    float *vx = emalloc(sizeof(float) * n);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *vx = cm_scratch_alloc(sizeof(float) * n);
 
     int i = 0;
     zval *val;
@@ -89,12 +104,12 @@ double linear_algebra_norm_zval(zval *x, int method)
         }
 
         default:
-            efree(vx);
+            cm_scratch_release(mark);
             zend_value_error("norm(x, method): invalid method");
             return 0.0;
     }
 
-    efree(vx);
+    cm_scratch_release(mark);
     return (double) result;
 }
 
@@ -118,7 +133,8 @@ void linear_algebra_vector_normalize_zval(
         return;
     }
 
-    float *vx = emalloc(sizeof(float) * n);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *vx = cm_scratch_alloc(sizeof(float) * n);
 
     int i = 0;
     zval *val;
@@ -144,13 +160,13 @@ void linear_algebra_vector_normalize_zval(
         }
 
         default:
-            efree(vx);
+            cm_scratch_release(mark);
             zend_value_error("normalize(): invalid method (0=L1, 1=L2, 2=L∞)");
             return;
     }
 
     if (norm == 0.0f) {
-        efree(vx);
+        cm_scratch_release(mark);
         zend_value_error("normalize(): cannot normalize zero-norm vector");
         return;
     }
@@ -160,7 +176,7 @@ void linear_algebra_vector_normalize_zval(
         add_next_index_double(return_value, (double)(vx[i] / norm));
     }
 
-    efree(vx);
+    cm_scratch_release(mark);
 }
 
 /* ---------- DISTANCE ---------- */
@@ -186,8 +202,9 @@ void linear_algebra_vector_distance_zval(
         return;
     }
 
-    float *va = emalloc(sizeof(float) * n);
-    float *vb = emalloc(sizeof(float) * n);
+    cm_scratch_pos mark = cm_scratch_mark();
+    float *va = cm_scratch_alloc(sizeof(float) * n);
+    float *vb = cm_scratch_alloc(sizeof(float) * n);
 
     int i = 0;
     zval *val;
@@ -220,7 +237,7 @@ void linear_algebra_vector_distance_zval(
 
         case LA_DIST_LP:
             if (p < 1.0) {
-                efree(va); efree(vb);
+                cm_scratch_release(mark);
                 zend_value_error("distance(): Minkowski requires p >= 1");
                 return;
             }
@@ -241,7 +258,7 @@ void linear_algebra_vector_distance_zval(
             }
 
             if (na == 0.0 || nb == 0.0) {
-                efree(va); efree(vb);
+                cm_scratch_release(mark);
                 zend_value_error("distance(): cosine distance undefined for zero-norm vector");
                 return;
             }
@@ -249,13 +266,12 @@ void linear_algebra_vector_distance_zval(
             result = 1.0 - (dot / (sqrt(na) * sqrt(nb)));
             break;
         default:
-            efree(va); efree(vb);
+            cm_scratch_release(mark);
             zend_value_error("distance(): invalid method");
             return;
     }
 
-    efree(va);
-    efree(vb);
+    cm_scratch_release(mark);
 
     ZVAL_DOUBLE(return_value, result);
 }
@@ -19,6 +19,40 @@
 #define LA_DIST_LP  2
 #define LA_DIST_COS 3
 
+/* Fused dot: operand is used as is, without normalization */
+#define LA_FUSED_RAW -1
+
+/* Reduction axis constants */
+#define LA_AXIS_NONE 0
+#define LA_AXIS_ROWS 1
+#define LA_AXIS_COLS 2
+
+/* Reduction operation constants */
+#define LA_REDUCE_SUM    0
+#define LA_REDUCE_MEAN   1
+#define LA_REDUCE_VAR    2
+#define LA_REDUCE_MIN    3
+#define LA_REDUCE_MAX    4
+#define LA_REDUCE_ARGMIN 5
+#define LA_REDUCE_ARGMAX 6
+
+/* Activation function constants */
+#define LA_ACT_IDENTITY    0
+#define LA_ACT_RELU        1
+#define LA_ACT_SIGMOID     2
+#define LA_ACT_TANH        3
+#define LA_ACT_GELU        4
+#define LA_ACT_SOFTMAX     5
+#define LA_ACT_LOG_SOFTMAX 6
+
+/* Linear classifier loss constants */
+#define LA_LOSS_LOG   0
+#define LA_LOSS_HINGE 1
+
+/* Linear classifier optimizer constants */
+#define LA_OPT_SGD     0
+#define LA_OPT_ADAGRAD 1
+
 /* LAPACK SGESDD (Fortran symbol) */
 extern void sgesdd_(
     char *jobz,
@@ -40,4 +74,23 @@ extern void sgesdd_(
 /* Internal helper functions */
 char svd_jobz_from_zval(zval *jobz_zv);
 
+/* In-place activation kernels over a row-major rows × cols buffer */
+void la_activation_apply(float *x, int rows, int cols, int fn);
+float la_row_logsumexp(const float *x, int n);
+
+/* K-means over a row-major n × d float buffer (centroids: k × d) */
+typedef struct {
+    int k;
+    int max_iter;
+    double tol;         /* relative to the mean per-feature variance */
+    int batch_size;     /* > 0 selects mini-batch updates */
+    zend_long seed;     /* 0 = fixed default seed */
+    int threads;        /* <= 0 = one per online CPU */
+} la_kmeans_options;
+
+int la_kmeans_fit(const float *x, int n, int d, const la_kmeans_options *opts,
+                  float *centroids, int *labels, double *inertia_out);
+void la_kmeans_assign(const float *x, int n, int d, const float *centroids, int k,
+                      int *labels, float *dist);
+
 #endif /* LINALG_INTERNAL_H */
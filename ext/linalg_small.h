@@ -0,0 +1,128 @@
+#ifndef LINALG_SMALL_H
+#define LINALG_SMALL_H
+
+#include <php.h>
+#include "lapack_bridge.h"
+
+/*
+ * Kernels for small vectors and matrices (3×3, 4×4, short feature vectors).
+ *
+ * At these sizes the BLAS call and the heap buffers cost more than the
+ * arithmetic, so operands live on the stack and the loops are plain C.
+ * The bridges switch to them below the thresholds here; the optimizers emit
+ * the *_fixed entry points directly when every size is a literal, letting the
+ * compiler unroll the loops completely.
+ */
+
+#define LA_SMALL_DOT_MAX    16   /* vector length */
+#define LA_SMALL_MATMUL_MAX 64   /* elements per operand (8×8) */
+
+/* Dot product with four independent accumulators so the loop vectorizes */
+static zend_always_inline float la_small_sdot(const float *a, const float *b, const int n)
+{
+    float acc[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    int i = 0;
+
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC unroll 4
+#endif
+    for (; i + 4 <= n; i += 4) {
+        acc[0] += a[i]     * b[i];
+        acc[1] += a[i + 1] * b[i + 1];
+        acc[2] += a[i + 2] * b[i + 2];
+        acc[3] += a[i + 3] * b[i + 3];
+    }
+    for (; i < n; i++) {
+        acc[0] += a[i] * b[i];
+    }
+
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+/*
+ * Row-major C (m × k) = op(A) · op(B).
+ * A is m × n (n × m when transposed), B is n × k (k × n when transposed),
+ * matching the layout linear_algebra_matmul_zval() receives from PHP.
+ */
+static zend_always_inline void la_small_sgemm(
+    const float *a, const float *b, float *c,
+    const int m, const int n, const int k,
+    const int transpose_a, const int transpose_b
+) {
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC unroll 8
+#endif
+    for (int i = 0; i < m; i++) {
+        float *ci = c + i * k;
+
+        for (int j = 0; j < k; j++) {
+            ci[j] = 0.0f;
+        }
+
+        for (int p = 0; p < n; p++) {
+            float aip = transpose_a ? a[p * m + i] : a[i * n + p];
+
+            /* j innermost: contiguous in C and, without transpose, in B */
+            for (int j = 0; j < k; j++) {
+                ci[j] += aip * (transpose_b ? b[j * n + p] : b[p * k + j]);
+            }
+        }
+    }
+}
+
+/* Copy exactly n elements of a PHP array; 0 when x is not an n-element array */
+static zend_always_inline int la_small_load(zval *x, float *out, const int n)
+{
+    zval *val;
+    int i = 0;
+
+    if (Z_TYPE_P(x) != IS_ARRAY || zend_hash_num_elements(Z_ARRVAL_P(x)) != (uint32_t) n) {
+        return 0;
+    }
+
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(x), val) {
+        out[i++] = (float) zval_get_double(val);
+    } ZEND_HASH_FOREACH_END();
+
+    return 1;
+}
+
+/* ---------- Entry points for literal sizes (emitted by the optimizers) ---------- */
+
+static zend_always_inline double linear_algebra_dot_fixed(zval *a, zval *b, const int n)
+{
+    float va[LA_SMALL_DOT_MAX];
+    float vb[LA_SMALL_DOT_MAX];
+
+    if (!la_small_load(a, va, n) || !la_small_load(b, vb, n)) {
+        /* Let the generic bridge report the error */
+        return linear_algebra_dot_zval(a, b);
+    }
+
+    return (double) la_small_sdot(va, vb, n);
+}
+
+static zend_always_inline void linear_algebra_matmul_fixed(
+    zval *a, zval *b,
+    const int m, const int n, const int k,
+    const int transpose_a, const int transpose_b,
+    zval *return_value
+) {
+    float ma[LA_SMALL_MATMUL_MAX];
+    float mb[LA_SMALL_MATMUL_MAX];
+    float mc[LA_SMALL_MATMUL_MAX];
+
+    if (!la_small_load(a, ma, m * n) || !la_small_load(b, mb, n * k)) {
+        linear_algebra_matmul_zval(a, b, m, n, k, transpose_a, transpose_b, return_value);
+        return;
+    }
+
+    la_small_sgemm(ma, mb, mc, m, n, k, transpose_a, transpose_b);
+
+    array_init_size(return_value, m * k);
+    for (int i = 0; i < m * k; i++) {
+        add_next_index_double(return_value, (double) mc[i]);
+    }
+}
+
+#endif /* LINALG_SMALL_H */
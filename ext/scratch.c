@@ -0,0 +1,132 @@
+#include "scratch.h"
+
+/* Block that did not fit the buffer; the header sits at the start of the emalloc'd memory */
+typedef struct _cm_scratch_spill {
+    struct _cm_scratch_spill *next;
+    size_t size;
+} cm_scratch_spill;
+
+typedef struct {
+    char   *raw;       /* emalloc'd memory backing the buffer */
+    char   *base;      /* raw rounded up to CM_SCRATCH_ALIGN */
+    size_t  size;      /* usable bytes from base */
+    size_t  used;
+    size_t  spilled;   /* bytes currently held in spills */
+    size_t  peak;      /* largest used + spilled seen this request */
+    uint32_t spills;
+    cm_scratch_spill *spill;
+} cm_scratch_arena;
+
+CM_TLS cm_scratch_arena scratch;
+
+static zend_always_inline size_t scratch_round(size_t size)
+{
+    return (size + (CM_SCRATCH_ALIGN - 1)) & ~((size_t) CM_SCRATCH_ALIGN - 1);
+}
+
+static zend_always_inline char *scratch_align(char *p)
+{
+    return (char *) scratch_round((size_t) p);
+}
+
+/* Replace the (empty) buffer by one of at least size bytes */
+static void scratch_grow(size_t size)
+{
+    if (scratch.raw) {
+        efree(scratch.raw);
+    }
+
+    scratch.raw = emalloc(size + CM_SCRATCH_ALIGN - 1);
+    scratch.base = scratch_align(scratch.raw);
+    scratch.size = size;
+    scratch.used = 0;
+}
+
+void cm_scratch_rinit(void)
+{
+    memset(&scratch, 0, sizeof(scratch));
+}
+
+void cm_scratch_rshutdown(void)
+{
+    while (scratch.spill) {
+        cm_scratch_spill *next = scratch.spill->next;
+        efree(scratch.spill);
+        scratch.spill = next;
+    }
+
+    if (scratch.raw) {
+        efree(scratch.raw);
+    }
+
+    memset(&scratch, 0, sizeof(scratch));
+}
+
+void *cm_scratch_alloc(size_t size)
+{
+    size = scratch_round(size ? size : 1);
+
+    /* Nothing live: the buffer can be replaced by a larger one */
+    if (scratch.used == 0 && scratch.spills == 0 && size > scratch.size && size <= CM_SCRATCH_RETAIN) {
+        size_t grown = scratch.size ? scratch.size : CM_SCRATCH_INITIAL;
+
+        while (grown < size) {
+            grown *= 2;
+        }
+
+        scratch_grow(grown < CM_SCRATCH_RETAIN ? grown : CM_SCRATCH_RETAIN);
+    }
+
+    if (size <= scratch.size - scratch.used) {
+        void *p = scratch.base + scratch.used;
+
+        scratch.used += size;
+        if (scratch.used + scratch.spilled > scratch.peak) {
+            scratch.peak = scratch.used + scratch.spilled;
+        }
+
+        return p;
+    }
+
+    cm_scratch_spill *spill = emalloc(sizeof(cm_scratch_spill) + size + CM_SCRATCH_ALIGN - 1);
+
+    spill->next = scratch.spill;
+    spill->size = size;
+    scratch.spill = spill;
+    scratch.spills++;
+    scratch.spilled += size;
+
+    if (scratch.used + scratch.spilled > scratch.peak) {
+        scratch.peak = scratch.used + scratch.spilled;
+    }
+
+    return scratch_align((char *) (spill + 1));
+}
+
+cm_scratch_pos cm_scratch_mark(void)
+{
+    cm_scratch_pos pos = { scratch.used, scratch.spills };
+
+    return pos;
+}
+
+void cm_scratch_release(cm_scratch_pos pos)
+{
+    while (scratch.spills > pos.spills) {
+        cm_scratch_spill *next = scratch.spill->next;
+
+        scratch.spilled -= scratch.spill->size;
+        efree(scratch.spill);
+        scratch.spill = next;
+        scratch.spills--;
+    }
+
+    scratch.used = pos.used;
+
+    /* Fully released after spilling: size the buffer for the high-water mark */
+    if (scratch.used == 0 && scratch.peak > scratch.size && scratch.size < CM_SCRATCH_RETAIN) {
+        size_t grown = scratch_round(scratch.peak + scratch.peak / 4);
+
+        scratch_grow(grown < CM_SCRATCH_RETAIN ? grown : CM_SCRATCH_RETAIN);
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef CORALMEDIA_SCRATCH_H
+#define CORALMEDIA_SCRATCH_H
+
+#include "php.h"
+
+/*
+ * Per-request scratch arena for bridge temporaries (float copies of PHP
+ * arrays, column-major LAPACK buffers, UTF-16 text).
+ *
+ * Allocations are 64-byte aligned and bump a pointer; a bridge takes a
+ * mark on entry and releases it on every return path. The buffer only
+ * grows, so once a request has warmed up, repeated calls allocate nothing.
+ * Requests that overflow the buffer spill to plain emalloc blocks, and the
+ * buffer is resized to the high-water mark once everything is released.
+ *
+ * Marks nest: a bridge may call another bridge between mark and release.
+ */
+
+/* Thread-local file-scope state: ZEND_TLS is static only under ZTS */
+#ifdef ZTS
+# define CM_TLS ZEND_TLS
+#else
+# define CM_TLS static
+#endif
+
+#define CM_SCRATCH_ALIGN   64
+#define CM_SCRATCH_INITIAL (64 * 1024)          /* first buffer, bytes */
+#define CM_SCRATCH_RETAIN  (16 * 1024 * 1024)   /* largest buffer kept between calls */
+
+typedef struct {
+    size_t   used;
+    uint32_t spills;
+} cm_scratch_pos;
+
+void cm_scratch_rinit(void);
+void cm_scratch_rshutdown(void);
+
+void *cm_scratch_alloc(size_t size);
+cm_scratch_pos cm_scratch_mark(void);
+void cm_scratch_release(cm_scratch_pos pos);
+
+#endif
@@ -1,22 +1,275 @@
 #include "snowball_bridge.h"
+#include "intern.h"
+#include "scratch.h"
 #include "libstemmer/include/libstemmer.h"
 
+/*
+ * Stem cache. Word frequencies follow Zipf's law, so an indexer stems the
+ * same few thousand words over and over. With coralmedia.stem_cache_size
+ * > 0, each language keeps an LRU map from input word to stem zend_string
+ * for the rest of the request: a hit is one hash lookup (on the hash the
+ * word usually already carries) and a new reference to the cached stem.
+ * Entries live in an array linked most recent first, doubled as words
+ * arrive until it reaches the configured size; a full cache then evicts
+ * its tail without allocating. The language's stemmer is opened once and
+ * kept with the cache.
+ */
+
+typedef struct {
+    zend_string *word;
+    zend_string *stem;
+    uint32_t prev;
+    uint32_t next;
+} stem_cache_entry;
+
+#define STEM_CACHE_NIL UINT32_MAX
+#define STEM_CACHE_MIN_ALLOC 64
+
+typedef struct {
+    struct sb_stemmer *stemmer;
+    HashTable map;                  /* word => entry slot */
+    stem_cache_entry *entries;
+    uint32_t capacity;              /* configured size */
+    uint32_t allocated;             /* entries allocated so far, <= capacity */
+    uint32_t count;
+    uint32_t head;                  /* most recently used */
+    uint32_t tail;
+    zend_long hits;
+    zend_long misses;
+    zend_long evictions;
+} stem_cache;
+
+/* Per-request: language => stem_cache */
+CM_TLS HashTable *stem_caches;
+
+/* coralmedia.stem_cache_size, kept per thread by the ini machinery */
+CM_TLS zend_long stem_cache_size;
+
+static ZEND_INI_MH(OnUpdateStemCacheSize)
+{
+    char *end;
+    zend_long size = ZEND_STRTOL(ZSTR_VAL(new_value), &end, 10);
+
+    if (end == ZSTR_VAL(new_value) || *end != '\0' || size < 0 || size > LIBSTEMMER_STEM_CACHE_MAX) {
+        return FAILURE;
+    }
+
+    stem_cache_size = size;
+
+    return SUCCESS;
+}
+
+ZEND_INI_BEGIN()
+    ZEND_INI_ENTRY("coralmedia.stem_cache_size", "0", ZEND_INI_ALL, OnUpdateStemCacheSize)
+ZEND_INI_END()
+
+void libstemmer_minit(int module_number)
+{
+    zend_register_ini_entries(ini_entries, module_number);
+}
+
+static void stem_cache_flush(stem_cache *sc)
+{
+    for (uint32_t i = 0; i < sc->count; i++) {
+        zend_string_release(sc->entries[i].word);
+        zend_string_release(sc->entries[i].stem);
+    }
+
+    if (sc->entries) {
+        efree(sc->entries);
+        sc->entries = NULL;
+    }
+
+    zend_hash_clean(&sc->map);
+    sc->capacity = 0;
+    sc->allocated = 0;
+    sc->count = 0;
+    sc->head = sc->tail = STEM_CACHE_NIL;
+}
+
+static void stem_cache_dtor(zval *zv)
+{
+    stem_cache *sc = (stem_cache *) Z_PTR_P(zv);
+
+    stem_cache_flush(sc);
+    zend_hash_destroy(&sc->map);
+    sb_stemmer_delete(sc->stemmer);
+    efree(sc);
+}
+
+void libstemmer_rshutdown(void)
+{
+    if (stem_caches) {
+        zend_hash_destroy(stem_caches);
+        efree(stem_caches);
+        stem_caches = NULL;
+    }
+}
+
+void libstemmer_mshutdown(int module_number)
+{
+    zend_unregister_ini_entries(module_number);
+    /* Lookup indexes the Snowball runtime builds on first use, shared by all threads */
+    sb_stemmer_release_indexes();
+}
+
+/* NULL for an unknown language */
+static stem_cache *stem_cache_get(const char *lang)
+{
+    size_t len = strlen(lang);
+    stem_cache *sc;
+
+    if (!stem_caches) {
+        stem_caches = emalloc(sizeof(HashTable));
+        zend_hash_init(stem_caches, 8, NULL, stem_cache_dtor, 0);
+    } else if ((sc = zend_hash_str_find_ptr(stem_caches, lang, len)) != NULL) {
+        return sc;
+    }
+
+    struct sb_stemmer *stemmer = sb_stemmer_new(lang, "UTF_8");
+
+    if (!stemmer) {
+        return NULL;
+    }
+
+    sc = ecalloc(1, sizeof(stem_cache));
+    sc->stemmer = stemmer;
+    sc->head = sc->tail = STEM_CACHE_NIL;
+    zend_hash_init(&sc->map, 64, NULL, NULL, 0);
+
+    return zend_hash_str_add_ptr(stem_caches, lang, len, sc);
+}
+
+static void stem_cache_unlink(stem_cache *sc, uint32_t slot)
+{
+    stem_cache_entry *e = &sc->entries[slot];
+
+    if (e->prev != STEM_CACHE_NIL) {
+        sc->entries[e->prev].next = e->next;
+    } else {
+        sc->head = e->next;
+    }
+
+    if (e->next != STEM_CACHE_NIL) {
+        sc->entries[e->next].prev = e->prev;
+    } else {
+        sc->tail = e->prev;
+    }
+}
+
+static void stem_cache_push_front(stem_cache *sc, uint32_t slot)
+{
+    stem_cache_entry *e = &sc->entries[slot];
+
+    e->prev = STEM_CACHE_NIL;
+    e->next = sc->head;
+
+    if (sc->head != STEM_CACHE_NIL) {
+        sc->entries[sc->head].prev = slot;
+    } else {
+        sc->tail = slot;
+    }
+
+    sc->head = slot;
+}
+
+static void stem_cache_store(stem_cache *sc, zend_string *word, zend_string *stem)
+{
+    uint32_t slot;
+    zval zv;
+
+    if (sc->count < sc->capacity) {
+        if (sc->count == sc->allocated) {
+            sc->allocated = sc->allocated < STEM_CACHE_MIN_ALLOC ? STEM_CACHE_MIN_ALLOC : sc->allocated * 2;
+            if (sc->allocated > sc->capacity) {
+                sc->allocated = sc->capacity;
+            }
+            sc->entries = safe_erealloc(sc->entries, sc->allocated, sizeof(stem_cache_entry), 0);
+        }
+        slot = sc->count++;
+    } else {
+        slot = sc->tail;
+        stem_cache_unlink(sc, slot);
+        zend_hash_del(&sc->map, sc->entries[slot].word);
+        zend_string_release(sc->entries[slot].word);
+        zend_string_release(sc->entries[slot].stem);
+        sc->evictions++;
+    }
+
+    sc->entries[slot].word = zend_string_copy(word);
+    sc->entries[slot].stem = zend_string_copy(stem);
+    stem_cache_push_front(sc, slot);
+
+    ZVAL_LONG(&zv, slot);
+    zend_hash_add_new(&sc->map, word, &zv);
+}
+
 zend_string *libstemmer_stem(zend_string *word, const char *lang)
 {
-    struct sb_stemmer *stemmer;
+    stem_cache *sc = stem_cache_get(lang);
     const sb_symbol *out;
     int out_len;
 
-    stemmer = sb_stemmer_new(lang, "UTF_8");
-    if (!stemmer) {
+    if (!sc) {
         return NULL;
     }
 
-    out = sb_stemmer_stem(stemmer, (const sb_symbol*) ZSTR_VAL(word), ZSTR_LEN(word));
-    out_len = sb_stemmer_length(stemmer);
+    /* Cache switched on, resized or off: start over with the new size */
+    if ((uint32_t) stem_cache_size != sc->capacity) {
+        stem_cache_flush(sc);
+        sc->capacity = (uint32_t) stem_cache_size;
+    }
+
+    if (sc->capacity > 0) {
+        zval *found = zend_hash_find(&sc->map, word);
+
+        if (found) {
+            uint32_t slot = (uint32_t) Z_LVAL_P(found);
+
+            if (slot != sc->head) {
+                stem_cache_unlink(sc, slot);
+                stem_cache_push_front(sc, slot);
+            }
+            sc->hits++;
+
+            return zend_string_copy(sc->entries[slot].stem);
+        }
+
+        sc->misses++;
+    }
+
+    out = sb_stemmer_stem(sc->stemmer, (const sb_symbol*) ZSTR_VAL(word), ZSTR_LEN(word));
+    out_len = sb_stemmer_length(sc->stemmer);
 
-    zend_string *result = zend_string_init((char*) out, out_len, 0);
-    sb_stemmer_delete(stemmer);
+    zend_string *result = cm_intern((const char*) out, out_len);
+
+    if (sc->capacity > 0) {
+        stem_cache_store(sc, word, result);
+    }
 
     return result;
-}
\ No newline at end of file
+}
+
+void libstemmer_cache_stats(zval *return_value)
+{
+    zend_string *lang;
+    stem_cache *sc;
+
+    array_init(return_value);
+
+    if (!stem_caches) {
+        return;
+    }
+
+    ZEND_HASH_FOREACH_STR_KEY_PTR(stem_caches, lang, sc) {
+        zval stats;
+
+        array_init_size(&stats, 5);
+        add_assoc_long(&stats, "size", sc->count);
+        add_assoc_long(&stats, "capacity", sc->capacity);
+        add_assoc_long(&stats, "hits", sc->hits);
+        add_assoc_long(&stats, "misses", sc->misses);
+        add_assoc_long(&stats, "evictions", sc->evictions);
+        zend_hash_update(Z_ARRVAL_P(return_value), lang, &stats);
+    } ZEND_HASH_FOREACH_END();
+}
@@ -3,6 +3,18 @@
 
 #include "php.h"
 
+/* Upper bound of coralmedia.stem_cache_size, in words per language */
+#define LIBSTEMMER_STEM_CACHE_MAX 1048576
+
+/* NULL for an unknown language; memoizes up to coralmedia.stem_cache_size words of the language (LRU) */
 zend_string *libstemmer_stem(zend_string *word, const char *lang);
 
-#endif
\ No newline at end of file
+/* language => [size, capacity, hits, misses, evictions] for this request */
+void libstemmer_cache_stats(zval *return_value);
+
+/* Registers and unregisters coralmedia.stem_cache_size */
+void libstemmer_minit(int module_number);
+void libstemmer_rshutdown(void);
+void libstemmer_mshutdown(int module_number);
+
+#endif
@@ -0,0 +1,237 @@
+#include "../text_bridge.h"
+#include "../text_internal.h"
+#include "../scratch.h"
+
+#include <unicode/ustring.h>
+#include <unicode/parseerr.h>
+#include <pthread.h>
+
+/*
+ * Custom word-break rules (ICU RBBI syntax, as for ubrk_openRules()),
+ * registered by name for the life of the process. The rules are compiled
+ * once and only their binary form (ubrk_getBinaryRules()) is kept: every
+ * pipeline that selects them opens its iterator with ubrk_openBinaryRules(),
+ * which uses the data in place, without compiling or copying it. The binary
+ * form is returned to the caller, who can register it again in a later
+ * process to skip compilation (it is tied to the ICU major version).
+ */
+
+typedef struct {
+    int32_t len;
+    int32_t reserved;               /* keeps data 8-byte aligned */
+    uint8_t data[];
+} break_rules_binary;
+
+/*
+ * Process-wide registry: name => persistent break_rules_binary, shared by
+ * all threads under the lock. Registering identical rules again keeps the
+ * current copy, so a worker may register its rules on every request. Rules
+ * replaced by different ones are freed at once without ZTS, where no
+ * iterator can be open during the call. With ZTS another thread's iterator
+ * may still read them in place, so they are retired until module shutdown,
+ * and at most BREAK_RULES_RETIRED_MAX replacements are accepted.
+ */
+#define BREAK_RULES_RETIRED_MAX 64
+
+static HashTable *break_rules_registry;
+#ifdef ZTS
+static HashTable *break_rules_retired;
+#endif
+static pthread_mutex_t break_rules_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void break_rules_dtor(zval *zv)
+{
+    pefree(Z_PTR_P(zv), 1);
+}
+
+void text_break_rules_shutdown(void)
+{
+    pthread_mutex_lock(&break_rules_lock);
+    if (break_rules_registry) {
+        zend_hash_destroy(break_rules_registry);
+        pefree(break_rules_registry, 1);
+        break_rules_registry = NULL;
+    }
+#ifdef ZTS
+    if (break_rules_retired) {
+        zend_hash_destroy(break_rules_retired);
+        pefree(break_rules_retired, 1);
+        break_rules_retired = NULL;
+    }
+#endif
+    pthread_mutex_unlock(&break_rules_lock);
+}
+
+UBreakIterator *text_break_rules_open(const char *name, const char *fn)
+{
+    break_rules_binary *rules = NULL;
+
+    pthread_mutex_lock(&break_rules_lock);
+    if (break_rules_registry) {
+        rules = zend_hash_str_find_ptr(break_rules_registry, name, strlen(name));
+    }
+    pthread_mutex_unlock(&break_rules_lock);
+
+    if (!rules) {
+        zend_value_error("%s(): unknown break_rules '%s'", fn, name);
+        return NULL;
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+    UBreakIterator *bi = ubrk_openBinaryRules(rules->data, rules->len, NULL, 0, &status);
+
+    if (U_FAILURE(status) || !bi) {
+        if (bi) {
+            ubrk_close(bi);
+        }
+        zend_value_error("%s(): failed to open break_rules '%s'", fn, name);
+        return NULL;
+    }
+
+    return bi;
+}
+
+/* Compile RBBI source; NULL after raising an error */
+static break_rules_binary *break_rules_compile(const char *source, size_t len)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError parse_error = {0};
+    cm_scratch_pos mark = cm_scratch_mark();
+    int32_t u16_len = 0;
+    UChar *u16 = (UChar *) cm_scratch_alloc(sizeof(UChar) * (len + 1));
+
+    u_strFromUTF8(u16, (int32_t) len + 1, &u16_len, source, (int32_t) len, &status);
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("registerBreakRules(): rules must be valid UTF-8");
+        return NULL;
+    }
+
+    UBreakIterator *bi = ubrk_openRules(u16, u16_len, NULL, 0, &parse_error, &status);
+
+    cm_scratch_release(mark);
+
+    if (U_FAILURE(status) || !bi) {
+        if (bi) {
+            ubrk_close(bi);
+        }
+        zend_value_error("registerBreakRules(): invalid rules at line %d, offset %d (%s)",
+            (int) parse_error.line, (int) parse_error.offset, u_errorName(status));
+        return NULL;
+    }
+
+    int32_t binary_len = ubrk_getBinaryRules(bi, NULL, 0, &status);
+    break_rules_binary *rules = NULL;
+
+    if (U_SUCCESS(status) && binary_len > 0) {
+        rules = pemalloc(sizeof(break_rules_binary) + binary_len, 1);
+        rules->len = ubrk_getBinaryRules(bi, rules->data, binary_len, &status);
+        if (U_FAILURE(status)) {
+            pefree(rules, 1);
+            rules = NULL;
+        }
+    }
+
+    ubrk_close(bi);
+
+    if (!rules) {
+        zend_value_error("registerBreakRules(): failed to serialize rules (%s)", u_errorName(status));
+    }
+
+    return rules;
+}
+
+/* Copy binary rules from a previous registration; NULL after raising an error */
+static break_rules_binary *break_rules_load(const char *binary, size_t len)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    break_rules_binary *rules = pemalloc(sizeof(break_rules_binary) + len, 1);
+
+    rules->len = (int32_t) len;
+    memcpy(rules->data, binary, len);
+
+    /* Validates the header, format version and endianness */
+    UBreakIterator *bi = ubrk_openBinaryRules(rules->data, rules->len, NULL, 0, &status);
+
+    if (U_FAILURE(status) || !bi) {
+        if (bi) {
+            ubrk_close(bi);
+        }
+        pefree(rules, 1);
+        zend_value_error("registerBreakRules(): invalid binary rules (%s)", u_errorName(status));
+        return NULL;
+    }
+
+    ubrk_close(bi);
+
+    return rules;
+}
+
+void text_break_rules_register_zval(zval *name, zval *rules, zend_bool binary, zval *return_value)
+{
+    if (Z_TYPE_P(name) != IS_STRING || Z_STRLEN_P(name) == 0) {
+        zend_type_error("registerBreakRules(): name must be a non-empty string");
+        return;
+    }
+
+    if (Z_TYPE_P(rules) != IS_STRING || Z_STRLEN_P(rules) == 0) {
+        zend_type_error("registerBreakRules(): rules must be a non-empty string");
+        return;
+    }
+
+    if (Z_STRLEN_P(rules) >= INT32_MAX) {
+        zend_value_error("registerBreakRules(): rules are too long");
+        return;
+    }
+
+    break_rules_binary *compiled = binary
+        ? break_rules_load(Z_STRVAL_P(rules), Z_STRLEN_P(rules))
+        : break_rules_compile(Z_STRVAL_P(rules), Z_STRLEN_P(rules));
+
+    if (!compiled) {
+        return;
+    }
+
+    ZVAL_STRINGL(return_value, (const char *) compiled->data, compiled->len);
+
+    pthread_mutex_lock(&break_rules_lock);
+
+    if (!break_rules_registry) {
+        break_rules_registry = pemalloc(sizeof(HashTable), 1);
+        zend_hash_init(break_rules_registry, 8, NULL, break_rules_dtor, 1);
+    }
+
+    zval *old = zend_hash_str_find(break_rules_registry, Z_STRVAL_P(name), Z_STRLEN_P(name));
+
+    if (!old) {
+        zend_hash_str_add_new_ptr(break_rules_registry, Z_STRVAL_P(name), Z_STRLEN_P(name), compiled);
+    } else {
+        break_rules_binary *current = Z_PTR_P(old);
+
+        if (current->len == compiled->len && memcmp(current->data, compiled->data, compiled->len) == 0) {
+            pefree(compiled, 1);
+        } else {
+#ifdef ZTS
+            /* Another thread's iterator may still be reading the old rules */
+            if (!break_rules_retired) {
+                break_rules_retired = pemalloc(sizeof(HashTable), 1);
+                zend_hash_init(break_rules_retired, 8, NULL, break_rules_dtor, 1);
+            }
+            if (zend_hash_num_elements(break_rules_retired) >= BREAK_RULES_RETIRED_MAX) {
+                pthread_mutex_unlock(&break_rules_lock);
+                pefree(compiled, 1);
+                zval_ptr_dtor(return_value);
+                ZVAL_NULL(return_value);
+                zend_value_error("registerBreakRules(): rules replaced more than %d times in this process", BREAK_RULES_RETIRED_MAX);
+                return;
+            }
+            zend_hash_next_index_insert_ptr(break_rules_retired, current);
+#else
+            pefree(current, 1);
+#endif
+            Z_PTR_P(old) = compiled;
+        }
+    }
+
+    pthread_mutex_unlock(&break_rules_lock);
+}
@@ -0,0 +1,269 @@
+#include "../text_bridge.h"
+#include "../text_internal.h"
+
+#include <unicode/utext.h>
+#include <unicode/uchar.h>
+
+/*
+ * Chunker: splits a document into chunks of at most max_tokens words (as
+ * counted by wordBreak()) for embedding. One walk of the word and sentence
+ * iterators over the UTF-8 bytes (UText, no UTF-16 copy) records the byte
+ * offsets of every word and the word range of every sentence; chunks are
+ * then cut from those arrays, so boundaries are byte offsets into the
+ * original string and substrings are taken from it directly.
+ *
+ * Soft boundaries pack whole sentences and overlap by whole sentences; a
+ * sentence longer than max_tokens is split at word boundaries. Hard
+ * boundaries ignore sentences: every chunk is exactly max_tokens words
+ * (but the last), overlapping by overlap words.
+ */
+
+typedef struct {
+    int32_t start;
+    int32_t end;
+} chunk_span;
+
+typedef struct {
+    int32_t start;                  /* bytes, trailing whitespace excluded */
+    int32_t end;
+    int32_t first_word;
+    int32_t words;
+} chunk_sentence;
+
+typedef struct {
+    const char *text;
+    chunk_span *words;
+    chunk_sentence *sentences;
+    int32_t word_count;
+    int32_t sentence_count;
+    zend_long max_tokens;
+    zend_long overlap;
+    zend_bool offsets;
+    zval *out;
+} chunker;
+
+/* Grow-by-doubling append, as the corpus counters do */
+#define CHUNK_APPEND(arr, count, capacity, initial) do { \
+        if ((count) == (capacity)) { \
+            (capacity) = (capacity) ? (capacity) * 2 : (initial); \
+            (arr) = erealloc((arr), sizeof(*(arr)) * (capacity)); \
+        } \
+    } while (0)
+
+/* End of [start, end) without its trailing white space */
+static int32_t chunk_trim(UText *ut, int32_t start, int32_t end)
+{
+    utext_setNativeIndex(ut, end);
+
+    while (end > start) {
+        UChar32 c = utext_previous32(ut);
+
+        if (c == U_SENTINEL || !u_isUWhiteSpace(c)) {
+            break;
+        }
+        end = (int32_t) utext_getNativeIndex(ut);
+    }
+
+    return end;
+}
+
+static void chunk_emit(chunker *ck, int32_t start, int32_t end, int32_t tokens)
+{
+    if (ck->offsets) {
+        zval range;
+
+        array_init_size(&range, 3);
+        add_next_index_long(&range, start);
+        add_next_index_long(&range, end);
+        add_next_index_long(&range, tokens);
+        add_next_index_zval(ck->out, &range);
+    } else {
+        add_next_index_stringl(ck->out, ck->text + start, (size_t) (end - start));
+    }
+}
+
+/*
+ * Windows of max_tokens words over words [first, last), overlap words apart.
+ * The first window starts at start and the last ends at end, so a split
+ * sentence keeps its leading and trailing punctuation.
+ */
+static void chunk_words(chunker *ck, int32_t first, int32_t last, int32_t start, int32_t end)
+{
+    int32_t step = (int32_t) (ck->max_tokens - ck->overlap);
+
+    for (int32_t w = first; w < last; w += step) {
+        int32_t stop = w + (int32_t) ck->max_tokens < last ? w + (int32_t) ck->max_tokens : last;
+
+        chunk_emit(ck,
+            w == first ? start : ck->words[w].start,
+            stop == last ? end : ck->words[stop - 1].end,
+            stop - w);
+
+        if (stop == last) {
+            break;
+        }
+    }
+}
+
+static void chunk_sentences(chunker *ck)
+{
+    chunk_sentence *s = ck->sentences;
+    int32_t n = ck->sentence_count;
+    int32_t i = 0;
+
+    while (i < n) {
+        if (s[i].words > ck->max_tokens) {
+            chunk_words(ck, s[i].first_word, s[i].first_word + s[i].words, s[i].start, s[i].end);
+            i++;
+            continue;
+        }
+
+        /* Greedy: whole sentences while they fit */
+        zend_long tokens = 0;
+        int32_t j = i;
+
+        while (j < n && s[j].words <= ck->max_tokens - tokens) {
+            tokens += s[j].words;
+            j++;
+        }
+
+        if (tokens > 0) {
+            chunk_emit(ck, s[i].start, s[j - 1].end, (int32_t) tokens);
+        }
+
+        if (j == n) {
+            break;
+        }
+
+        /* Overlap: trailing sentences of this chunk, within overlap words and leaving room for s[j] */
+        int32_t k = j;
+        zend_long carried = 0;
+
+        if (s[j].words <= ck->max_tokens) {
+            while (k - 1 > i && carried + s[k - 1].words <= ck->overlap
+                && carried + s[k - 1].words + s[j].words <= ck->max_tokens) {
+                carried += s[k - 1].words;
+                k--;
+            }
+        }
+
+        i = k;
+    }
+}
+
+void text_chunk_zval(zval *text, zval *locale, zend_long max_tokens, zend_long overlap, zend_bool hard, zend_bool offsets, zval *return_value)
+{
+    const char *fn = "chunk";
+
+    if (Z_TYPE_P(text) != IS_STRING || Z_TYPE_P(locale) != IS_STRING) {
+        zend_type_error("%s(): text and locale must be strings", fn);
+        return;
+    }
+
+    if (max_tokens < 1 || overlap < 0 || overlap >= max_tokens || max_tokens > INT32_MAX) {
+        zend_value_error("%s(): max_tokens must be > 0 and overlap between 0 and max_tokens - 1", fn);
+        return;
+    }
+
+    if (Z_STRLEN_P(text) > INT32_MAX) {
+        zend_value_error("%s(): text too large", fn);
+        return;
+    }
+
+    array_init(return_value);
+
+    if (Z_STRLEN_P(text) == 0) {
+        return;
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+    UBreakIterator *wbi = NULL, *sbi = NULL;
+    UText *ut = utext_openUTF8(NULL, Z_STRVAL_P(text), (int64_t) Z_STRLEN_P(text), &status);
+    chunker ck = {0};
+    int32_t word_capacity = 0, sentence_capacity = 0;
+
+    if (U_SUCCESS(status)) {
+        wbi = ubrk_open(UBRK_WORD, Z_STRVAL_P(locale), NULL, 0, &status);
+    }
+    if (U_SUCCESS(status) && !hard) {
+        sbi = ubrk_open(UBRK_SENTENCE, Z_STRVAL_P(locale), NULL, 0, &status);
+    }
+    if (U_SUCCESS(status)) {
+        ubrk_setUText(wbi, ut, &status);
+    }
+    if (U_SUCCESS(status) && sbi) {
+        ubrk_setUText(sbi, ut, &status);
+    }
+    if (U_FAILURE(status)) {
+        zend_value_error("%s(): failed to create break iterator (%s)", fn, u_errorName(status));
+        goto done;
+    }
+
+    /* One walk: words in order, each sentence taking the words that start in it */
+    int32_t sentence_start = sbi ? ubrk_first(sbi) : 0;
+    int32_t sentence_end = sbi ? ubrk_next(sbi) : UBRK_DONE;
+    int32_t start = ubrk_first(wbi);
+
+    for (int32_t end = ubrk_next(wbi); end != UBRK_DONE; start = end, end = ubrk_next(wbi)) {
+        if (ubrk_getRuleStatus(wbi) == UBRK_WORD_NONE) {
+            continue;
+        }
+
+        while (sbi && sentence_end != UBRK_DONE && start >= sentence_end) {
+            sentence_start = sentence_end;
+            sentence_end = ubrk_next(sbi);
+        }
+
+        if (sbi && (ck.sentence_count == 0 || ck.sentences[ck.sentence_count - 1].start != sentence_start)) {
+            CHUNK_APPEND(ck.sentences, ck.sentence_count, sentence_capacity, 64);
+            ck.sentences[ck.sentence_count].start = sentence_start;
+            ck.sentences[ck.sentence_count].end = chunk_trim(ut, sentence_start, sentence_end == UBRK_DONE ? (int32_t) Z_STRLEN_P(text) : sentence_end);
+            ck.sentences[ck.sentence_count].first_word = ck.word_count;
+            ck.sentences[ck.sentence_count].words = 0;
+            ck.sentence_count++;
+        }
+
+        CHUNK_APPEND(ck.words, ck.word_count, word_capacity, 1024);
+        ck.words[ck.word_count].start = start;
+        ck.words[ck.word_count].end = end;
+        ck.word_count++;
+
+        if (sbi) {
+            ck.sentences[ck.sentence_count - 1].words++;
+        }
+    }
+
+    ck.text = Z_STRVAL_P(text);
+    ck.max_tokens = max_tokens;
+    ck.overlap = overlap;
+    ck.offsets = offsets;
+    ck.out = return_value;
+
+    if (hard) {
+        if (ck.word_count > 0) {
+            chunk_words(&ck, 0, ck.word_count, ck.words[0].start, ck.words[ck.word_count - 1].end);
+        }
+    } else {
+        chunk_sentences(&ck);
+    }
+
+done:
+    if (ck.words) {
+        efree(ck.words);
+    }
+    if (ck.sentences) {
+        efree(ck.sentences);
+    }
+    if (sbi) {
+        ubrk_close(sbi);
+    }
+    if (wbi) {
+        ubrk_close(wbi);
+    }
+    utext_close(ut);
+
+    if (EG(exception)) {
+        zval_ptr_dtor(return_value);
+        ZVAL_NULL(return_value);
+    }
+}
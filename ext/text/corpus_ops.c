@@ -0,0 +1,304 @@
+#include "../text_bridge.h"
+#include "../text_internal.h"
+
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+ * Corpora on disk. idfFromFiles() takes one document per file and
+ * idfFromCorpus() one document per line of a single file. Files are mapped
+ * read-only and walked front to back, so the kernel reads ahead and the
+ * process never holds more than a window of a file: the pipeline's UTF-16
+ * buffer is bounded by TEXT_CORPUS_WINDOW, and processed pages are released
+ * with MADV_DONTNEED (they stay in the page cache, which can evict them as
+ * needed). Corpora larger than RAM work the same way.
+ */
+
+/* ---------- Mapping ---------- */
+
+int text_corpus_map(text_mapped_file *mf, const char *path, const char *fn)
+{
+    char resolved[MAXPATHLEN];
+    struct stat st;
+    int fd;
+
+    memset(mf, 0, sizeof(*mf));
+
+    /* Relative paths resolve against PHP's working directory, which under
+     * ZTS is per request rather than the process's */
+    if (!expand_filepath(path, resolved)) {
+        zend_value_error("%s(): cannot open '%s'", fn, path);
+        return FAILURE;
+    }
+
+    if (php_check_open_basedir_ex(resolved, 0)) {
+        zend_value_error("%s(): '%s' is outside open_basedir", fn, path);
+        return FAILURE;
+    }
+
+    fd = open(resolved, O_RDONLY);
+    if (fd < 0) {
+        zend_value_error("%s(): cannot open '%s'", fn, path);
+        return FAILURE;
+    }
+
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        zend_value_error("%s(): '%s' is not a regular file", fn, path);
+        return FAILURE;
+    }
+
+    /* mmap() rejects empty files: an empty file is an empty document */
+    if (st.st_size > 0) {
+        void *data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED) {
+            close(fd);
+            zend_value_error("%s(): cannot map '%s'", fn, path);
+            return FAILURE;
+        }
+
+#ifdef MADV_SEQUENTIAL
+        madvise(data, (size_t) st.st_size, MADV_SEQUENTIAL);
+#endif
+
+        mf->data = (const char *) data;
+        mf->len = (size_t) st.st_size;
+    }
+
+    close(fd);
+
+    return SUCCESS;
+}
+
+void text_corpus_unmap(text_mapped_file *mf)
+{
+    if (mf->data) {
+        munmap((void *) mf->data, mf->len);
+    }
+
+    memset(mf, 0, sizeof(*mf));
+}
+
+/* Release the whole pages before offset, a window at a time */
+static void corpus_release(text_mapped_file *mf, size_t offset)
+{
+#ifdef MADV_DONTNEED
+    size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    size_t end = offset - offset % page;
+
+    if (end >= mf->released + TEXT_CORPUS_WINDOW) {
+        madvise((void *) (mf->data + mf->released), end - mf->released, MADV_DONTNEED);
+        mf->released = end;
+    }
+#endif
+}
+
+/*
+ * End of a window: after the last whitespace in its second half (no word
+ * spans it), else before the last UTF-8 lead byte. text[len] is readable.
+ */
+static size_t corpus_cut(const char *text, size_t len)
+{
+    for (size_t i = len; i > len / 2; i--) {
+        switch (text[i - 1]) {
+            case ' ': case '\t': case '\n': case '\r': case '\v': case '\f':
+                return i;
+        }
+    }
+
+    size_t i = len;
+
+    while (i > 0 && ((unsigned char) text[i] & 0xC0) == 0x80) {
+        i--;
+    }
+
+    return i > 0 ? i : len;
+}
+
+int text_corpus_run(text_pipeline *tp, text_mapped_file *mf, const char *text, size_t len, text_token_fn cb, void *ctx, const char *fn)
+{
+    /* Word n-grams continue across windows, not across documents */
+    text_ngrams_reset(&tp->ngrams);
+
+    while (len > TEXT_CORPUS_WINDOW) {
+        size_t cut = corpus_cut(text, TEXT_CORPUS_WINDOW);
+
+        if (text_pipeline_feed(tp, text, cut, cb, ctx, fn) == FAILURE) {
+            return FAILURE;
+        }
+
+        text += cut;
+        len -= cut;
+        corpus_release(mf, (size_t) (text - mf->data));
+    }
+
+    if (text_pipeline_feed(tp, text, len, cb, ctx, fn) == FAILURE) {
+        return FAILURE;
+    }
+
+    if (len > 0) {
+        corpus_release(mf, (size_t) (text + len - mf->data));
+    }
+
+    return SUCCESS;
+}
+
+/* ---------- Document frequency ---------- */
+
+typedef struct {
+    HashTable terms;        /* term => slot, keys as in a PHP array */
+    uint32_t *df;
+    uint32_t *last_doc;     /* 1-based document that last touched the slot */
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t doc;
+} corpus_df;
+
+static void corpus_count_token(const char *token, size_t len, void *ctx)
+{
+    corpus_df *cd = (corpus_df *) ctx;
+    zval *found = zend_symtable_str_find(&cd->terms, token, len);
+    uint32_t slot;
+
+    if (found) {
+        slot = (uint32_t) Z_LVAL_P(found);
+    } else {
+        zval zv;
+
+        if (cd->count == cd->capacity) {
+            cd->capacity = cd->capacity ? cd->capacity * 2 : 1024;
+            cd->df = erealloc(cd->df, sizeof(uint32_t) * cd->capacity);
+            cd->last_doc = erealloc(cd->last_doc, sizeof(uint32_t) * cd->capacity);
+        }
+
+        slot = cd->count++;
+        ZVAL_LONG(&zv, slot);
+        zend_symtable_str_update(&cd->terms, token, len, &zv);
+
+        cd->df[slot] = 0;
+        cd->last_doc[slot] = 0;
+    }
+
+    if (cd->last_doc[slot] != cd->doc) {
+        cd->last_doc[slot] = cd->doc;
+        cd->df[slot]++;
+    }
+}
+
+/* One document per line; a trailing newline does not start another one */
+static int corpus_count_lines(text_pipeline *tp, corpus_df *cd, text_mapped_file *mf, const char *fn)
+{
+    const char *p = mf->data;
+    const char *end = p + mf->len;
+
+    while (p < end) {
+        const char *nl = memchr(p, '\n', (size_t) (end - p));
+        size_t len = nl ? (size_t) (nl - p) : (size_t) (end - p);
+        size_t doc_len = (len > 0 && p[len - 1] == '\r') ? len - 1 : len;
+
+        cd->doc++;
+        if (text_corpus_run(tp, mf, p, doc_len, corpus_count_token, cd, fn) == FAILURE) {
+            return FAILURE;
+        }
+
+        p += nl ? len + 1 : len;
+    }
+
+    return SUCCESS;
+}
+
+static int corpus_count_file(text_pipeline *tp, corpus_df *cd, zval *path, zend_bool lines, const char *fn)
+{
+    text_mapped_file mf;
+    int result;
+
+    if (Z_TYPE_P(path) != IS_STRING) {
+        zend_type_error("%s(): paths must be strings", fn);
+        return FAILURE;
+    }
+
+    if (strlen(Z_STRVAL_P(path)) != Z_STRLEN_P(path)) {
+        zend_value_error("%s(): path must not contain null bytes", fn);
+        return FAILURE;
+    }
+
+    if (text_corpus_map(&mf, Z_STRVAL_P(path), fn) == FAILURE) {
+        return FAILURE;
+    }
+
+    if (lines) {
+        result = corpus_count_lines(tp, cd, &mf, fn);
+    } else {
+        cd->doc++;
+        result = text_corpus_run(tp, &mf, mf.data, mf.len, corpus_count_token, cd, fn);
+    }
+
+    text_corpus_unmap(&mf);
+
+    return result;
+}
+
+void text_corpus_idf_zval(zval *source, zend_bool lines, zval *options, zend_bool smooth, zval *return_value)
+{
+    const char *fn = lines ? "idfFromCorpus" : "idfFromFiles";
+
+    if (lines ? Z_TYPE_P(source) != IS_STRING : Z_TYPE_P(source) != IS_ARRAY) {
+        zend_type_error(lines ? "%s(): path must be a string" : "%s(): paths must be an array of strings", fn);
+        return;
+    }
+
+    text_pipeline tp;
+    corpus_df cd = {0};
+
+    if (text_pipeline_open(&tp, options, fn) == FAILURE) {
+        return;
+    }
+
+    zend_hash_init(&cd.terms, 1024, NULL, NULL, 0);
+
+    if (lines) {
+        corpus_count_file(&tp, &cd, source, 1, fn);
+    } else {
+        zval *path;
+
+        ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(source), path) {
+            if (corpus_count_file(&tp, &cd, path, 0, fn) == FAILURE) {
+                break;
+            }
+        } ZEND_HASH_FOREACH_END();
+    }
+
+    text_pipeline_close(&tp);
+
+    if (!EG(exception)) {
+        /* Same formulas and key order as Text::idf() */
+        double n = (double) cd.doc;
+        zend_string *key;
+        zend_ulong idx;
+        zval *slot;
+        zval score;
+
+        array_init_size(return_value, cd.count);
+
+        ZEND_HASH_FOREACH_KEY_VAL(&cd.terms, idx, key, slot) {
+            double d = (double) cd.df[Z_LVAL_P(slot)];
+
+            ZVAL_DOUBLE(&score, smooth ? log((n + 1.0) / (d + 1.0)) + 1.0 : log(n / d));
+            if (key) {
+                zend_hash_add_new(Z_ARRVAL_P(return_value), key, &score);
+            } else {
+                zend_hash_index_add_new(Z_ARRVAL_P(return_value), idx, &score);
+            }
+        } ZEND_HASH_FOREACH_END();
+    }
+
+    zend_hash_destroy(&cd.terms);
+    if (cd.df) {
+        efree(cd.df);
+        efree(cd.last_doc);
+    }
+}
@@ -0,0 +1,246 @@
+#include "../text_bridge.h"
+#include "../text_internal.h"
+#include "../scratch.h"
+
+
+/*
+ * Feature hashing ("hashing trick").
+ *
+ * Every token produced by the pipeline is hashed with MurmurHash3; the low
+ * bits pick one of 2^bits columns and, with alternate_sign, the top bit picks
+ * the sign, so collisions cancel out in expectation instead of piling up.
+ * No vocabulary is kept: memory is bounded by the number of tokens in one
+ * document, whatever the size of the corpus.
+ */
+
+/* ---------- MurmurHash3 x86_32 ---------- */
+
+static zend_always_inline uint32_t murmur_rotl32(uint32_t x, int r)
+{
+    return (x << r) | (x >> (32 - r));
+}
+
+uint32_t text_murmur3_32(const char *key, size_t len, uint32_t seed)
+{
+    const unsigned char *data = (const unsigned char *) key;
+    const size_t nblocks = len / 4;
+    const uint32_t c1 = 0xcc9e2d51;
+    const uint32_t c2 = 0x1b873593;
+    uint32_t h = seed;
+    uint32_t k;
+
+    for (size_t i = 0; i < nblocks; i++) {
+        memcpy(&k, data + i * 4, sizeof(k));
+
+        k *= c1;
+        k = murmur_rotl32(k, 15);
+        k *= c2;
+
+        h ^= k;
+        h = murmur_rotl32(h, 13);
+        h = h * 5 + 0xe6546b64;
+    }
+
+    const unsigned char *tail = data + nblocks * 4;
+    k = 0;
+
+    switch (len & 3) {
+        case 3: k ^= (uint32_t) tail[2] << 16; /* fallthrough */
+        case 2: k ^= (uint32_t) tail[1] << 8;  /* fallthrough */
+        case 1:
+            k ^= tail[0];
+            k *= c1;
+            k = murmur_rotl32(k, 15);
+            k *= c2;
+            h ^= k;
+    }
+
+    h ^= (uint32_t) len;
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+
+    return h;
+}
+
+/* ---------- Accumulation ---------- */
+
+typedef struct {
+    text_sparse vec;
+    uint32_t mask;
+    uint32_t seed;
+    zend_bool alternate_sign;
+} hash_state;
+
+static void hash_token(const char *token, size_t len, void *ctx)
+{
+    hash_state *hs = (hash_state *) ctx;
+    uint32_t h = text_murmur3_32(token, len, hs->seed);
+
+    text_sparse_push(&hs->vec, h & hs->mask, (hs->alternate_sign && (h >> 31)) ? -1.0f : 1.0f);
+}
+
+/* ---------- Output ---------- */
+
+static void hash_emit_dense(const text_sparse *vec, size_t dims, zval *out)
+{
+    size_t next = 0;
+
+    array_init_size(out, (uint32_t) dims);
+
+    for (size_t col = 0; col < dims; col++) {
+        double v = 0.0;
+
+        if (next < vec->count && vec->entries[next].index == col) {
+            v = (double) vec->entries[next++].value;
+        }
+        add_next_index_double(out, v);
+    }
+}
+
+static void hash_emit_packed(const text_sparse *vec, float *row)
+{
+    for (size_t i = 0; i < vec->count; i++) {
+        row[vec->entries[i].index] = vec->entries[i].value;
+    }
+}
+
+/* ---------- Bridge ---------- */
+
+static int hash_document(text_pipeline *tp, hash_state *hs, zval *doc, int tf, int norm)
+{
+    if (Z_TYPE_P(doc) != IS_STRING) {
+        zend_type_error("hashVectorize(): documents must be strings");
+        return FAILURE;
+    }
+
+    hs->vec.count = 0;
+
+    if (text_pipeline_run(tp, Z_STRVAL_P(doc), Z_STRLEN_P(doc), hash_token, hs, "hashVectorize") == FAILURE) {
+        return FAILURE;
+    }
+
+    text_sparse_finish(&hs->vec, tf, NULL, norm);
+
+    return SUCCESS;
+}
+
+void text_hash_vectorize_zval(
+    zval *text,
+    zval *options,
+    int bits,
+    zend_bool alternate_sign,
+    int tf,
+    int norm,
+    zend_long seed,
+    int output,
+    zval *return_value
+) {
+    if (Z_TYPE_P(text) != IS_STRING && Z_TYPE_P(text) != IS_ARRAY) {
+        zend_type_error("hashVectorize(): text must be a string or an array of strings");
+        return;
+    }
+
+    if (bits < 1 || bits > TEXT_HASH_MAX_BITS) {
+        zend_value_error("hashVectorize(): bits must be between 1 and %d", TEXT_HASH_MAX_BITS);
+        return;
+    }
+
+    if (tf != TEXT_TF_RAW && tf != TEXT_TF_LOG && tf != TEXT_TF_BINARY) {
+        zend_value_error("hashVectorize(): invalid tf weighting");
+        return;
+    }
+
+    if (norm != TEXT_NORM_NONE && norm != TEXT_NORM_L1 && norm != TEXT_NORM_L2) {
+        zend_value_error("hashVectorize(): invalid norm");
+        return;
+    }
+
+    if (output != TEXT_OUTPUT_SPARSE && output != TEXT_OUTPUT_DENSE && output != TEXT_OUTPUT_PACKED) {
+        zend_value_error("hashVectorize(): invalid output");
+        return;
+    }
+
+    text_pipeline tp;
+    hash_state hs = {0};
+    size_t dims = (size_t) 1 << bits;
+
+    hs.mask = (uint32_t) (dims - 1);
+    hs.seed = (uint32_t) seed;
+    hs.alternate_sign = alternate_sign;
+
+    if (text_pipeline_open(&tp, options, "hashVectorize") == FAILURE) {
+        return;
+    }
+
+    if (Z_TYPE_P(text) == IS_STRING) {
+        if (hash_document(&tp, &hs, text, tf, norm) == SUCCESS) {
+            if (output == TEXT_OUTPUT_SPARSE) {
+                text_sparse_emit(&hs.vec, return_value);
+            } else if (output == TEXT_OUTPUT_DENSE) {
+                hash_emit_dense(&hs.vec, dims, return_value);
+            } else {
+                zend_string *packed = zend_string_alloc(dims * sizeof(float), 0);
+
+                memset(ZSTR_VAL(packed), 0, dims * sizeof(float));
+                hash_emit_packed(&hs.vec, (float *) ZSTR_VAL(packed));
+                ZVAL_NEW_STR(return_value, packed);
+            }
+        }
+    } else if (output == TEXT_OUTPUT_PACKED) {
+        /* One row per document, in iteration order */
+        size_t rows = zend_hash_num_elements(Z_ARRVAL_P(text));
+        zend_string *packed = zend_string_alloc(rows * dims * sizeof(float), 0);
+        float *row = (float *) ZSTR_VAL(packed);
+        zval *doc;
+
+        memset(row, 0, rows * dims * sizeof(float));
+
+        ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(text), doc) {
+            if (hash_document(&tp, &hs, doc, tf, norm) == FAILURE) {
+                zend_string_release(packed);
+                packed = NULL;
+                break;
+            }
+            hash_emit_packed(&hs.vec, row);
+            row += dims;
+        } ZEND_HASH_FOREACH_END();
+
+        if (packed) {
+            ZVAL_NEW_STR(return_value, packed);
+        }
+    } else {
+        /* One vector per document, keys preserved */
+        zend_string *key;
+        zend_ulong idx;
+        zval *doc;
+        zval vec;
+
+        array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(text)));
+
+        ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(text), idx, key, doc) {
+            if (hash_document(&tp, &hs, doc, tf, norm) == FAILURE) {
+                zval_ptr_dtor(return_value);
+                ZVAL_NULL(return_value);
+                break;
+            }
+
+            if (output == TEXT_OUTPUT_SPARSE) {
+                text_sparse_emit(&hs.vec, &vec);
+            } else {
+                hash_emit_dense(&hs.vec, dims, &vec);
+            }
+
+            if (key) {
+                zend_hash_update(Z_ARRVAL_P(return_value), key, &vec);
+            } else {
+                zend_hash_index_update(Z_ARRVAL_P(return_value), idx, &vec);
+            }
+        } ZEND_HASH_FOREACH_END();
+    }
+
+    text_sparse_free(&hs.vec);
+    text_pipeline_close(&tp);
+}
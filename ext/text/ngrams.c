@@ -0,0 +1,217 @@
+#include "../text_internal.h"
+#include "../scratch.h"
+
+#include <unicode/utext.h>
+
+/*
+ * Word and character n-grams, generated from the pipeline's terms without
+ * a PHP string per term: word n-grams are suffixes of a small sliding
+ * window, character n-grams are slices of the (padded) term between
+ * grapheme boundaries.
+ */
+
+/* ---------- Options ---------- */
+
+static int ngram_range(zval *options, const char *key, size_t key_len, int *min, int *max, const char *fn)
+{
+    zval *value;
+
+    *min = *max = 0;
+
+    if (!options || Z_TYPE_P(options) != IS_ARRAY
+        || (value = zend_hash_str_find(Z_ARRVAL_P(options), key, key_len)) == NULL
+        || Z_TYPE_P(value) == IS_NULL) {
+        return SUCCESS;
+    }
+
+    if (Z_TYPE_P(value) == IS_LONG) {
+        *min = *max = (int) Z_LVAL_P(value);
+    } else if (Z_TYPE_P(value) == IS_ARRAY && zend_hash_num_elements(Z_ARRVAL_P(value)) == 2) {
+        zval *bounds[2];
+        int i = 0;
+        zval *bound;
+
+        ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(value), bound) {
+            bounds[i++] = bound;
+        } ZEND_HASH_FOREACH_END();
+
+        if (Z_TYPE_P(bounds[0]) != IS_LONG || Z_TYPE_P(bounds[1]) != IS_LONG) {
+            zend_type_error("%s(): option '%s' must be an int or [min, max]", fn, key);
+            return FAILURE;
+        }
+        *min = (int) Z_LVAL_P(bounds[0]);
+        *max = (int) Z_LVAL_P(bounds[1]);
+    } else {
+        zend_type_error("%s(): option '%s' must be an int or [min, max]", fn, key);
+        return FAILURE;
+    }
+
+    if (*min < 1 || *max < *min || *max > TEXT_NGRAM_MAX) {
+        zend_value_error("%s(): option '%s' must satisfy 1 <= min <= max <= %d", fn, key, TEXT_NGRAM_MAX);
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
+
+int text_ngrams_options(text_ngrams *ng, zval *options, const char *fn)
+{
+    if (ngram_range(options, ZEND_STRL("ngrams"), &ng->word_min, &ng->word_max, fn) == FAILURE
+        || ngram_range(options, ZEND_STRL("char_ngrams"), &ng->char_min, &ng->char_max, fn) == FAILURE) {
+        return FAILURE;
+    }
+
+    if (ng->word_max > 0 && ng->char_max > 0) {
+        zend_value_error("%s(): options 'ngrams' and 'char_ngrams' cannot be combined", fn);
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
+
+int text_ngrams_open(text_ngrams *ng, const char *fn)
+{
+    if (ng->char_max > 0) {
+        UErrorCode status = U_ZERO_ERROR;
+
+        ng->graphemes = ubrk_open(UBRK_CHARACTER, NULL, NULL, 0, &status);
+        if (U_FAILURE(status) || !ng->graphemes) {
+            zend_value_error("%s(): failed to create character break iterator", fn);
+            return FAILURE;
+        }
+    }
+
+    return SUCCESS;
+}
+
+void text_ngrams_reset(text_ngrams *ng)
+{
+    ng->window_len = 0;
+    ng->terms = 0;
+}
+
+void text_ngrams_close(text_ngrams *ng)
+{
+    if (ng->graphemes) {
+        ubrk_close(ng->graphemes);
+    }
+    if (ng->window) {
+        efree(ng->window);
+    }
+
+    ng->graphemes = NULL;
+    ng->window = NULL;
+    ng->window_capacity = 0;
+    text_ngrams_reset(ng);
+}
+
+/* ---------- Word n-grams ---------- */
+
+static void ngram_words(text_ngrams *ng, const char *term, size_t len, text_token_fn cb, void *ctx)
+{
+    if (ng->word_max == 1) {
+        cb(term, len, ctx);
+        return;
+    }
+
+    /* Drop the oldest term once the window holds word_max of them */
+    if (ng->terms == ng->word_max) {
+        size_t shift = ng->starts[1];
+
+        memmove(ng->window, ng->window + shift, ng->window_len - shift);
+        ng->window_len -= shift;
+        for (int i = 1; i < ng->terms; i++) {
+            ng->starts[i - 1] = ng->starts[i] - shift;
+        }
+        ng->terms--;
+    }
+
+    size_t needed = ng->window_len + len + 1;
+
+    if (needed > ng->window_capacity) {
+        ng->window_capacity = MAX(needed, ng->window_capacity * 2);
+        ng->window = erealloc(ng->window, ng->window_capacity);
+    }
+
+    if (ng->terms > 0) {
+        ng->window[ng->window_len++] = ' ';
+    }
+    ng->starts[ng->terms++] = ng->window_len;
+    memcpy(ng->window + ng->window_len, term, len);
+    ng->window_len += len;
+
+    for (int n = ng->word_min; n <= ng->word_max && n <= ng->terms; n++) {
+        size_t start = ng->starts[ng->terms - n];
+
+        cb(ng->window + start, ng->window_len - start, ctx);
+    }
+}
+
+/* ---------- Character n-grams ---------- */
+
+static void ngram_chars(text_ngrams *ng, const char *term, size_t len, text_token_fn cb, void *ctx)
+{
+    cm_scratch_pos mark = cm_scratch_mark();
+    size_t padded_len = len + 2;
+    char *padded = (char *) cm_scratch_alloc(padded_len);
+    int32_t *bounds = (int32_t *) cm_scratch_alloc(sizeof(int32_t) * (padded_len + 1));
+    int32_t count = 0;
+    zend_bool ascii = 1;
+
+    padded[0] = ' ';
+    memcpy(padded + 1, term, len);
+    padded[padded_len - 1] = ' ';
+
+    for (size_t i = 0; i < len; i++) {
+        if ((unsigned char) term[i] >= 0x80) {
+            ascii = 0;
+            break;
+        }
+    }
+
+    if (ascii) {
+        /* Every ASCII byte is a grapheme (terms never hold CR LF) */
+        for (size_t i = 0; i <= padded_len; i++) {
+            bounds[count++] = (int32_t) i;
+        }
+    } else {
+        /* Break the UTF-8 directly: boundaries come back as byte offsets.
+         * The UText lives on the stack, so no term allocates one */
+        UErrorCode status = U_ZERO_ERROR;
+        UText ut = UTEXT_INITIALIZER;
+
+        utext_openUTF8(&ut, padded, (int64_t) padded_len, &status);
+        if (U_SUCCESS(status)) {
+            ubrk_setUText(ng->graphemes, &ut, &status);
+        }
+        if (U_SUCCESS(status)) {
+            for (int32_t b = ubrk_first(ng->graphemes); b != UBRK_DONE; b = ubrk_next(ng->graphemes)) {
+                bounds[count++] = b;
+            }
+        }
+        utext_close(&ut);
+
+        if (U_FAILURE(status)) {
+            cm_scratch_release(mark);
+            return;
+        }
+    }
+
+    /* count - 1 graphemes */
+    for (int n = ng->char_min; n <= ng->char_max; n++) {
+        for (int32_t i = 0; i + n < count; i++) {
+            cb(padded + bounds[i], (size_t) (bounds[i + n] - bounds[i]), ctx);
+        }
+    }
+
+    cm_scratch_release(mark);
+}
+
+void text_ngrams_push(text_ngrams *ng, const char *term, size_t len, text_token_fn cb, void *ctx)
+{
+    if (ng->char_max > 0) {
+        ngram_chars(ng, term, len, cb, ctx);
+    } else {
+        ngram_words(ng, term, len, cb, ctx);
+    }
+}
@@ -0,0 +1,526 @@
+#include "../text_internal.h"
+#include "../icu_bridge.h"
+#include "../scratch.h"
+#include "../libstemmer/include/libstemmer.h"
+
+#include <unicode/ustring.h>
+
+/*
+ * Native version of the per-token loop in Text::termFrequency(): the text is
+ * converted to UTF-16 once, broken into words, filtered by category (rule
+ * status) and length, and every remaining word goes through strip_numbers,
+ * stop_words, remove_diacritics, lowercase and stem in that order, then
+ * optionally into word or character n-grams. Filtered segments are never
+ * converted to UTF-8. ASCII words skip ICU for the diacritics and
+ * lowercase steps. Intermediate buffers come from the scratch arena; the
+ * break iterator, transliterator and stemmer are opened once per pipeline,
+ * so a batch of documents shares them.
+ */
+
+/* ---------- Options ---------- */
+
+static zval *pipeline_option(zval *options, const char *key, size_t len)
+{
+    if (!options || Z_TYPE_P(options) != IS_ARRAY) {
+        return NULL;
+    }
+
+    return zend_hash_str_find(Z_ARRVAL_P(options), key, len);
+}
+
+static zend_bool pipeline_flag(zval *options, const char *key, size_t len, zend_bool def)
+{
+    zval *value = pipeline_option(options, key, len);
+
+    return value ? zend_is_true(value) : def;
+}
+
+void text_pipeline_defaults(text_pipeline *tp)
+{
+    memset(tp, 0, sizeof(*tp));
+
+    tp->locale = "en_US";
+    tp->lowercase = 1;
+}
+
+/* types option: a category name or a list of them */
+static const struct {
+    const char *name;
+    uint32_t type;
+} pipeline_type_names[] = {
+    { "number", TEXT_TYPE_NUMBER },
+    { "letter", TEXT_TYPE_LETTER },
+    { "kana",   TEXT_TYPE_KANA },
+    { "ideo",   TEXT_TYPE_IDEO },
+    { "other",  TEXT_TYPE_OTHER },
+    { NULL, 0 }
+};
+
+static int pipeline_type_add(text_pipeline *tp, zval *name, const char *fn)
+{
+    if (Z_TYPE_P(name) != IS_STRING) {
+        zend_type_error("%s(): option 'types' must be a string or an array of strings", fn);
+        return FAILURE;
+    }
+
+    for (size_t i = 0; pipeline_type_names[i].name; i++) {
+        if (strcasecmp(Z_STRVAL_P(name), pipeline_type_names[i].name) == 0) {
+            tp->types |= pipeline_type_names[i].type;
+            return SUCCESS;
+        }
+    }
+
+    zend_value_error("%s(): unknown token type '%s' (number, letter, kana, ideo, other)", fn, Z_STRVAL_P(name));
+    return FAILURE;
+}
+
+static int pipeline_length(zval *options, const char *key, size_t len, int32_t *out, const char *fn)
+{
+    zval *value = pipeline_option(options, key, len);
+
+    *out = 0;
+
+    if (!value || Z_TYPE_P(value) == IS_NULL) {
+        return SUCCESS;
+    }
+
+    if (Z_TYPE_P(value) != IS_LONG) {
+        zend_type_error("%s(): option '%s' must be an int", fn, key);
+        return FAILURE;
+    }
+
+    if (Z_LVAL_P(value) < 0 || Z_LVAL_P(value) > INT32_MAX) {
+        zend_value_error("%s(): option '%s' must not be negative", fn, key);
+        return FAILURE;
+    }
+
+    *out = (int32_t) Z_LVAL_P(value);
+
+    return SUCCESS;
+}
+
+int text_pipeline_filter_options(text_pipeline *tp, zval *options, const char *fn)
+{
+    zval *value;
+
+    tp->strip_numbers = pipeline_flag(options, ZEND_STRL("strip_numbers"), 0);
+    tp->stop_option = pipeline_option(options, ZEND_STRL("stop_words"));
+
+    if ((value = pipeline_option(options, ZEND_STRL("break_rules"))) != NULL && Z_TYPE_P(value) != IS_NULL) {
+        if (Z_TYPE_P(value) != IS_STRING) {
+            zend_type_error("%s(): option 'break_rules' must be a string", fn);
+            return FAILURE;
+        }
+        tp->break_rules = Z_STRVAL_P(value);
+    }
+
+    if ((value = pipeline_option(options, ZEND_STRL("types"))) != NULL && Z_TYPE_P(value) != IS_NULL) {
+        if (Z_TYPE_P(value) == IS_ARRAY) {
+            zval *name;
+
+            ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(value), name) {
+                if (pipeline_type_add(tp, name, fn) == FAILURE) {
+                    return FAILURE;
+                }
+            } ZEND_HASH_FOREACH_END();
+        } else if (pipeline_type_add(tp, value, fn) == FAILURE) {
+            return FAILURE;
+        }
+    }
+
+    if (pipeline_length(options, ZEND_STRL("min_length"), &tp->min_length, fn) == FAILURE
+        || pipeline_length(options, ZEND_STRL("max_length"), &tp->max_length, fn) == FAILURE) {
+        return FAILURE;
+    }
+
+    if (tp->max_length > 0 && tp->max_length < tp->min_length) {
+        zend_value_error("%s(): option 'max_length' must not be less than 'min_length'", fn);
+        return FAILURE;
+    }
+
+    return text_ngrams_options(&tp->ngrams, options, fn);
+}
+
+int text_pipeline_options(text_pipeline *tp, zval *options, const char *fn)
+{
+    zval *value;
+
+    if ((value = pipeline_option(options, ZEND_STRL("locale"))) != NULL) {
+        if (Z_TYPE_P(value) != IS_STRING) {
+            zend_type_error("%s(): option 'locale' must be a string", fn);
+            return FAILURE;
+        }
+        tp->locale = Z_STRVAL_P(value);
+    }
+
+    tp->lowercase = pipeline_flag(options, ZEND_STRL("lowercase"), 1);
+    tp->remove_diacritics = pipeline_flag(options, ZEND_STRL("remove_diacritics"), 0);
+
+    if (pipeline_flag(options, ZEND_STRL("stem"), 0)) {
+        tp->stem_language = "english";
+        if ((value = pipeline_option(options, ZEND_STRL("stem_language"))) != NULL) {
+            if (Z_TYPE_P(value) != IS_STRING) {
+                zend_type_error("%s(): option 'stem_language' must be a string", fn);
+                return FAILURE;
+            }
+            tp->stem_language = Z_STRVAL_P(value);
+        }
+    }
+
+    return text_pipeline_filter_options(tp, options, fn);
+}
+
+int text_pipeline_start(text_pipeline *tp, const char *fn)
+{
+    UErrorCode status = U_ZERO_ERROR;
+
+    tp->simple_case = icu_locale_simple_case(tp->locale);
+
+    if (tp->break_rules) {
+        tp->bi = text_break_rules_open(tp->break_rules, fn);
+        if (!tp->bi) {
+            text_pipeline_close(tp);
+            return FAILURE;
+        }
+    } else {
+        tp->bi = ubrk_open(UBRK_WORD, tp->locale, NULL, 0, &status);
+        if (U_FAILURE(status) || !tp->bi) {
+            zend_value_error("%s(): failed to create break iterator (invalid locale?)", fn);
+            text_pipeline_close(tp);
+            return FAILURE;
+        }
+    }
+
+    if (tp->remove_diacritics) {
+        tp->trans = icu_open_diacritics_transliterator(&status);
+        if (U_FAILURE(status) || !tp->trans) {
+            zend_value_error("%s(): failed to create transliterator", fn);
+            text_pipeline_close(tp);
+            return FAILURE;
+        }
+    }
+
+    if (tp->stem_language) {
+        tp->stemmer = sb_stemmer_new(tp->stem_language, "UTF_8");
+        if (!tp->stemmer) {
+            zend_value_error("%s(): unsupported stem_language '%s'", fn, tp->stem_language);
+            text_pipeline_close(tp);
+            return FAILURE;
+        }
+    }
+
+    if (text_stop_words_open(&tp->stop, tp->stop_option, tp->stem_language, tp->locale, fn) == FAILURE
+        || text_ngrams_open(&tp->ngrams, fn) == FAILURE) {
+        text_pipeline_close(tp);
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
+
+int text_pipeline_open(text_pipeline *tp, zval *options, const char *fn)
+{
+    text_pipeline_defaults(tp);
+
+    if (text_pipeline_options(tp, options, fn) == FAILURE) {
+        return FAILURE;
+    }
+
+    return text_pipeline_start(tp, fn);
+}
+
+void text_pipeline_close(text_pipeline *tp)
+{
+    if (tp->bi) {
+        ubrk_close(tp->bi);
+    }
+    if (tp->trans) {
+        utrans_close(tp->trans);
+    }
+    if (tp->stemmer) {
+        sb_stemmer_delete(tp->stemmer);
+    }
+    text_stop_words_close(&tp->stop);
+    text_ngrams_close(&tp->ngrams);
+
+    tp->bi = NULL;
+    tp->trans = NULL;
+    tp->stemmer = NULL;
+}
+
+/* ---------- Tokens ---------- */
+
+/* UTF-16 to UTF-8 in the scratch arena: at most 3 bytes per UTF-16 unit. NULL after raising an error */
+static char *pipeline_to_u8(const UChar *u16, int32_t u16_len, int32_t *u8_len, UErrorCode *status, const char *fn)
+{
+    size_t capacity = (size_t) u16_len * 3 + 1;
+
+    if (capacity > INT32_MAX) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+        zend_value_error("%s(): word is too long", fn);
+        return NULL;
+    }
+
+    char *u8 = (char*) cm_scratch_alloc(capacity);
+
+    u_strToUTF8(u8, (int32_t) capacity, u8_len, u16, u16_len, status);
+
+    return u8;
+}
+
+static UChar *pipeline_lower(text_pipeline *tp, const UChar *term, int32_t len, int32_t *lower_len, UErrorCode *status)
+{
+    UChar *lower = (UChar*) cm_scratch_alloc(sizeof(UChar) * (len + 1));
+
+    *lower_len = u_strToLower(lower, len + 1, term, len, tp->locale, status);
+
+    if (*status == U_BUFFER_OVERFLOW_ERROR) {
+        *status = U_ZERO_ERROR;
+        lower = (UChar*) cm_scratch_alloc(sizeof(UChar) * (*lower_len + 1));
+        *lower_len = u_strToLower(lower, *lower_len + 1, term, len, tp->locale, status);
+    }
+
+    return lower;
+}
+
+/* ASCII words need neither ICU step: there are no marks to remove, and
+ * lowercasing is a byte map when the locale has no rules of its own for
+ * i/I. NULL when the word is not ASCII. */
+static char *pipeline_ascii_u8(const UChar *word, int32_t len, zend_bool lower)
+{
+    for (int32_t i = 0; i < len; i++) {
+        if (word[i] >= 0x80) {
+            return NULL;
+        }
+    }
+
+    char *u8 = (char*) cm_scratch_alloc(len + 1);
+
+    for (int32_t i = 0; i < len; i++) {
+        u8[i] = lower ? zend_tolower_ascii((unsigned char) word[i]) : (char) word[i];
+    }
+
+    return u8;
+}
+
+static int pipeline_is_stop_word(text_pipeline *tp, const UChar *word, int32_t len, zend_bool *stop, const char *fn)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    cm_scratch_pos mark = cm_scratch_mark();
+    int32_t u8_len = len;
+    char *u8 = tp->simple_case ? pipeline_ascii_u8(word, len, 1) : NULL;
+
+    if (!u8) {
+        int32_t lower_len = 0;
+        UChar *lower = pipeline_lower(tp, word, len, &lower_len, &status);
+
+        if (U_SUCCESS(status) && (u8 = pipeline_to_u8(lower, lower_len, &u8_len, &status, fn)) == NULL) {
+            cm_scratch_release(mark);
+            return FAILURE;
+        }
+    }
+
+    *stop = U_SUCCESS(status) && text_stop_words_contains(&tp->stop, u8, (size_t) u8_len);
+
+    cm_scratch_release(mark);
+
+    return SUCCESS;
+}
+
+/* FAILURE after raising an error; words ICU cannot convert are skipped */
+static int pipeline_token(text_pipeline *tp, const UChar *word, int32_t len, text_token_fn cb, void *ctx, const char *fn)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    cm_scratch_pos mark = cm_scratch_mark();
+    const UChar *term = word;
+    int32_t term_len = len;
+    int32_t u8_len = 0;
+    int result = SUCCESS;
+    zend_bool stop;
+    char *u8;
+
+    if (tp->strip_numbers) {
+        if ((u8 = pipeline_to_u8(word, len, &u8_len, &status, fn)) == NULL) {
+            result = FAILURE;
+            goto done;
+        }
+        if (U_FAILURE(status) || is_numeric_string(u8, u8_len, NULL, NULL, 0)) {
+            goto done;
+        }
+    }
+
+    /* Stop words match the lowercased word as written; when the term itself
+     * is not simply that, lowercase a copy for the check */
+    if (text_stop_words_active(&tp->stop) && (!tp->lowercase || tp->remove_diacritics)) {
+        if (pipeline_is_stop_word(tp, word, len, &stop, fn) == FAILURE) {
+            result = FAILURE;
+            goto done;
+        }
+        if (stop) {
+            goto done;
+        }
+    }
+
+    u8 = (!tp->lowercase || tp->simple_case) ? pipeline_ascii_u8(word, len, tp->lowercase) : NULL;
+    u8_len = len;
+
+    if (!u8) {
+        if (tp->remove_diacritics) {
+            int32_t capacity = len * 2 + 10;
+            int32_t limit = len;
+            UChar *buf = (UChar*) cm_scratch_alloc(sizeof(UChar) * capacity);
+
+            memcpy(buf, term, sizeof(UChar) * len);
+            utrans_transUChars(tp->trans, buf, &term_len, capacity, 0, &limit, &status);
+            if (U_FAILURE(status)) {
+                goto done;
+            }
+            term = buf;
+        }
+
+        if (tp->lowercase) {
+            int32_t lower_len = 0;
+            UChar *lower = pipeline_lower(tp, term, term_len, &lower_len, &status);
+
+            if (U_FAILURE(status)) {
+                goto done;
+            }
+            term = lower;
+            term_len = lower_len;
+        }
+
+        if ((u8 = pipeline_to_u8(term, term_len, &u8_len, &status, fn)) == NULL) {
+            result = FAILURE;
+            goto done;
+        }
+        if (U_FAILURE(status)) {
+            goto done;
+        }
+    }
+
+    if (text_stop_words_active(&tp->stop) && tp->lowercase && !tp->remove_diacritics) {
+        if (text_stop_words_contains(&tp->stop, u8, (size_t) u8_len)) {
+            goto done;
+        }
+    }
+
+    if (tp->stemmer) {
+        const sb_symbol *stemmed = sb_stemmer_stem(tp->stemmer, (const sb_symbol*) u8, u8_len);
+
+        if (stemmed) {
+            u8 = (char*) stemmed;
+            u8_len = sb_stemmer_length(tp->stemmer);
+        }
+    }
+
+    if (text_ngrams_active(&tp->ngrams)) {
+        text_ngrams_push(&tp->ngrams, u8, (size_t) u8_len, cb, ctx);
+    } else {
+        cb(u8, (size_t) u8_len, ctx);
+    }
+
+done:
+    cm_scratch_release(mark);
+
+    return result;
+}
+
+static zend_always_inline uint32_t pipeline_type(int32_t status)
+{
+    if (status >= UBRK_WORD_NUMBER && status < UBRK_WORD_NUMBER_LIMIT) {
+        return TEXT_TYPE_NUMBER;
+    }
+    if (status >= UBRK_WORD_LETTER && status < UBRK_WORD_LETTER_LIMIT) {
+        return TEXT_TYPE_LETTER;
+    }
+    if (status >= UBRK_WORD_KANA && status < UBRK_WORD_KANA_LIMIT) {
+        return TEXT_TYPE_KANA;
+    }
+    if (status >= UBRK_WORD_IDEO && status < UBRK_WORD_IDEO_LIMIT) {
+        return TEXT_TYPE_IDEO;
+    }
+
+    return TEXT_TYPE_OTHER;
+}
+
+/* Category and length filters: decided on the UTF-16 segment, before any conversion */
+static zend_always_inline zend_bool pipeline_keep(const text_pipeline *tp, int32_t status, const UChar *word, int32_t len)
+{
+    if (status == UBRK_WORD_NONE) {
+        return 0;
+    }
+
+    if (tp->types && !(tp->types & pipeline_type(status))) {
+        return 0;
+    }
+
+    if (tp->min_length > 0 || tp->max_length > 0) {
+        int32_t chars = u_countChar32(word, len);
+
+        if (chars < tp->min_length || (tp->max_length > 0 && chars > tp->max_length)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+int text_pipeline_run(text_pipeline *tp, const char *text, size_t len, text_token_fn cb, void *ctx, const char *fn)
+{
+    /* Word n-grams do not span documents */
+    text_ngrams_reset(&tp->ngrams);
+
+    return text_pipeline_feed(tp, text, len, cb, ctx, fn);
+}
+
+int text_pipeline_feed(text_pipeline *tp, const char *text, size_t len, text_token_fn cb, void *ctx, const char *fn)
+{
+    UErrorCode status = U_ZERO_ERROR;
+
+    if (len == 0) {
+        return SUCCESS;
+    }
+
+    if (len >= INT32_MAX) {
+        zend_value_error("%s(): text is too long", fn);
+        return FAILURE;
+    }
+
+    /* UTF-8 never takes more UTF-16 units than bytes */
+    cm_scratch_pos mark = cm_scratch_mark();
+    int32_t u16_len = 0;
+    UChar *u16 = (UChar*) cm_scratch_alloc(sizeof(UChar) * (len + 1));
+
+    u_strFromUTF8(u16, (int32_t) len + 1, &u16_len, text, (int32_t) len, &status);
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("%s(): UTF-8 to UTF-16 conversion failed", fn);
+        return FAILURE;
+    }
+
+    ubrk_setText(tp->bi, u16, u16_len, &status);
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("%s(): failed to set break iterator text", fn);
+        return FAILURE;
+    }
+
+    int32_t start = ubrk_first(tp->bi);
+    int32_t end = ubrk_next(tp->bi);
+
+    while (end != UBRK_DONE) {
+        /* UBRK_WORD_NONE = whitespace and punctuation */
+        if (pipeline_keep(tp, ubrk_getRuleStatus(tp->bi), u16 + start, end - start)
+            && pipeline_token(tp, u16 + start, end - start, cb, ctx, fn) == FAILURE) {
+            cm_scratch_release(mark);
+            return FAILURE;
+        }
+
+        start = end;
+        end = ubrk_next(tp->bi);
+    }
+
+    cm_scratch_release(mark);
+
+    return SUCCESS;
+}
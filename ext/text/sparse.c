@@ -0,0 +1,88 @@
+#include "../text_internal.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+static int sparse_entry_cmp(const void *a, const void *b)
+{
+    uint32_t ia = ((const text_sparse_entry *) a)->index;
+    uint32_t ib = ((const text_sparse_entry *) b)->index;
+
+    return (ia > ib) - (ia < ib);
+}
+
+void text_sparse_finish(text_sparse *sp, int tf, const float *idf, int norm)
+{
+    size_t n = 0;
+
+    qsort(sp->entries, sp->count, sizeof(text_sparse_entry), sparse_entry_cmp);
+
+    for (size_t i = 0; i < sp->count; i++) {
+        if (n > 0 && sp->entries[n - 1].index == sp->entries[i].index) {
+            sp->entries[n - 1].value += sp->entries[i].value;
+        } else {
+            sp->entries[n++] = sp->entries[i];
+        }
+    }
+
+    size_t kept = 0;
+    double total = 0.0;
+
+    for (size_t i = 0; i < n; i++) {
+        float v = sp->entries[i].value;
+
+        if (v == 0.0f) {
+            continue;
+        }
+
+        switch (tf) {
+            case TEXT_TF_LOG:
+                v = copysignf(log1pf(fabsf(v)), v);
+                break;
+
+            case TEXT_TF_BINARY:
+                v = copysignf(1.0f, v);
+                break;
+        }
+
+        if (idf) {
+            v *= idf[sp->entries[i].index];
+        }
+
+        total += norm == TEXT_NORM_L1 ? fabs((double) v) : (double) v * v;
+        sp->entries[kept].index = sp->entries[i].index;
+        sp->entries[kept].value = v;
+        kept++;
+    }
+
+    sp->count = kept;
+
+    if (norm != TEXT_NORM_NONE && total > 0.0) {
+        float scale = (float) (1.0 / (norm == TEXT_NORM_L2 ? sqrt(total) : total));
+
+        for (size_t i = 0; i < kept; i++) {
+            sp->entries[i].value *= scale;
+        }
+    }
+}
+
+/* index => value, ascending index */
+void text_sparse_emit(const text_sparse *sp, zval *out)
+{
+    array_init_size(out, (uint32_t) sp->count);
+
+    for (size_t i = 0; i < sp->count; i++) {
+        add_index_double(out, sp->entries[i].index, (double) sp->entries[i].value);
+    }
+}
+
+void text_sparse_free(text_sparse *sp)
+{
+    if (sp->entries) {
+        efree(sp->entries);
+    }
+
+    sp->entries = NULL;
+    sp->count = 0;
+    sp->capacity = 0;
+}
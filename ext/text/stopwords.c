@@ -0,0 +1,387 @@
+#include "../text_bridge.h"
+#include "../text_internal.h"
+#include "../scratch.h"
+
+#include <unicode/ustring.h>
+#include <pthread.h>
+
+/*
+ * Stop-word sets. Built-in lists are sorted tables compiled into the
+ * extension (stopwords_data.c) and searched in place; custom lists are
+ * lowercased once into a hash set, either for the duration of one call
+ * (stop_words => [...]) or for the life of the process
+ * (Text::registerStopWords()). Filtering happens inside the token pipeline,
+ * so dropped tokens never become PHP strings.
+ */
+
+/* Codes accepted for the built-in lists, as for libstemmer */
+static const struct {
+    const char *code;
+    const char *name;
+} stop_aliases[] = {
+    { "da", "danish" },     { "dan", "danish" },
+    { "de", "german" },     { "deu", "german" },     { "ger", "german" },
+    { "nl", "dutch" },      { "nld", "dutch" },      { "dut", "dutch" },
+    { "en", "english" },    { "eng", "english" },    { "porter", "english" },
+    { "es", "spanish" },    { "esl", "spanish" },    { "spa", "spanish" },
+    { "fi", "finnish" },    { "fin", "finnish" },
+    { "fr", "french" },     { "fra", "french" },     { "fre", "french" },
+    { "hu", "hungarian" },  { "hun", "hungarian" },
+    { "it", "italian" },    { "ita", "italian" },
+    { "no", "norwegian" },  { "nor", "norwegian" },  { "nb", "norwegian" },  { "nn", "norwegian" },
+    { "pt", "portuguese" }, { "por", "portuguese" },
+    { "ro", "romanian" },   { "ron", "romanian" },   { "rum", "romanian" },
+    { "ru", "russian" },    { "rus", "russian" },
+    { "sv", "swedish" },    { "swe", "swedish" },
+    { "tr", "turkish" },    { "tur", "turkish" },
+    { NULL, NULL }
+};
+
+/*
+ * Process-wide registry: name => persistent set of words, shared by all
+ * threads. The lock covers the registry only: a registered set is never
+ * modified. Registering the same words again keeps the current set, so a
+ * worker may register its lists on every request. A set replaced by other
+ * words is freed at once without ZTS, where no pipeline can be running
+ * during the call; with ZTS another thread may still filter with it, so it
+ * is retired until module shutdown, and at most STOP_RETIRED_MAX
+ * replacements are accepted.
+ */
+#define STOP_RETIRED_MAX 64
+
+static HashTable *stop_registry;
+#ifdef ZTS
+static HashTable *stop_retired;
+#endif
+static pthread_mutex_t stop_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const text_stop_list *stop_builtin(const char *name, size_t len)
+{
+    for (size_t i = 0; stop_aliases[i].code; i++) {
+        if (strlen(stop_aliases[i].code) == len && memcmp(stop_aliases[i].code, name, len) == 0) {
+            name = stop_aliases[i].name;
+            len = strlen(name);
+            break;
+        }
+    }
+
+    for (size_t i = 0; text_stop_lists[i].name; i++) {
+        if (strlen(text_stop_lists[i].name) == len && memcmp(text_stop_lists[i].name, name, len) == 0) {
+            return &text_stop_lists[i];
+        }
+    }
+
+    return NULL;
+}
+
+static HashTable *stop_registered(const char *name, size_t len)
+{
+    HashTable *set = NULL;
+
+    pthread_mutex_lock(&stop_registry_lock);
+    if (stop_registry) {
+        set = zend_hash_str_find_ptr(stop_registry, name, len);
+    }
+    pthread_mutex_unlock(&stop_registry_lock);
+
+    return set;
+}
+
+/* Lowercase a UTF-8 word and add it to the set. FAILURE after raising an error */
+static int stop_set_add(HashTable *set, const char *word, size_t len, const char *locale, const char *fn)
+{
+    UErrorCode status = U_ZERO_ERROR;
+
+    if (len == 0 || len >= INT32_MAX) {
+        return SUCCESS;
+    }
+
+    cm_scratch_pos mark = cm_scratch_mark();
+    int32_t u16_len = 0;
+    UChar *u16 = (UChar*) cm_scratch_alloc(sizeof(UChar) * (len + 1));
+
+    u_strFromUTF8(u16, (int32_t) len + 1, &u16_len, word, (int32_t) len, &status);
+
+    UChar *lower = (UChar*) cm_scratch_alloc(sizeof(UChar) * (u16_len + 1));
+    int32_t lower_len = u_strToLower(lower, u16_len + 1, u16, u16_len, locale, &status);
+
+    if (status == U_BUFFER_OVERFLOW_ERROR) {
+        status = U_ZERO_ERROR;
+        lower = (UChar*) cm_scratch_alloc(sizeof(UChar) * (lower_len + 1));
+        lower_len = u_strToLower(lower, lower_len + 1, u16, u16_len, locale, &status);
+    }
+
+    /* At most 3 bytes per UTF-16 unit */
+    int32_t u8_len = 0;
+    size_t capacity = (size_t) lower_len * 3 + 1;
+
+    if (capacity > INT32_MAX) {
+        cm_scratch_release(mark);
+        zend_value_error("%s(): stop word is too long", fn);
+        return FAILURE;
+    }
+
+    char *u8 = (char*) cm_scratch_alloc(capacity);
+
+    u_strToUTF8(u8, (int32_t) capacity, &u8_len, lower, lower_len, &status);
+
+    if (U_FAILURE(status)) {
+        cm_scratch_release(mark);
+        zend_value_error("%s(): stop word is not valid UTF-8", fn);
+        return FAILURE;
+    }
+
+    zend_hash_str_add_empty_element(set, u8, u8_len);
+    cm_scratch_release(mark);
+
+    return SUCCESS;
+}
+
+static int stop_set_fill(HashTable *set, zval *words, const char *locale, const char *fn)
+{
+    zval *word;
+
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(words), word) {
+        if (Z_TYPE_P(word) != IS_STRING) {
+            zend_type_error("%s(): stop words must be strings", fn);
+            return FAILURE;
+        }
+        if (stop_set_add(set, Z_STRVAL_P(word), Z_STRLEN_P(word), locale, fn) == FAILURE) {
+            return FAILURE;
+        }
+    } ZEND_HASH_FOREACH_END();
+
+    return SUCCESS;
+}
+
+int text_stop_words_open(text_stop_words *sw, zval *option, const char *language, const char *locale, const char *fn)
+{
+    const text_stop_list *list = NULL;
+
+    memset(sw, 0, sizeof(*sw));
+
+    if (!option || Z_TYPE_P(option) == IS_NULL || Z_TYPE_P(option) == IS_FALSE) {
+        return SUCCESS;
+    }
+
+    if (Z_TYPE_P(option) == IS_TRUE) {
+        /* Language of the stemmer, else of the locale ("fr_FR" => fr) */
+        const char *name = language ? language : locale;
+        size_t len = language ? strlen(language) : strcspn(locale, "_-@.");
+
+        list = stop_builtin(name, len);
+        if (!list) {
+            zend_value_error("%s(): no built-in stop words for '%.*s'", fn, (int) len, name);
+            return FAILURE;
+        }
+    } else if (Z_TYPE_P(option) == IS_STRING) {
+        sw->set = stop_registered(Z_STRVAL_P(option), Z_STRLEN_P(option));
+        if (sw->set) {
+            return SUCCESS;
+        }
+
+        list = stop_builtin(Z_STRVAL_P(option), Z_STRLEN_P(option));
+        if (!list) {
+            zend_value_error("%s(): unknown stop_words list '%s'", fn, Z_STRVAL_P(option));
+            return FAILURE;
+        }
+    } else if (Z_TYPE_P(option) == IS_ARRAY) {
+        sw->set = emalloc(sizeof(HashTable));
+        sw->owned = 1;
+        zend_hash_init(sw->set, zend_hash_num_elements(Z_ARRVAL_P(option)), NULL, NULL, 0);
+
+        if (stop_set_fill(sw->set, option, locale, fn) == FAILURE) {
+            text_stop_words_close(sw);
+            return FAILURE;
+        }
+        return SUCCESS;
+    } else {
+        zend_type_error("%s(): option 'stop_words' must be a bool, a list name or an array of words", fn);
+        return FAILURE;
+    }
+
+    sw->words = list->words;
+    sw->count = list->count;
+
+    return SUCCESS;
+}
+
+zend_bool text_stop_words_contains(const text_stop_words *sw, const char *word, size_t len)
+{
+    if (sw->set) {
+        return zend_hash_str_exists(sw->set, word, len);
+    }
+
+    size_t lo = 0;
+    size_t hi = sw->count;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const text_stop_word *w = &sw->words[mid];
+        int cmp = memcmp(word, w->word, len < w->len ? len : w->len);
+
+        if (cmp == 0) {
+            cmp = (len > w->len) - (len < w->len);
+        }
+        if (cmp == 0) {
+            return 1;
+        }
+        if (cmp < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    return 0;
+}
+
+void text_stop_words_close(text_stop_words *sw)
+{
+    if (sw->owned && sw->set) {
+        zend_hash_destroy(sw->set);
+        efree(sw->set);
+    }
+
+    memset(sw, 0, sizeof(*sw));
+}
+
+/* ---------- Registry ---------- */
+
+static void stop_set_free(HashTable *set)
+{
+    zend_hash_destroy(set);
+    pefree(set, 1);
+}
+
+static void stop_set_dtor(zval *zv)
+{
+    stop_set_free((HashTable *) Z_PTR_P(zv));
+}
+
+static zend_bool stop_set_equals(HashTable *a, HashTable *b)
+{
+    zend_string *word;
+
+    if (zend_hash_num_elements(a) != zend_hash_num_elements(b)) {
+        return 0;
+    }
+
+    ZEND_HASH_FOREACH_STR_KEY(a, word) {
+        if (!zend_hash_exists(b, word)) {
+            return 0;
+        }
+    } ZEND_HASH_FOREACH_END();
+
+    return 1;
+}
+
+void text_stop_words_shutdown(void)
+{
+    pthread_mutex_lock(&stop_registry_lock);
+    if (stop_registry) {
+        zend_hash_destroy(stop_registry);
+        pefree(stop_registry, 1);
+        stop_registry = NULL;
+    }
+#ifdef ZTS
+    if (stop_retired) {
+        zend_hash_destroy(stop_retired);
+        pefree(stop_retired, 1);
+        stop_retired = NULL;
+    }
+#endif
+    pthread_mutex_unlock(&stop_registry_lock);
+}
+
+void text_stop_words_register_zval(zval *name, zval *words, zval *return_value)
+{
+    if (Z_TYPE_P(name) != IS_STRING || Z_STRLEN_P(name) == 0) {
+        zend_type_error("registerStopWords(): name must be a non-empty string");
+        return;
+    }
+
+    if (Z_TYPE_P(words) != IS_ARRAY) {
+        zend_type_error("registerStopWords(): words must be an array of strings");
+        return;
+    }
+
+    HashTable *set = pemalloc(sizeof(HashTable), 1);
+
+    zend_hash_init(set, zend_hash_num_elements(Z_ARRVAL_P(words)), NULL, NULL, 1);
+
+    if (stop_set_fill(set, words, "", "registerStopWords") == FAILURE) {
+        stop_set_free(set);
+        return;
+    }
+
+    ZVAL_LONG(return_value, zend_hash_num_elements(set));
+
+    pthread_mutex_lock(&stop_registry_lock);
+
+    if (!stop_registry) {
+        stop_registry = pemalloc(sizeof(HashTable), 1);
+        zend_hash_init(stop_registry, 8, NULL, stop_set_dtor, 1);
+    }
+
+    zval *old = zend_hash_str_find(stop_registry, Z_STRVAL_P(name), Z_STRLEN_P(name));
+
+    if (!old) {
+        zend_hash_str_add_new_ptr(stop_registry, Z_STRVAL_P(name), Z_STRLEN_P(name), set);
+    } else if (stop_set_equals(set, Z_PTR_P(old))) {
+        stop_set_free(set);
+    } else {
+#ifdef ZTS
+        /* Another thread may still be filtering with the old set */
+        if (!stop_retired) {
+            stop_retired = pemalloc(sizeof(HashTable), 1);
+            zend_hash_init(stop_retired, 8, NULL, stop_set_dtor, 1);
+        }
+        if (zend_hash_num_elements(stop_retired) >= STOP_RETIRED_MAX) {
+            pthread_mutex_unlock(&stop_registry_lock);
+            stop_set_free(set);
+            ZVAL_NULL(return_value);
+            zend_value_error("registerStopWords(): list replaced more than %d times in this process", STOP_RETIRED_MAX);
+            return;
+        }
+        zend_hash_next_index_insert_ptr(stop_retired, Z_PTR_P(old));
+#else
+        stop_set_free(Z_PTR_P(old));
+#endif
+        Z_PTR_P(old) = set;
+    }
+
+    pthread_mutex_unlock(&stop_registry_lock);
+}
+
+void text_stop_words_zval(zval *name, zval *return_value)
+{
+    if (Z_TYPE_P(name) != IS_STRING) {
+        zend_type_error("stopWords(): name must be a string");
+        return;
+    }
+
+    HashTable *set = stop_registered(Z_STRVAL_P(name), Z_STRLEN_P(name));
+
+    if (set) {
+        zend_string *word;
+
+        array_init_size(return_value, zend_hash_num_elements(set));
+        ZEND_HASH_FOREACH_STR_KEY(set, word) {
+            add_next_index_stringl(return_value, ZSTR_VAL(word), ZSTR_LEN(word));
+        } ZEND_HASH_FOREACH_END();
+        return;
+    }
+
+    const text_stop_list *list = stop_builtin(Z_STRVAL_P(name), Z_STRLEN_P(name));
+
+    if (!list) {
+        zend_value_error("stopWords(): unknown stop_words list '%s'", Z_STRVAL_P(name));
+        return;
+    }
+
+    array_init_size(return_value, (uint32_t) list->count);
+    for (size_t i = 0; i < list->count; i++) {
+        add_next_index_stringl(return_value, list->words[i].word, list->words[i].len);
+    }
+}
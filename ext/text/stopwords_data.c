@@ -0,0 +1,443 @@
+#include "../text_internal.h"
+
+/*
+ * Built-in stop-word lists, one per language of the bundled Snowball
+ * stemmers ("porter" shares the English list). Words are lowercase UTF-8
+ * and every table is sorted by byte value for bsearch(): keep it sorted
+ * when editing. Romanian lists both the cedilla and the comma-below forms
+ * of ş and ţ.
+ */
+
+#define W(s) { s, sizeof(s) - 1 }
+
+static const text_stop_word stop_danish[] = {
+    W("ad"), W("af"), W("alle"), W("alt"), W("anden"), W("at"), W("blev"), W("blive"),
+    W("bliver"), W("da"), W("de"), W("dem"), W("den"), W("denne"), W("der"), W("deres"),
+    W("det"), W("dette"), W("dig"), W("din"), W("disse"), W("dog"), W("du"), W("efter"),
+    W("eller"), W("en"), W("end"), W("er"), W("et"), W("for"), W("fra"), W("ham"), W("han"),
+    W("hans"), W("har"), W("havde"), W("have"), W("hende"), W("hendes"), W("her"), W("hos"),
+    W("hun"), W("hvad"), W("hvis"), W("hvor"), W("i"), W("ikke"), W("ind"), W("jeg"), W("jer"),
+    W("jo"), W("kunne"), W("man"), W("mange"), W("med"), W("meget"), W("men"), W("mig"),
+    W("min"), W("mine"), W("mit"), W("mod"), W("ned"), W("noget"), W("nogle"), W("nu"),
+    W("når"), W("og"), W("også"), W("om"), W("op"), W("os"), W("over"), W("på"), W("selv"),
+    W("sig"), W("sin"), W("sine"), W("sit"), W("skal"), W("skulle"), W("som"), W("sådan"),
+    W("thi"), W("til"), W("ud"), W("under"), W("var"), W("vi"), W("vil"), W("ville"), W("vor"),
+    W("være"), W("været"),
+};
+
+static const text_stop_word stop_dutch[] = {
+    W("aan"), W("al"), W("alles"), W("als"), W("altijd"), W("andere"), W("ben"), W("bij"),
+    W("daar"), W("dan"), W("dat"), W("de"), W("der"), W("deze"), W("die"), W("dit"), W("doch"),
+    W("doen"), W("door"), W("dus"), W("een"), W("eens"), W("en"), W("er"), W("ge"), W("geen"),
+    W("geweest"), W("haar"), W("had"), W("heb"), W("hebben"), W("heeft"), W("hem"), W("het"),
+    W("hier"), W("hij"), W("hoe"), W("hun"), W("iemand"), W("iets"), W("ik"), W("in"), W("is"),
+    W("ja"), W("je"), W("kan"), W("kon"), W("kunnen"), W("maar"), W("me"), W("meer"), W("men"),
+    W("met"), W("mij"), W("mijn"), W("moet"), W("na"), W("naar"), W("niet"), W("niets"),
+    W("nog"), W("nu"), W("of"), W("om"), W("omdat"), W("onder"), W("ons"), W("ook"), W("op"),
+    W("over"), W("reeds"), W("te"), W("tegen"), W("toch"), W("toen"), W("tot"), W("u"),
+    W("uit"), W("uw"), W("van"), W("veel"), W("voor"), W("want"), W("waren"), W("was"),
+    W("wat"), W("werd"), W("wezen"), W("wie"), W("wil"), W("worden"), W("wordt"), W("zal"),
+    W("ze"), W("zelf"), W("zich"), W("zij"), W("zijn"), W("zo"), W("zonder"), W("zou"),
+};
+
+static const text_stop_word stop_english[] = {
+    W("a"), W("about"), W("above"), W("after"), W("again"), W("against"), W("ain"), W("all"),
+    W("am"), W("an"), W("and"), W("any"), W("are"), W("aren"), W("aren't"), W("as"), W("at"),
+    W("be"), W("because"), W("been"), W("before"), W("being"), W("below"), W("between"),
+    W("both"), W("but"), W("by"), W("can"), W("couldn"), W("couldn't"), W("d"), W("did"),
+    W("didn"), W("didn't"), W("do"), W("does"), W("doesn"), W("doesn't"), W("doing"), W("don"),
+    W("don't"), W("down"), W("during"), W("each"), W("few"), W("for"), W("from"), W("further"),
+    W("had"), W("hadn"), W("hadn't"), W("has"), W("hasn"), W("hasn't"), W("have"), W("haven"),
+    W("haven't"), W("having"), W("he"), W("her"), W("here"), W("hers"), W("herself"), W("him"),
+    W("himself"), W("his"), W("how"), W("i"), W("if"), W("in"), W("into"), W("is"), W("isn"),
+    W("isn't"), W("it"), W("it's"), W("its"), W("itself"), W("just"), W("ll"), W("m"), W("ma"),
+    W("me"), W("mightn"), W("mightn't"), W("more"), W("most"), W("mustn"), W("mustn't"),
+    W("my"), W("myself"), W("needn"), W("needn't"), W("no"), W("nor"), W("not"), W("now"),
+    W("o"), W("of"), W("off"), W("on"), W("once"), W("only"), W("or"), W("other"), W("our"),
+    W("ours"), W("ourselves"), W("out"), W("over"), W("own"), W("re"), W("s"), W("same"),
+    W("shan"), W("shan't"), W("she"), W("she's"), W("should"), W("should've"), W("shouldn"),
+    W("shouldn't"), W("so"), W("some"), W("such"), W("t"), W("than"), W("that"), W("that'll"),
+    W("the"), W("their"), W("theirs"), W("them"), W("themselves"), W("then"), W("there"),
+    W("these"), W("they"), W("this"), W("those"), W("through"), W("to"), W("too"), W("under"),
+    W("until"), W("up"), W("ve"), W("very"), W("was"), W("wasn"), W("wasn't"), W("we"),
+    W("were"), W("weren"), W("weren't"), W("what"), W("when"), W("where"), W("which"),
+    W("while"), W("who"), W("whom"), W("why"), W("will"), W("with"), W("won"), W("won't"),
+    W("wouldn"), W("wouldn't"), W("y"), W("you"), W("you'd"), W("you'll"), W("you're"),
+    W("you've"), W("your"), W("yours"), W("yourself"), W("yourselves"),
+};
+
+static const text_stop_word stop_finnish[] = {
+    W("ei"), W("eivät"), W("emme"), W("en"), W("et"), W("ette"), W("että"), W("he"),
+    W("heidän"), W("heidät"), W("heihin"), W("heille"), W("heillä"), W("heiltä"), W("heissä"),
+    W("heistä"), W("heitä"), W("hän"), W("häneen"), W("hänelle"), W("hänellä"), W("häneltä"),
+    W("hänen"), W("hänessä"), W("hänestä"), W("hänet"), W("häntä"), W("itse"), W("ja"),
+    W("johon"), W("joiden"), W("joihin"), W("joiksi"), W("joilla"), W("joille"), W("joilta"),
+    W("joina"), W("joissa"), W("joista"), W("joita"), W("joka"), W("joksi"), W("jolla"),
+    W("jolle"), W("jolta"), W("jona"), W("jonka"), W("jos"), W("jossa"), W("josta"), W("jota"),
+    W("jotka"), W("kanssa"), W("keiden"), W("keihin"), W("keiksi"), W("keille"), W("keillä"),
+    W("keiltä"), W("keinä"), W("keissä"), W("keistä"), W("keitä"), W("keneen"), W("keneksi"),
+    W("kenelle"), W("kenellä"), W("keneltä"), W("kenen"), W("kenenä"), W("kenessä"),
+    W("kenestä"), W("kenet"), W("ketkä"), W("ketä"), W("koska"), W("kuin"), W("kuka"), W("kun"),
+    W("me"), W("meidän"), W("meidät"), W("meihin"), W("meille"), W("meillä"), W("meiltä"),
+    W("meissä"), W("meistä"), W("meitä"), W("mihin"), W("miksi"), W("mikä"), W("mille"),
+    W("millä"), W("miltä"), W("minkä"), W("minua"), W("minulla"), W("minulle"), W("minulta"),
+    W("minun"), W("minussa"), W("minusta"), W("minut"), W("minuun"), W("minä"), W("missä"),
+    W("mistä"), W("mitkä"), W("mitä"), W("mukaan"), W("mutta"), W("ne"), W("niiden"),
+    W("niihin"), W("niiksi"), W("niille"), W("niillä"), W("niiltä"), W("niin"), W("niinä"),
+    W("niissä"), W("niistä"), W("niitä"), W("noiden"), W("noihin"), W("noiksi"), W("noilla"),
+    W("noille"), W("noilta"), W("noin"), W("noina"), W("noissa"), W("noista"), W("noita"),
+    W("nuo"), W("nyt"), W("näiden"), W("näihin"), W("näiksi"), W("näille"), W("näillä"),
+    W("näiltä"), W("näinä"), W("näissä"), W("näistä"), W("näitä"), W("nämä"), W("ole"),
+    W("olemme"), W("olen"), W("olet"), W("olette"), W("oli"), W("olimme"), W("olin"),
+    W("olisi"), W("olisimme"), W("olisin"), W("olisit"), W("olisitte"), W("olisivat"),
+    W("olit"), W("olitte"), W("olivat"), W("olla"), W("olleet"), W("ollut"), W("on"), W("ovat"),
+    W("poikki"), W("se"), W("sekä"), W("sen"), W("siihen"), W("siinä"), W("siitä"), W("siksi"),
+    W("sille"), W("sillä"), W("siltä"), W("sinua"), W("sinulla"), W("sinulle"), W("sinulta"),
+    W("sinun"), W("sinussa"), W("sinusta"), W("sinut"), W("sinuun"), W("sinä"), W("sitä"),
+    W("tai"), W("te"), W("teidän"), W("teidät"), W("teihin"), W("teille"), W("teillä"),
+    W("teiltä"), W("teissä"), W("teistä"), W("teitä"), W("tuo"), W("tuohon"), W("tuoksi"),
+    W("tuolla"), W("tuolle"), W("tuolta"), W("tuon"), W("tuona"), W("tuossa"), W("tuosta"),
+    W("tuota"), W("tähän"), W("täksi"), W("tälle"), W("tällä"), W("tältä"), W("tämä"),
+    W("tämän"), W("tänä"), W("tässä"), W("tästä"), W("tätä"), W("vaan"), W("vai"), W("vaikka"),
+    W("yli"),
+};
+
+static const text_stop_word stop_french[] = {
+    W("ai"), W("aie"), W("aient"), W("aies"), W("ait"), W("as"), W("au"), W("aura"), W("aurai"),
+    W("auraient"), W("aurais"), W("aurait"), W("auras"), W("aurez"), W("auriez"), W("aurions"),
+    W("aurons"), W("auront"), W("aux"), W("avaient"), W("avais"), W("avait"), W("avec"),
+    W("avez"), W("aviez"), W("avions"), W("avons"), W("ayant"), W("ayante"), W("ayantes"),
+    W("ayants"), W("ayez"), W("ayons"), W("c"), W("ce"), W("ces"), W("d"), W("dans"), W("de"),
+    W("des"), W("du"), W("elle"), W("en"), W("es"), W("est"), W("et"), W("eu"), W("eue"),
+    W("eues"), W("eurent"), W("eus"), W("eusse"), W("eussent"), W("eusses"), W("eussiez"),
+    W("eussions"), W("eut"), W("eux"), W("eûmes"), W("eût"), W("eûtes"), W("furent"), W("fus"),
+    W("fusse"), W("fussent"), W("fusses"), W("fussiez"), W("fussions"), W("fut"), W("fûmes"),
+    W("fût"), W("fûtes"), W("il"), W("ils"), W("j"), W("je"), W("l"), W("la"), W("le"),
+    W("les"), W("leur"), W("lui"), W("m"), W("ma"), W("mais"), W("me"), W("mes"), W("moi"),
+    W("mon"), W("même"), W("n"), W("ne"), W("nos"), W("notre"), W("nous"), W("on"), W("ont"),
+    W("ou"), W("par"), W("pas"), W("pour"), W("qu"), W("que"), W("qui"), W("s"), W("sa"),
+    W("se"), W("sera"), W("serai"), W("seraient"), W("serais"), W("serait"), W("seras"),
+    W("serez"), W("seriez"), W("serions"), W("serons"), W("seront"), W("ses"), W("soient"),
+    W("sois"), W("soit"), W("sommes"), W("son"), W("sont"), W("soyez"), W("soyons"), W("suis"),
+    W("sur"), W("t"), W("ta"), W("te"), W("tes"), W("toi"), W("ton"), W("tu"), W("un"),
+    W("une"), W("vos"), W("votre"), W("vous"), W("y"), W("à"), W("étaient"), W("étais"),
+    W("était"), W("étant"), W("étante"), W("étantes"), W("étants"), W("étiez"), W("étions"),
+    W("été"), W("étée"), W("étées"), W("étés"), W("êtes"),
+};
+
+static const text_stop_word stop_german[] = {
+    W("aber"), W("alle"), W("allem"), W("allen"), W("aller"), W("alles"), W("als"), W("also"),
+    W("am"), W("an"), W("ander"), W("andere"), W("anderem"), W("anderen"), W("anderer"),
+    W("anderes"), W("anderm"), W("andern"), W("anderr"), W("anders"), W("auch"), W("auf"),
+    W("aus"), W("bei"), W("bin"), W("bis"), W("bist"), W("da"), W("damit"), W("dann"), W("das"),
+    W("dass"), W("dasselbe"), W("dazu"), W("daß"), W("dein"), W("deine"), W("deinem"),
+    W("deinen"), W("deiner"), W("deines"), W("dem"), W("demselben"), W("den"), W("denn"),
+    W("denselben"), W("der"), W("derer"), W("derselbe"), W("derselben"), W("des"),
+    W("desselben"), W("dessen"), W("dich"), W("die"), W("dies"), W("diese"), W("dieselbe"),
+    W("dieselben"), W("diesem"), W("diesen"), W("dieser"), W("dieses"), W("dir"), W("doch"),
+    W("dort"), W("du"), W("durch"), W("ein"), W("eine"), W("einem"), W("einen"), W("einer"),
+    W("eines"), W("einig"), W("einige"), W("einigem"), W("einigen"), W("einiger"), W("einiges"),
+    W("einmal"), W("er"), W("es"), W("etwas"), W("euch"), W("euer"), W("eure"), W("eurem"),
+    W("euren"), W("eurer"), W("eures"), W("für"), W("gegen"), W("gewesen"), W("hab"), W("habe"),
+    W("haben"), W("hat"), W("hatte"), W("hatten"), W("hier"), W("hin"), W("hinter"), W("ich"),
+    W("ihm"), W("ihn"), W("ihnen"), W("ihr"), W("ihre"), W("ihrem"), W("ihren"), W("ihrer"),
+    W("ihres"), W("im"), W("in"), W("indem"), W("ins"), W("ist"), W("jede"), W("jedem"),
+    W("jeden"), W("jeder"), W("jedes"), W("jene"), W("jenem"), W("jenen"), W("jener"),
+    W("jenes"), W("jetzt"), W("kann"), W("kein"), W("keine"), W("keinem"), W("keinen"),
+    W("keiner"), W("keines"), W("können"), W("könnte"), W("machen"), W("man"), W("manche"),
+    W("manchem"), W("manchen"), W("mancher"), W("manches"), W("mein"), W("meine"), W("meinem"),
+    W("meinen"), W("meiner"), W("meines"), W("mich"), W("mir"), W("mit"), W("muss"),
+    W("musste"), W("nach"), W("nicht"), W("nichts"), W("noch"), W("nun"), W("nur"), W("ob"),
+    W("oder"), W("ohne"), W("sehr"), W("sein"), W("seine"), W("seinem"), W("seinen"),
+    W("seiner"), W("seines"), W("selbst"), W("sich"), W("sie"), W("sind"), W("so"), W("solche"),
+    W("solchem"), W("solchen"), W("solcher"), W("solches"), W("soll"), W("sollte"),
+    W("sondern"), W("sonst"), W("um"), W("und"), W("uns"), W("unser"), W("unsere"),
+    W("unserem"), W("unseren"), W("unseres"), W("unter"), W("viel"), W("vom"), W("von"),
+    W("vor"), W("war"), W("waren"), W("warst"), W("was"), W("weg"), W("weil"), W("weiter"),
+    W("welche"), W("welchem"), W("welchen"), W("welcher"), W("welches"), W("wenn"), W("werde"),
+    W("werden"), W("wie"), W("wieder"), W("will"), W("wir"), W("wird"), W("wirst"), W("wo"),
+    W("wollen"), W("wollte"), W("während"), W("würde"), W("würden"), W("zu"), W("zum"),
+    W("zur"), W("zwar"), W("zwischen"), W("über"),
+};
+
+static const text_stop_word stop_hungarian[] = {
+    W("a"), W("abban"), W("ahhoz"), W("ahogy"), W("ahol"), W("aki"), W("akik"), W("akkor"),
+    W("alatt"), W("amely"), W("amelyek"), W("amelyekben"), W("amelyeket"), W("amelyet"),
+    W("amelynek"), W("ami"), W("amikor"), W("amit"), W("amolyan"), W("amíg"), W("annak"),
+    W("arra"), W("arról"), W("az"), W("azok"), W("azon"), W("azonban"), W("azt"), W("aztán"),
+    W("azután"), W("azzal"), W("azért"), W("be"), W("belül"), W("benne"), W("bár"), W("cikk"),
+    W("cikkek"), W("cikkeket"), W("csak"), W("de"), W("e"), W("ebben"), W("eddig"), W("egy"),
+    W("egyes"), W("egyetlen"), W("egyik"), W("egyre"), W("egyéb"), W("egész"), W("ehhez"),
+    W("ekkor"), W("el"), W("ellen"), W("első"), W("elég"), W("elő"), W("először"), W("előtt"),
+    W("emilyen"), W("ennek"), W("erre"), W("ez"), W("ezek"), W("ezen"), W("ezt"), W("ezzel"),
+    W("ezért"), W("fel"), W("felé"), W("hanem"), W("hiszen"), W("hogy"), W("hogyan"), W("igen"),
+    W("ill"), W("illetve"), W("ilyen"), W("ilyenkor"), W("ismét"), W("itt"), W("jobban"),
+    W("jó"), W("jól"), W("kell"), W("kellett"), W("keressünk"), W("keresztül"), W("ki"),
+    W("kívül"), W("között"), W("közül"), W("legalább"), W("legyen"), W("lehet"), W("lehetett"),
+    W("lenne"), W("lenni"), W("lesz"), W("lett"), W("maga"), W("magát"), W("majd"), W("meg"),
+    W("mellett"), W("mely"), W("melyek"), W("mert"), W("mi"), W("mikor"), W("milyen"),
+    W("minden"), W("mindenki"), W("mindent"), W("mindig"), W("mint"), W("mintha"), W("mit"),
+    W("mivel"), W("miért"), W("most"), W("már"), W("más"), W("másik"), W("még"), W("míg"),
+    W("nagy"), W("nagyobb"), W("nagyon"), W("ne"), W("nekem"), W("neki"), W("nem"), W("nincs"),
+    W("néha"), W("néhány"), W("nélkül"), W("olyan"), W("ott"), W("pedig"), W("persze"), W("rá"),
+    W("s"), W("saját"), W("sem"), W("semmi"), W("sok"), W("sokat"), W("sokkal"), W("szemben"),
+    W("szerint"), W("szinte"), W("számára"), W("talán"), W("tehát"), W("teljes"), W("tovább"),
+    W("továbbá"), W("több"), W("ugyanis"), W("utolsó"), W("után"), W("utána"), W("vagy"),
+    W("vagyis"), W("vagyok"), W("valaki"), W("valami"), W("valamint"), W("való"), W("van"),
+    W("vannak"), W("vele"), W("vissza"), W("viszont"), W("volna"), W("volt"), W("voltak"),
+    W("voltam"), W("voltunk"), W("által"), W("általában"), W("át"), W("én"), W("éppen"),
+    W("és"), W("így"), W("össze"), W("úgy"), W("új"), W("újabb"), W("újra"), W("ő"), W("ők"),
+    W("őket"),
+};
+
+static const text_stop_word stop_italian[] = {
+    W("a"), W("abbia"), W("abbiamo"), W("abbiano"), W("abbiate"), W("ad"), W("agl"), W("agli"),
+    W("ai"), W("al"), W("all"), W("alla"), W("alle"), W("allo"), W("anche"), W("avemmo"),
+    W("avendo"), W("avesse"), W("avessero"), W("avessi"), W("avessimo"), W("aveste"),
+    W("avesti"), W("avete"), W("aveva"), W("avevamo"), W("avevano"), W("avevate"), W("avevi"),
+    W("avevo"), W("avrai"), W("avranno"), W("avrebbe"), W("avrebbero"), W("avrei"),
+    W("avremmo"), W("avremo"), W("avreste"), W("avresti"), W("avrete"), W("avrà"), W("avrò"),
+    W("avuta"), W("avute"), W("avuti"), W("avuto"), W("c"), W("che"), W("chi"), W("ci"),
+    W("coi"), W("col"), W("come"), W("con"), W("contro"), W("cui"), W("da"), W("dagl"),
+    W("dagli"), W("dai"), W("dal"), W("dall"), W("dalla"), W("dalle"), W("dallo"), W("degl"),
+    W("degli"), W("dei"), W("del"), W("dell"), W("della"), W("delle"), W("dello"), W("di"),
+    W("dov"), W("dove"), W("e"), W("ebbe"), W("ebbero"), W("ebbi"), W("ed"), W("era"),
+    W("erano"), W("eravamo"), W("eravate"), W("eri"), W("ero"), W("essendo"), W("faccia"),
+    W("facciamo"), W("facciano"), W("facciate"), W("faccio"), W("facemmo"), W("facendo"),
+    W("facesse"), W("facessero"), W("facessi"), W("facessimo"), W("faceste"), W("facesti"),
+    W("faceva"), W("facevamo"), W("facevano"), W("facevate"), W("facevi"), W("facevo"),
+    W("fai"), W("fanno"), W("farai"), W("faranno"), W("farebbe"), W("farebbero"), W("farei"),
+    W("faremmo"), W("faremo"), W("fareste"), W("faresti"), W("farete"), W("farà"), W("farò"),
+    W("fece"), W("fecero"), W("feci"), W("fosse"), W("fossero"), W("fossi"), W("fossimo"),
+    W("foste"), W("fosti"), W("fu"), W("fui"), W("fummo"), W("furono"), W("gli"), W("ha"),
+    W("hai"), W("hanno"), W("ho"), W("i"), W("il"), W("in"), W("io"), W("l"), W("la"), W("le"),
+    W("lei"), W("li"), W("lo"), W("loro"), W("lui"), W("ma"), W("mi"), W("mia"), W("mie"),
+    W("miei"), W("mio"), W("ne"), W("negl"), W("negli"), W("nei"), W("nel"), W("nell"),
+    W("nella"), W("nelle"), W("nello"), W("noi"), W("non"), W("nostra"), W("nostre"),
+    W("nostri"), W("nostro"), W("o"), W("per"), W("perché"), W("più"), W("quale"), W("quanta"),
+    W("quante"), W("quanti"), W("quanto"), W("quella"), W("quelle"), W("quelli"), W("quello"),
+    W("questa"), W("queste"), W("questi"), W("questo"), W("sarai"), W("saranno"), W("sarebbe"),
+    W("sarebbero"), W("sarei"), W("saremmo"), W("saremo"), W("sareste"), W("saresti"),
+    W("sarete"), W("sarà"), W("sarò"), W("se"), W("sei"), W("si"), W("sia"), W("siamo"),
+    W("siano"), W("siate"), W("siete"), W("sono"), W("sta"), W("stai"), W("stando"),
+    W("stanno"), W("starai"), W("staranno"), W("starebbe"), W("starebbero"), W("starei"),
+    W("staremmo"), W("staremo"), W("stareste"), W("staresti"), W("starete"), W("starà"),
+    W("starò"), W("stava"), W("stavamo"), W("stavano"), W("stavate"), W("stavi"), W("stavo"),
+    W("stemmo"), W("stesse"), W("stessero"), W("stessi"), W("stessimo"), W("steste"),
+    W("stesti"), W("stette"), W("stettero"), W("stetti"), W("stia"), W("stiamo"), W("stiano"),
+    W("stiate"), W("sto"), W("su"), W("sua"), W("sue"), W("sugl"), W("sugli"), W("sui"),
+    W("sul"), W("sull"), W("sulla"), W("sulle"), W("sullo"), W("suo"), W("suoi"), W("ti"),
+    W("tra"), W("tu"), W("tua"), W("tue"), W("tuo"), W("tuoi"), W("tutti"), W("tutto"), W("un"),
+    W("una"), W("uno"), W("vi"), W("voi"), W("vostra"), W("vostre"), W("vostri"), W("vostro"),
+    W("è"),
+};
+
+static const text_stop_word stop_norwegian[] = {
+    W("alle"), W("at"), W("av"), W("bare"), W("begge"), W("ble"), W("blei"), W("bli"),
+    W("blir"), W("blitt"), W("både"), W("båe"), W("da"), W("de"), W("deg"), W("dei"), W("deim"),
+    W("deira"), W("deires"), W("dem"), W("den"), W("denne"), W("der"), W("dere"), W("deres"),
+    W("det"), W("dette"), W("di"), W("din"), W("disse"), W("ditt"), W("du"), W("dykk"),
+    W("dykkar"), W("då"), W("eg"), W("ein"), W("eit"), W("eitt"), W("eller"), W("elles"),
+    W("en"), W("enn"), W("er"), W("et"), W("ett"), W("etter"), W("for"), W("fordi"), W("fra"),
+    W("før"), W("ha"), W("hadde"), W("han"), W("hans"), W("har"), W("hennar"), W("henne"),
+    W("hennes"), W("her"), W("hjå"), W("ho"), W("hoe"), W("honom"), W("hoss"), W("hossen"),
+    W("hun"), W("hva"), W("hvem"), W("hver"), W("hvilke"), W("hvilken"), W("hvis"), W("hvor"),
+    W("hvordan"), W("hvorfor"), W("i"), W("ikke"), W("ikkje"), W("ingen"), W("ingi"),
+    W("inkje"), W("inn"), W("inni"), W("ja"), W("jeg"), W("kan"), W("kom"), W("korleis"),
+    W("korso"), W("kun"), W("kunne"), W("kva"), W("kvar"), W("kvarhelst"), W("kven"), W("kvi"),
+    W("kvifor"), W("man"), W("mange"), W("me"), W("med"), W("medan"), W("meg"), W("meget"),
+    W("mellom"), W("men"), W("mi"), W("min"), W("mine"), W("mitt"), W("mot"), W("mykje"),
+    W("ned"), W("no"), W("noe"), W("noen"), W("noka"), W("noko"), W("nokon"), W("nokor"),
+    W("nokre"), W("nå"), W("når"), W("og"), W("også"), W("om"), W("opp"), W("oss"), W("over"),
+    W("på"), W("samme"), W("seg"), W("selv"), W("si"), W("sia"), W("sidan"), W("siden"),
+    W("sin"), W("sine"), W("sitt"), W("sjøl"), W("skal"), W("skulle"), W("slik"), W("so"),
+    W("som"), W("somme"), W("somt"), W("så"), W("sånn"), W("til"), W("um"), W("upp"), W("ut"),
+    W("uten"), W("var"), W("vart"), W("varte"), W("ved"), W("vere"), W("verte"), W("vi"),
+    W("vil"), W("ville"), W("vore"), W("vors"), W("vort"), W("vår"), W("være"), W("vært"),
+    W("å"),
+};
+
+static const text_stop_word stop_portuguese[] = {
+    W("a"), W("ao"), W("aos"), W("aquela"), W("aquelas"), W("aquele"), W("aqueles"),
+    W("aquilo"), W("as"), W("até"), W("com"), W("como"), W("da"), W("das"), W("de"), W("dela"),
+    W("delas"), W("dele"), W("deles"), W("depois"), W("do"), W("dos"), W("e"), W("ela"),
+    W("elas"), W("ele"), W("eles"), W("em"), W("entre"), W("era"), W("eram"), W("essa"),
+    W("essas"), W("esse"), W("esses"), W("esta"), W("estamos"), W("estar"), W("estas"),
+    W("estava"), W("estavam"), W("este"), W("esteja"), W("estejam"), W("estejamos"), W("estes"),
+    W("esteve"), W("estive"), W("estivemos"), W("estiver"), W("estivera"), W("estiveram"),
+    W("estiverem"), W("estivermos"), W("estivesse"), W("estivessem"), W("estivéramos"),
+    W("estivéssemos"), W("estou"), W("está"), W("estávamos"), W("estão"), W("eu"), W("foi"),
+    W("fomos"), W("for"), W("fora"), W("foram"), W("forem"), W("formos"), W("fosse"),
+    W("fossem"), W("fui"), W("fôramos"), W("fôssemos"), W("haja"), W("hajam"), W("hajamos"),
+    W("havemos"), W("haver"), W("hei"), W("houve"), W("houvemos"), W("houver"), W("houvera"),
+    W("houveram"), W("houverei"), W("houverem"), W("houveremos"), W("houveria"), W("houveriam"),
+    W("houvermos"), W("houverá"), W("houverão"), W("houveríamos"), W("houvesse"),
+    W("houvessem"), W("houvéramos"), W("houvéssemos"), W("há"), W("hão"), W("isso"), W("isto"),
+    W("já"), W("lhe"), W("lhes"), W("mais"), W("mas"), W("me"), W("mesmo"), W("meu"), W("meus"),
+    W("minha"), W("minhas"), W("muito"), W("na"), W("nas"), W("nem"), W("no"), W("nos"),
+    W("nossa"), W("nossas"), W("nosso"), W("nossos"), W("num"), W("numa"), W("não"), W("nós"),
+    W("o"), W("os"), W("ou"), W("para"), W("pela"), W("pelas"), W("pelo"), W("pelos"), W("por"),
+    W("qual"), W("quando"), W("que"), W("quem"), W("se"), W("seja"), W("sejam"), W("sejamos"),
+    W("sem"), W("ser"), W("serei"), W("seremos"), W("seria"), W("seriam"), W("será"),
+    W("serão"), W("seríamos"), W("seu"), W("seus"), W("somos"), W("sou"), W("sua"), W("suas"),
+    W("são"), W("só"), W("também"), W("te"), W("tem"), W("temos"), W("tenha"), W("tenham"),
+    W("tenhamos"), W("tenho"), W("terei"), W("teremos"), W("teria"), W("teriam"), W("terá"),
+    W("terão"), W("teríamos"), W("teu"), W("teus"), W("teve"), W("tinha"), W("tinham"),
+    W("tive"), W("tivemos"), W("tiver"), W("tivera"), W("tiveram"), W("tiverem"), W("tivermos"),
+    W("tivesse"), W("tivessem"), W("tivéramos"), W("tivéssemos"), W("tu"), W("tua"), W("tuas"),
+    W("tém"), W("tínhamos"), W("um"), W("uma"), W("você"), W("vocês"), W("vos"), W("à"),
+    W("às"), W("é"), W("éramos"),
+};
+
+static const text_stop_word stop_romanian[] = {
+    W("a"), W("abia"), W("acea"), W("aceasta"), W("această"), W("aceea"), W("aceeaşi"),
+    W("aceeași"), W("acei"), W("aceia"), W("acel"), W("acela"), W("acele"), W("acelea"),
+    W("acest"), W("acesta"), W("aceste"), W("acestea"), W("acestei"), W("acestui"), W("aceşti"),
+    W("aceştia"), W("acești"), W("aceștia"), W("acolo"), W("acum"), W("ai"), W("aia"),
+    W("aibă"), W("aici"), W("al"), W("ale"), W("alea"), W("alt"), W("alta"), W("altceva"),
+    W("altcineva"), W("alte"), W("altfel"), W("altul"), W("alţi"), W("alţii"), W("alți"),
+    W("alții"), W("am"), W("anume"), W("apoi"), W("ar"), W("are"), W("asta"), W("astfel"),
+    W("astăzi"), W("asupra"), W("atare"), W("atunci"), W("atât"), W("atâta"), W("atâtea"),
+    W("atâţia"), W("atâția"), W("au"), W("avea"), W("avem"), W("aveţi"), W("aveți"), W("avut"),
+    W("azi"), W("aş"), W("aşa"), W("aţi"), W("aș"), W("așa"), W("ați"), W("ba"), W("bine"),
+    W("ca"), W("care"), W("ce"), W("cea"), W("ceea"), W("cei"), W("ceilalţi"), W("ceilalți"),
+    W("cel"), W("cele"), W("celor"), W("ceva"), W("chiar"), W("ci"), W("cine"), W("cineva"),
+    W("conform"), W("cu"), W("cum"), W("cumva"), W("când"), W("cât"), W("că"), W("căci"),
+    W("căreia"), W("cărora"), W("căruia"), W("către"), W("da"), W("dacă"), W("dar"), W("de"),
+    W("deasupra"), W("deci"), W("decât"), W("deja"), W("despre"), W("deşi"), W("deși"),
+    W("din"), W("dintre"), W("doar"), W("doi"), W("două"), W("drept"), W("după"), W("ea"),
+    W("ei"), W("el"), W("ele"), W("era"), W("eram"), W("este"), W("eu"), W("eşti"), W("ești"),
+    W("face"), W("fi"), W("fie"), W("fiecare"), W("fii"), W("fiind"), W("fost"), W("fără"),
+    W("iar"), W("la"), W("le"), W("li"), W("lor"), W("lui"), W("mai"), W("mare"), W("mea"),
+    W("mei"), W("mele"), W("mereu"), W("meu"), W("mi"), W("mie"), W("mine"), W("mult"),
+    W("multe"), W("multă"), W("mulţi"), W("mulți"), W("mă"), W("ne"), W("nici"), W("nimeni"),
+    W("nimic"), W("nişte"), W("niște"), W("noastre"), W("noastră"), W("noi"), W("nostru"),
+    W("nouă"), W("noştri"), W("noștri"), W("nu"), W("numai"), W("o"), W("or"), W("ori"),
+    W("oricare"), W("orice"), W("oricine"), W("oricum"), W("oricând"), W("oricât"),
+    W("oriunde"), W("pe"), W("pentru"), W("peste"), W("poate"), W("pot"), W("prea"), W("prima"),
+    W("primul"), W("prin"), W("puţin"), W("puţină"), W("puțin"), W("puțină"), W("până"),
+    W("sa"), W("sale"), W("sau"), W("se"), W("sub"), W("sunt"), W("sus"), W("sînt"), W("să"),
+    W("său"), W("ta"), W("tale"), W("te"), W("toate"), W("toată"), W("tocmai"), W("tot"),
+    W("totul"), W("totuşi"), W("totuși"), W("toţi"), W("toți"), W("tu"), W("tuturor"), W("un"),
+    W("una"), W("unde"), W("unei"), W("unele"), W("uneori"), W("unii"), W("unor"), W("unui"),
+    W("unul"), W("va"), W("vi"), W("voi"), W("vom"), W("vor"), W("vreo"), W("vreun"), W("vă"),
+    W("îi"), W("îl"), W("îmi"), W("în"), W("înainte"), W("înapoi"), W("încă"), W("însă"),
+    W("între"), W("îşi"), W("îţi"), W("își"), W("îți"), W("şi"), W("ţi"), W("și"), W("ți"),
+};
+
+static const text_stop_word stop_russian[] = {
+    W("а"), W("без"), W("более"), W("больше"), W("будет"), W("будто"), W("бы"), W("был"),
+    W("была"), W("были"), W("было"), W("быть"), W("в"), W("вам"), W("вас"), W("вдруг"),
+    W("ведь"), W("во"), W("вот"), W("впрочем"), W("все"), W("всегда"), W("всего"), W("всех"),
+    W("всю"), W("вы"), W("где"), W("да"), W("даже"), W("два"), W("для"), W("до"), W("другой"),
+    W("его"), W("ее"), W("ей"), W("ему"), W("если"), W("есть"), W("еще"), W("ж"), W("же"),
+    W("за"), W("зачем"), W("здесь"), W("и"), W("из"), W("или"), W("им"), W("иногда"), W("их"),
+    W("к"), W("как"), W("какая"), W("какой"), W("когда"), W("конечно"), W("кто"), W("куда"),
+    W("ли"), W("лучше"), W("между"), W("меня"), W("мне"), W("много"), W("может"), W("можно"),
+    W("мой"), W("моя"), W("мы"), W("на"), W("над"), W("надо"), W("наконец"), W("нас"), W("не"),
+    W("него"), W("нее"), W("ней"), W("нельзя"), W("нет"), W("ни"), W("нибудь"), W("никогда"),
+    W("ним"), W("них"), W("ничего"), W("но"), W("ну"), W("о"), W("об"), W("один"), W("он"),
+    W("она"), W("они"), W("опять"), W("от"), W("перед"), W("по"), W("под"), W("после"),
+    W("потом"), W("потому"), W("почти"), W("при"), W("про"), W("раз"), W("разве"), W("с"),
+    W("сам"), W("свою"), W("себе"), W("себя"), W("сейчас"), W("со"), W("совсем"), W("так"),
+    W("такой"), W("там"), W("тебя"), W("тем"), W("теперь"), W("то"), W("тогда"), W("того"),
+    W("тоже"), W("только"), W("том"), W("тот"), W("три"), W("тут"), W("ты"), W("у"), W("уж"),
+    W("уже"), W("хорошо"), W("хоть"), W("чего"), W("чем"), W("через"), W("что"), W("чтоб"),
+    W("чтобы"), W("чуть"), W("эти"), W("этого"), W("этой"), W("этом"), W("этот"), W("эту"),
+    W("я"),
+};
+
+static const text_stop_word stop_spanish[] = {
+    W("a"), W("al"), W("algo"), W("algunas"), W("algunos"), W("ante"), W("antes"), W("como"),
+    W("con"), W("contra"), W("cual"), W("cuando"), W("de"), W("del"), W("desde"), W("donde"),
+    W("durante"), W("e"), W("el"), W("ella"), W("ellas"), W("ellos"), W("en"), W("entre"),
+    W("era"), W("erais"), W("eran"), W("eras"), W("eres"), W("es"), W("esa"), W("esas"),
+    W("ese"), W("eso"), W("esos"), W("esta"), W("estaba"), W("estabais"), W("estaban"),
+    W("estabas"), W("estad"), W("estada"), W("estadas"), W("estado"), W("estados"),
+    W("estamos"), W("estando"), W("estar"), W("estaremos"), W("estará"), W("estarán"),
+    W("estarás"), W("estaré"), W("estaréis"), W("estaría"), W("estaríais"), W("estaríamos"),
+    W("estarían"), W("estarías"), W("estas"), W("este"), W("estemos"), W("esto"), W("estos"),
+    W("estoy"), W("estuve"), W("estuviera"), W("estuvierais"), W("estuvieran"), W("estuvieras"),
+    W("estuvieron"), W("estuviese"), W("estuvieseis"), W("estuviesen"), W("estuvieses"),
+    W("estuvimos"), W("estuviste"), W("estuvisteis"), W("estuviéramos"), W("estuviésemos"),
+    W("estuvo"), W("está"), W("estábamos"), W("estáis"), W("están"), W("estás"), W("esté"),
+    W("estéis"), W("estén"), W("estés"), W("fue"), W("fuera"), W("fuerais"), W("fueran"),
+    W("fueras"), W("fueron"), W("fuese"), W("fueseis"), W("fuesen"), W("fueses"), W("fui"),
+    W("fuimos"), W("fuiste"), W("fuisteis"), W("fuéramos"), W("fuésemos"), W("ha"), W("habida"),
+    W("habidas"), W("habido"), W("habidos"), W("habiendo"), W("habremos"), W("habrá"),
+    W("habrán"), W("habrás"), W("habré"), W("habréis"), W("habría"), W("habríais"),
+    W("habríamos"), W("habrían"), W("habrías"), W("habéis"), W("había"), W("habíais"),
+    W("habíamos"), W("habían"), W("habías"), W("han"), W("has"), W("hasta"), W("hay"),
+    W("haya"), W("hayamos"), W("hayan"), W("hayas"), W("hayáis"), W("he"), W("hemos"),
+    W("hube"), W("hubiera"), W("hubierais"), W("hubieran"), W("hubieras"), W("hubieron"),
+    W("hubiese"), W("hubieseis"), W("hubiesen"), W("hubieses"), W("hubimos"), W("hubiste"),
+    W("hubisteis"), W("hubiéramos"), W("hubiésemos"), W("hubo"), W("la"), W("las"), W("le"),
+    W("les"), W("lo"), W("los"), W("me"), W("mi"), W("mis"), W("mucho"), W("muchos"), W("muy"),
+    W("más"), W("mí"), W("mía"), W("mías"), W("mío"), W("míos"), W("nada"), W("ni"), W("no"),
+    W("nos"), W("nosotras"), W("nosotros"), W("nuestra"), W("nuestras"), W("nuestro"),
+    W("nuestros"), W("o"), W("os"), W("otra"), W("otras"), W("otro"), W("otros"), W("para"),
+    W("pero"), W("poco"), W("por"), W("porque"), W("que"), W("quien"), W("quienes"), W("qué"),
+    W("se"), W("sea"), W("seamos"), W("sean"), W("seas"), W("sentid"), W("sentida"),
+    W("sentidas"), W("sentido"), W("sentidos"), W("seremos"), W("será"), W("serán"), W("serás"),
+    W("seré"), W("seréis"), W("sería"), W("seríais"), W("seríamos"), W("serían"), W("serías"),
+    W("seáis"), W("siente"), W("sin"), W("sintiendo"), W("sobre"), W("sois"), W("somos"),
+    W("son"), W("soy"), W("su"), W("sus"), W("suya"), W("suyas"), W("suyo"), W("suyos"),
+    W("sí"), W("también"), W("tanto"), W("te"), W("tendremos"), W("tendrá"), W("tendrán"),
+    W("tendrás"), W("tendré"), W("tendréis"), W("tendría"), W("tendríais"), W("tendríamos"),
+    W("tendrían"), W("tendrías"), W("tened"), W("tenemos"), W("tenga"), W("tengamos"),
+    W("tengan"), W("tengas"), W("tengo"), W("tengáis"), W("tenida"), W("tenidas"), W("tenido"),
+    W("tenidos"), W("teniendo"), W("tenéis"), W("tenía"), W("teníais"), W("teníamos"),
+    W("tenían"), W("tenías"), W("ti"), W("tiene"), W("tienen"), W("tienes"), W("todo"),
+    W("todos"), W("tu"), W("tus"), W("tuve"), W("tuviera"), W("tuvierais"), W("tuvieran"),
+    W("tuvieras"), W("tuvieron"), W("tuviese"), W("tuvieseis"), W("tuviesen"), W("tuvieses"),
+    W("tuvimos"), W("tuviste"), W("tuvisteis"), W("tuviéramos"), W("tuviésemos"), W("tuvo"),
+    W("tuya"), W("tuyas"), W("tuyo"), W("tuyos"), W("tú"), W("un"), W("una"), W("uno"),
+    W("unos"), W("vosotras"), W("vosotros"), W("vuestra"), W("vuestras"), W("vuestro"),
+    W("vuestros"), W("y"), W("ya"), W("yo"), W("él"), W("éramos"),
+};
+
+static const text_stop_word stop_swedish[] = {
+    W("alla"), W("allt"), W("att"), W("av"), W("blev"), W("bli"), W("blir"), W("blivit"),
+    W("de"), W("dem"), W("den"), W("denna"), W("deras"), W("dess"), W("dessa"), W("det"),
+    W("detta"), W("dig"), W("din"), W("dina"), W("ditt"), W("du"), W("där"), W("då"),
+    W("efter"), W("ej"), W("eller"), W("en"), W("er"), W("era"), W("ert"), W("ett"), W("från"),
+    W("för"), W("ha"), W("hade"), W("han"), W("hans"), W("har"), W("henne"), W("hennes"),
+    W("hon"), W("honom"), W("hur"), W("här"), W("i"), W("icke"), W("ingen"), W("inom"),
+    W("inte"), W("jag"), W("ju"), W("kan"), W("kunde"), W("man"), W("med"), W("mellan"),
+    W("men"), W("mig"), W("min"), W("mina"), W("mitt"), W("mot"), W("mycket"), W("ni"), W("nu"),
+    W("när"), W("någon"), W("något"), W("några"), W("och"), W("om"), W("oss"), W("på"),
+    W("samma"), W("sedan"), W("sig"), W("sin"), W("sina"), W("sitta"), W("själv"), W("skulle"),
+    W("som"), W("så"), W("sådan"), W("sådana"), W("sånt"), W("till"), W("under"), W("upp"),
+    W("ut"), W("utan"), W("vad"), W("var"), W("vara"), W("varför"), W("varit"), W("varje"),
+    W("vars"), W("vart"), W("vem"), W("vi"), W("vid"), W("vilka"), W("vilkas"), W("vilken"),
+    W("vilket"), W("vår"), W("våra"), W("vårt"), W("än"), W("är"), W("åt"), W("över"),
+};
+
+static const text_stop_word stop_turkish[] = {
+    W("acaba"), W("ama"), W("aslında"), W("az"), W("bazı"), W("belki"), W("biri"), W("birkaç"),
+    W("birşey"), W("biz"), W("bu"), W("da"), W("daha"), W("de"), W("defa"), W("diye"), W("en"),
+    W("eğer"), W("gibi"), W("hem"), W("hep"), W("hepsi"), W("her"), W("hiç"), W("ile"),
+    W("ise"), W("için"), W("kez"), W("ki"), W("kim"), W("mu"), W("mü"), W("mı"), W("nasıl"),
+    W("ne"), W("neden"), W("nerde"), W("nerede"), W("nereye"), W("niye"), W("niçin"), W("o"),
+    W("sanki"), W("siz"), W("tüm"), W("ve"), W("veya"), W("ya"), W("yani"), W("çok"),
+    W("çünkü"), W("şey"), W("şu"),
+};
+
+const text_stop_list text_stop_lists[] = {
+    { "danish", stop_danish, sizeof(stop_danish) / sizeof(stop_danish[0]) },
+    { "dutch", stop_dutch, sizeof(stop_dutch) / sizeof(stop_dutch[0]) },
+    { "english", stop_english, sizeof(stop_english) / sizeof(stop_english[0]) },
+    { "finnish", stop_finnish, sizeof(stop_finnish) / sizeof(stop_finnish[0]) },
+    { "french", stop_french, sizeof(stop_french) / sizeof(stop_french[0]) },
+    { "german", stop_german, sizeof(stop_german) / sizeof(stop_german[0]) },
+    { "hungarian", stop_hungarian, sizeof(stop_hungarian) / sizeof(stop_hungarian[0]) },
+    { "italian", stop_italian, sizeof(stop_italian) / sizeof(stop_italian[0]) },
+    { "norwegian", stop_norwegian, sizeof(stop_norwegian) / sizeof(stop_norwegian[0]) },
+    { "portuguese", stop_portuguese, sizeof(stop_portuguese) / sizeof(stop_portuguese[0]) },
+    { "romanian", stop_romanian, sizeof(stop_romanian) / sizeof(stop_romanian[0]) },
+    { "russian", stop_russian, sizeof(stop_russian) / sizeof(stop_russian[0]) },
+    { "spanish", stop_spanish, sizeof(stop_spanish) / sizeof(stop_spanish[0]) },
+    { "swedish", stop_swedish, sizeof(stop_swedish) / sizeof(stop_swedish[0]) },
+    { "turkish", stop_turkish, sizeof(stop_turkish) / sizeof(stop_turkish[0]) },
+    { NULL, NULL, 0 }
+};
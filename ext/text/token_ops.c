@@ -0,0 +1,279 @@
+#include "../text_bridge.h"
+#include "../text_internal.h"
+#include "../intern.h"
+
+/*
+ * wordBreak() / wordBreakAll() with token filters and termFrequency(), on
+ * the native token pipeline: filtered tokens are dropped before any PHP string is created,
+ * and terms are counted straight into the result array. With hash_bits,
+ * tokens are replaced by their MurmurHash3 column (as in HashingVectorizer,
+ * without the sign) and no string is created at all. termFrequencyFromFile()
+ * counts a file on disk the same way, read from a mapping (corpus_ops.c).
+ */
+
+typedef struct {
+    zend_bool enabled;
+    uint32_t mask;
+    uint32_t seed;
+} token_hash;
+
+static int token_hash_options(token_hash *th, zval *options, const char *fn)
+{
+    zval *value;
+
+    th->enabled = 0;
+    th->seed = 0;
+
+    if (Z_TYPE_P(options) != IS_ARRAY) {
+        return SUCCESS;
+    }
+
+    if ((value = zend_hash_str_find(Z_ARRVAL_P(options), ZEND_STRL("hash_bits"))) != NULL && zend_is_true(value)) {
+        zend_long bits = zval_get_long(value);
+
+        if (bits < 1 || bits > TEXT_HASH_MAX_BITS) {
+            zend_value_error("%s(): option 'hash_bits' must be between 1 and %d", fn, TEXT_HASH_MAX_BITS);
+            return FAILURE;
+        }
+        th->enabled = 1;
+        th->mask = (uint32_t) (((zend_ulong) 1 << bits) - 1);
+    }
+
+    if ((value = zend_hash_str_find(Z_ARRVAL_P(options), ZEND_STRL("seed"))) != NULL) {
+        th->seed = (uint32_t) zval_get_long(value);
+    }
+
+    return SUCCESS;
+}
+
+static zend_always_inline zend_ulong token_hash_column(const token_hash *th, const char *token, size_t len)
+{
+    return text_murmur3_32(token, len, th->seed) & th->mask;
+}
+
+/* ---------- Word break ---------- */
+
+typedef struct {
+    zval *tokens;
+    token_hash hash;
+} word_breaker;
+
+static void word_break_token(const char *token, size_t len, void *ctx)
+{
+    word_breaker *wb = (word_breaker *) ctx;
+
+    if (wb->hash.enabled) {
+        add_next_index_long(wb->tokens, (zend_long) token_hash_column(&wb->hash, token, len));
+    } else {
+        add_next_index_str(wb->tokens, cm_intern(token, len));
+    }
+}
+
+static int word_break_document(text_pipeline *tp, word_breaker *wb, zval *doc, zval *out)
+{
+    if (Z_TYPE_P(doc) != IS_STRING) {
+        zend_type_error("wordBreak(): text must be a string or an array of strings");
+        return FAILURE;
+    }
+
+    array_init(out);
+    wb->tokens = out;
+
+    return text_pipeline_run(tp, Z_STRVAL_P(doc), Z_STRLEN_P(doc), word_break_token, wb, "wordBreak");
+}
+
+void text_word_break_zval(zval *text, zval *locale, zval *options, zval *return_value)
+{
+    if (Z_TYPE_P(text) != IS_STRING && Z_TYPE_P(text) != IS_ARRAY) {
+        zend_type_error("wordBreak(): text must be a string or an array of strings");
+        return;
+    }
+
+    if (Z_TYPE_P(locale) != IS_STRING) {
+        zend_type_error("wordBreak(): locale must be a string");
+        return;
+    }
+
+    text_pipeline tp;
+    word_breaker wb;
+
+    if (token_hash_options(&wb.hash, options, "wordBreak") == FAILURE) {
+        return;
+    }
+
+    /* Tokens as written: only the filters and n-grams apply */
+    text_pipeline_defaults(&tp);
+    tp.locale = Z_STRVAL_P(locale);
+    tp.lowercase = 0;
+
+    if (text_pipeline_filter_options(&tp, options, "wordBreak") == FAILURE
+        || text_pipeline_start(&tp, "wordBreak") == FAILURE) {
+        return;
+    }
+
+    if (Z_TYPE_P(text) == IS_STRING) {
+        if (word_break_document(&tp, &wb, text, return_value) == FAILURE) {
+            zval_ptr_dtor(return_value);
+            ZVAL_NULL(return_value);
+        }
+    } else {
+        /* One token list per document, keys preserved */
+        zend_string *key;
+        zend_ulong idx;
+        zval *doc;
+        zval tokens;
+
+        array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(text)));
+
+        ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(text), idx, key, doc) {
+            ZVAL_UNDEF(&tokens);
+
+            if (word_break_document(&tp, &wb, doc, &tokens) == FAILURE) {
+                zval_ptr_dtor(&tokens);
+                zval_ptr_dtor(return_value);
+                ZVAL_NULL(return_value);
+                break;
+            }
+
+            if (key) {
+                zend_hash_update(Z_ARRVAL_P(return_value), key, &tokens);
+            } else {
+                zend_hash_index_update(Z_ARRVAL_P(return_value), idx, &tokens);
+            }
+        } ZEND_HASH_FOREACH_END();
+    }
+
+    text_pipeline_close(&tp);
+}
+
+/* ---------- Term frequency ---------- */
+
+typedef struct {
+    HashTable *counts;
+    zend_long total;
+    token_hash hash;
+} tf_counter;
+
+static void tf_count_token(const char *token, size_t len, void *ctx)
+{
+    tf_counter *tc = (tf_counter *) ctx;
+    zend_string *key = NULL;
+    zval *count;
+    zend_ulong column = 0;
+
+    if (tc->hash.enabled) {
+        column = token_hash_column(&tc->hash, token, len);
+        count = zend_hash_index_find(tc->counts, column);
+    } else if (cm_intern_active()) {
+        /* Shared key, hashed once when it was interned */
+        key = cm_intern(token, len);
+        count = zend_symtable_find(tc->counts, key);
+    } else {
+        count = zend_symtable_str_find(tc->counts, token, len);
+    }
+
+    if (count) {
+        Z_LVAL_P(count)++;
+    } else {
+        zval one;
+
+        ZVAL_LONG(&one, 1);
+        if (tc->hash.enabled) {
+            zend_hash_index_add_new(tc->counts, column, &one);
+        } else if (key) {
+            zend_symtable_update(tc->counts, key, &one);
+        } else {
+            zend_symtable_str_update(tc->counts, token, len, &one);
+        }
+    }
+
+    if (key) {
+        zend_string_release(key);
+    }
+
+    tc->total++;
+}
+
+static void tf_normalize(tf_counter *tc)
+{
+    zval *count;
+
+    if (tc->total == 0) {
+        return;
+    }
+
+    ZEND_HASH_FOREACH_VAL(tc->counts, count) {
+        ZVAL_DOUBLE(count, (double) Z_LVAL_P(count) / (double) tc->total);
+    } ZEND_HASH_FOREACH_END();
+}
+
+void text_term_frequency_zval(zval *text, zval *options, zend_bool normalize, zval *return_value)
+{
+    if (Z_TYPE_P(text) != IS_STRING) {
+        zend_type_error("termFrequency(): text must be a string");
+        return;
+    }
+
+    text_pipeline tp;
+    tf_counter tc;
+
+    if (token_hash_options(&tc.hash, options, "termFrequency") == FAILURE
+        || text_pipeline_open(&tp, options, "termFrequency") == FAILURE) {
+        return;
+    }
+
+    array_init(return_value);
+    tc.counts = Z_ARRVAL_P(return_value);
+    tc.total = 0;
+
+    if (text_pipeline_run(&tp, Z_STRVAL_P(text), Z_STRLEN_P(text), tf_count_token, &tc, "termFrequency") == FAILURE) {
+        zval_ptr_dtor(return_value);
+        ZVAL_NULL(return_value);
+    } else if (normalize) {
+        tf_normalize(&tc);
+    }
+
+    text_pipeline_close(&tp);
+}
+
+/* termFrequency() of a whole file, read through a read-only mapping */
+void text_term_frequency_file_zval(zval *path, zval *options, zend_bool normalize, zval *return_value)
+{
+    if (Z_TYPE_P(path) != IS_STRING) {
+        zend_type_error("termFrequencyFromFile(): path must be a string");
+        return;
+    }
+
+    if (strlen(Z_STRVAL_P(path)) != Z_STRLEN_P(path)) {
+        zend_value_error("termFrequencyFromFile(): path must not contain null bytes");
+        return;
+    }
+
+    text_pipeline tp;
+    text_mapped_file mf;
+    tf_counter tc;
+
+    if (token_hash_options(&tc.hash, options, "termFrequencyFromFile") == FAILURE
+        || text_pipeline_open(&tp, options, "termFrequencyFromFile") == FAILURE) {
+        return;
+    }
+
+    if (text_corpus_map(&mf, Z_STRVAL_P(path), "termFrequencyFromFile") == FAILURE) {
+        text_pipeline_close(&tp);
+        return;
+    }
+
+    array_init(return_value);
+    tc.counts = Z_ARRVAL_P(return_value);
+    tc.total = 0;
+
+    if (text_corpus_run(&tp, &mf, mf.data, mf.len, tf_count_token, &tc, "termFrequencyFromFile") == FAILURE) {
+        zval_ptr_dtor(return_value);
+        ZVAL_NULL(return_value);
+    } else if (normalize) {
+        tf_normalize(&tc);
+    }
+
+    text_corpus_unmap(&mf);
+    text_pipeline_close(&tp);
+}
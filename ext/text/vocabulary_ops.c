@@ -0,0 +1,337 @@
+#include "../text_bridge.h"
+#include "../text_internal.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*
+ * Vocabulary: terms mapped to dense integer ids.
+ *
+ * fit() runs every document through the token pipeline once, counting
+ * document and collection frequencies per distinct term, prunes by df and
+ * max_features, and numbers the surviving terms in byte order. encode() then
+ * turns a document into an ascending id => weight vector: the only string
+ * work left per token is one hash lookup, and tf, idf and normalization are
+ * applied on the integer-indexed accumulator shared with the hashing
+ * vectorizer.
+ */
+
+/* ---------- Fit ---------- */
+
+typedef struct {
+    HashTable terms;        /* term => slot */
+    zend_string **names;    /* slot => term (owned by the table) */
+    uint32_t *df;
+    uint32_t *last_doc;     /* 1-based document that last touched the slot */
+    zend_long *cf;
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t doc;
+} vocab_counts;
+
+typedef struct {
+    zend_string *name;
+    uint32_t df;
+    zend_long cf;
+} vocab_term;
+
+static void vocab_count_token(const char *token, size_t len, void *ctx)
+{
+    vocab_counts *vc = (vocab_counts *) ctx;
+    zval *found = zend_hash_str_find(&vc->terms, token, len);
+    uint32_t slot;
+
+    if (found) {
+        slot = (uint32_t) Z_LVAL_P(found);
+    } else {
+        zval zv;
+
+        if (vc->count == vc->capacity) {
+            vc->capacity = vc->capacity ? vc->capacity * 2 : 1024;
+            vc->names = erealloc(vc->names, sizeof(zend_string *) * vc->capacity);
+            vc->df = erealloc(vc->df, sizeof(uint32_t) * vc->capacity);
+            vc->last_doc = erealloc(vc->last_doc, sizeof(uint32_t) * vc->capacity);
+            vc->cf = erealloc(vc->cf, sizeof(zend_long) * vc->capacity);
+        }
+
+        slot = vc->count++;
+        ZVAL_LONG(&zv, slot);
+        zend_hash_str_add_new(&vc->terms, token, len, &zv);
+
+        vc->names[slot] = NULL;
+        vc->df[slot] = 0;
+        vc->last_doc[slot] = 0;
+        vc->cf[slot] = 0;
+    }
+
+    if (vc->last_doc[slot] != vc->doc) {
+        vc->last_doc[slot] = vc->doc;
+        vc->df[slot]++;
+    }
+    vc->cf[slot]++;
+}
+
+/* Most frequent first; ties in byte order so the cut is deterministic */
+static int vocab_cmp_frequency(const void *a, const void *b)
+{
+    const vocab_term *ta = (const vocab_term *) a;
+    const vocab_term *tb = (const vocab_term *) b;
+
+    if (ta->cf != tb->cf) {
+        return ta->cf > tb->cf ? -1 : 1;
+    }
+
+    return zend_binary_strcmp(ZSTR_VAL(ta->name), ZSTR_LEN(ta->name), ZSTR_VAL(tb->name), ZSTR_LEN(tb->name));
+}
+
+static int vocab_cmp_term(const void *a, const void *b)
+{
+    const vocab_term *ta = (const vocab_term *) a;
+    const vocab_term *tb = (const vocab_term *) b;
+
+    return zend_binary_strcmp(ZSTR_VAL(ta->name), ZSTR_LEN(ta->name), ZSTR_VAL(tb->name), ZSTR_LEN(tb->name));
+}
+
+static void vocab_counts_free(vocab_counts *vc)
+{
+    zend_hash_destroy(&vc->terms);
+
+    if (vc->names) {
+        efree(vc->names);
+        efree(vc->df);
+        efree(vc->last_doc);
+        efree(vc->cf);
+    }
+}
+
+void text_vocabulary_fit_zval(
+    zval *documents,
+    zval *options,
+    double min_df,
+    double max_df,
+    int max_features,
+    zend_bool smooth,
+    zval *return_value
+) {
+    if (Z_TYPE_P(documents) != IS_ARRAY) {
+        zend_type_error("vocabularyFit(): documents must be an array of strings");
+        return;
+    }
+
+    if (min_df < 0.0 || max_df < min_df) {
+        zend_value_error("vocabularyFit(): max_df corresponds to fewer documents than min_df");
+        return;
+    }
+
+    if (max_features < 0) {
+        zend_value_error("vocabularyFit(): max_features must be zero (no limit) or positive");
+        return;
+    }
+
+    text_pipeline tp;
+    vocab_counts vc = {0};
+    zval *doc;
+
+    if (text_pipeline_open(&tp, options, "vocabularyFit") == FAILURE) {
+        return;
+    }
+
+    zend_hash_init(&vc.terms, 1024, NULL, NULL, 0);
+
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(documents), doc) {
+        if (Z_TYPE_P(doc) != IS_STRING) {
+            zend_type_error("vocabularyFit(): documents must be strings");
+            break;
+        }
+
+        vc.doc++;
+        if (text_pipeline_run(&tp, Z_STRVAL_P(doc), Z_STRLEN_P(doc), vocab_count_token, &vc, "vocabularyFit") == FAILURE) {
+            break;
+        }
+    } ZEND_HASH_FOREACH_END();
+
+    text_pipeline_close(&tp);
+
+    if (EG(exception)) {
+        vocab_counts_free(&vc);
+        return;
+    }
+
+    /* Slot names are the table's own keys */
+    zend_string *name;
+    zval *slot;
+
+    ZEND_HASH_FOREACH_STR_KEY_VAL(&vc.terms, name, slot) {
+        vc.names[Z_LVAL_P(slot)] = name;
+    } ZEND_HASH_FOREACH_END();
+
+    /* Prune by document frequency, then keep the max_features most frequent */
+    vocab_term *kept = vc.count ? safe_emalloc(vc.count, sizeof(vocab_term), 0) : NULL;
+    uint32_t size = 0;
+
+    for (uint32_t i = 0; i < vc.count; i++) {
+        if ((double) vc.df[i] >= min_df && (double) vc.df[i] <= max_df) {
+            kept[size].name = vc.names[i];
+            kept[size].df = vc.df[i];
+            kept[size].cf = vc.cf[i];
+            size++;
+        }
+    }
+
+    if (max_features > 0 && size > (uint32_t) max_features) {
+        qsort(kept, size, sizeof(vocab_term), vocab_cmp_frequency);
+        size = (uint32_t) max_features;
+    }
+
+    qsort(kept, size, sizeof(vocab_term), vocab_cmp_term);
+
+    /* Model */
+    zval terms, df, idf;
+    zend_string *packed = zend_string_alloc(sizeof(float) * size, 0);
+    float *idf_values = (float *) ZSTR_VAL(packed);
+    double n = (double) vc.doc;
+
+    array_init_size(&terms, size);
+    array_init_size(&df, size);
+
+    for (uint32_t id = 0; id < size; id++) {
+        double d = (double) kept[id].df;
+
+        add_next_index_str(&terms, zend_string_copy(kept[id].name));
+        add_next_index_long(&df, kept[id].df);
+
+        /* Same formulas as Text::idf() */
+        idf_values[id] = smooth ? (float) (log((n + 1.0) / (d + 1.0)) + 1.0) : (float) log(n / d);
+    }
+
+    ZSTR_VAL(packed)[sizeof(float) * size] = '\0';
+    ZVAL_NEW_STR(&idf, packed);
+
+    array_init_size(return_value, 4);
+    add_assoc_zval(return_value, "terms", &terms);
+    add_assoc_zval(return_value, "df", &df);
+    add_assoc_zval(return_value, "idf", &idf);
+    add_assoc_long(return_value, "documents", vc.doc);
+
+    if (kept) {
+        efree(kept);
+    }
+    vocab_counts_free(&vc);
+}
+
+/* ---------- Encode ---------- */
+
+typedef struct {
+    text_sparse vec;
+    HashTable *index;
+    zend_long size;
+} vocab_encoder;
+
+static void vocab_encode_token(const char *token, size_t len, void *ctx)
+{
+    vocab_encoder *ve = (vocab_encoder *) ctx;
+    zval *id = zend_symtable_str_find(ve->index, token, len);
+
+    /* Out-of-vocabulary terms are dropped */
+    if (id && Z_TYPE_P(id) == IS_LONG && Z_LVAL_P(id) >= 0 && Z_LVAL_P(id) < ve->size) {
+        text_sparse_push(&ve->vec, (uint32_t) Z_LVAL_P(id), 1.0f);
+    }
+}
+
+static int vocab_encode_document(text_pipeline *tp, vocab_encoder *ve, zval *doc, int tf, const float *idf, int norm, zval *out)
+{
+    if (Z_TYPE_P(doc) != IS_STRING) {
+        zend_type_error("vocabularyEncode(): documents must be strings");
+        return FAILURE;
+    }
+
+    ve->vec.count = 0;
+
+    if (text_pipeline_run(tp, Z_STRVAL_P(doc), Z_STRLEN_P(doc), vocab_encode_token, ve, "vocabularyEncode") == FAILURE) {
+        return FAILURE;
+    }
+
+    text_sparse_finish(&ve->vec, tf, idf, norm);
+    text_sparse_emit(&ve->vec, out);
+
+    return SUCCESS;
+}
+
+void text_vocabulary_encode_zval(
+    zval *text,
+    zval *options,
+    zval *index,
+    zval *idf,
+    int tf,
+    int norm,
+    zval *return_value
+) {
+    if (Z_TYPE_P(text) != IS_STRING && Z_TYPE_P(text) != IS_ARRAY) {
+        zend_type_error("vocabularyEncode(): text must be a string or an array of strings");
+        return;
+    }
+
+    if (Z_TYPE_P(index) != IS_ARRAY) {
+        zend_type_error("vocabularyEncode(): index must be an array of term => id");
+        return;
+    }
+
+    vocab_encoder ve = {0};
+    const float *weights = NULL;
+
+    ve.index = Z_ARRVAL_P(index);
+    ve.size = zend_hash_num_elements(ve.index);
+
+    if (idf && Z_TYPE_P(idf) != IS_NULL) {
+        if (Z_TYPE_P(idf) != IS_STRING || Z_STRLEN_P(idf) != sizeof(float) * (size_t) ve.size) {
+            zend_value_error("vocabularyEncode(): idf must be packed float32 with one value per term");
+            return;
+        }
+        weights = (const float *) Z_STRVAL_P(idf);
+    }
+
+    if (tf != TEXT_TF_RAW && tf != TEXT_TF_LOG && tf != TEXT_TF_BINARY) {
+        zend_value_error("vocabularyEncode(): invalid tf weighting");
+        return;
+    }
+
+    if (norm != TEXT_NORM_NONE && norm != TEXT_NORM_L1 && norm != TEXT_NORM_L2) {
+        zend_value_error("vocabularyEncode(): invalid norm");
+        return;
+    }
+
+    text_pipeline tp;
+
+    if (text_pipeline_open(&tp, options, "vocabularyEncode") == FAILURE) {
+        return;
+    }
+
+    if (Z_TYPE_P(text) == IS_STRING) {
+        vocab_encode_document(&tp, &ve, text, tf, weights, norm, return_value);
+    } else {
+        /* One vector per document, keys preserved */
+        zend_string *key;
+        zend_ulong idx;
+        zval *doc;
+        zval vec;
+
+        array_init_size(return_value, zend_hash_num_elements(Z_ARRVAL_P(text)));
+
+        ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(text), idx, key, doc) {
+            if (vocab_encode_document(&tp, &ve, doc, tf, weights, norm, &vec) == FAILURE) {
+                zval_ptr_dtor(return_value);
+                ZVAL_NULL(return_value);
+                break;
+            }
+
+            if (key) {
+                zend_hash_update(Z_ARRVAL_P(return_value), key, &vec);
+            } else {
+                zend_hash_index_update(Z_ARRVAL_P(return_value), idx, &vec);
+            }
+        } ZEND_HASH_FOREACH_END();
+    }
+
+    text_sparse_free(&ve.vec);
+    text_pipeline_close(&tp);
+}
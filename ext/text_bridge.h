@@ -0,0 +1,33 @@
+#ifndef TEXT_BRIDGE_H
+#define TEXT_BRIDGE_H
+
+#include <php.h>
+
+/* Tokenizer/stemmer pipeline: filtered word break and term counts */
+void text_word_break_zval(zval *text, zval *locale, zval *options, zval *return_value);
+void text_term_frequency_zval(zval *text, zval *options, zend_bool normalize, zval *return_value);
+
+/* Stop-word lists: built-in per language, or registered once per process */
+void text_stop_words_zval(zval *name, zval *return_value);
+void text_stop_words_register_zval(zval *name, zval *words, zval *return_value);
+void text_stop_words_shutdown(void);
+
+/* Custom word-break rules, compiled once and registered by name for the process */
+void text_break_rules_register_zval(zval *name, zval *rules, zend_bool binary, zval *return_value);
+void text_break_rules_shutdown(void);
+
+/* Feature hashing over the tokenizer/stemmer pipeline */
+void text_hash_vectorize_zval(zval *text, zval *options, int bits, zend_bool alternate_sign, int tf, int norm, zend_long seed, int output, zval *return_value);
+
+/* Vocabulary: terms numbered in byte order after df pruning, sparse id => weight documents */
+void text_vocabulary_fit_zval(zval *documents, zval *options, double min_df, double max_df, int max_features, zend_bool smooth, zval *return_value);
+void text_vocabulary_encode_zval(zval *text, zval *options, zval *index, zval *idf, int tf, int norm, zval *return_value);
+
+/* Corpora on disk, mapped and tokenized in place: one document per file, or per line with lines */
+void text_corpus_idf_zval(zval *source, zend_bool lines, zval *options, zend_bool smooth, zval *return_value);
+void text_term_frequency_file_zval(zval *path, zval *options, zend_bool normalize, zval *return_value);
+
+/* Chunks of at most max_tokens words, by sentence (soft) or word (hard): substrings, or [start, end, tokens] byte ranges */
+void text_chunk_zval(zval *text, zval *locale, zend_long max_tokens, zend_long overlap, zend_bool hard, zend_bool offsets, zval *return_value);
+
+#endif /* TEXT_BRIDGE_H */
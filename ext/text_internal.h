@@ -0,0 +1,211 @@
+#ifndef TEXT_INTERNAL_H
+#define TEXT_INTERNAL_H
+
+#include <php.h>
+#include <unicode/ubrk.h>
+#include <unicode/utrans.h>
+
+/* Term frequency weighting constants */
+#define TEXT_TF_RAW    0
+#define TEXT_TF_LOG    1   /* sign(tf) · log(1 + |tf|) */
+#define TEXT_TF_BINARY 2
+
+/* Vector normalization constants (L1/L2 match LA_NORM_*) */
+#define TEXT_NORM_NONE -1
+#define TEXT_NORM_L1    0
+#define TEXT_NORM_L2    1
+
+/* Vectorizer output constants */
+#define TEXT_OUTPUT_SPARSE 0   /* index => value, ascending index */
+#define TEXT_OUTPUT_DENSE  1   /* list of 2^bits values */
+#define TEXT_OUTPUT_PACKED 2   /* float32 buffer, rows × 2^bits */
+
+/* Largest hashing space: 2^TEXT_HASH_MAX_BITS features */
+#define TEXT_HASH_MAX_BITS 30
+
+/* Token categories (types option), from the word break rule status */
+#define TEXT_TYPE_NUMBER 0x01   /* UBRK_WORD_NUMBER */
+#define TEXT_TYPE_LETTER 0x02   /* UBRK_WORD_LETTER */
+#define TEXT_TYPE_KANA   0x04   /* UBRK_WORD_KANA */
+#define TEXT_TYPE_IDEO   0x08   /* UBRK_WORD_IDEO */
+#define TEXT_TYPE_OTHER  0x10   /* any other non-zero status (custom break rules) */
+
+/* Longest word or character n-gram */
+#define TEXT_NGRAM_MAX 8
+
+/*
+ * Stop words: a built-in list (sorted table, bsearch) or a set of words
+ * registered once per process or passed with the call. Words are matched
+ * against the lowercased token as written, before remove_diacritics and stem.
+ */
+typedef struct {
+    const char *word;
+    size_t len;
+} text_stop_word;
+
+typedef struct {
+    const char *name;
+    const text_stop_word *words;
+    size_t count;
+} text_stop_list;
+
+extern const text_stop_list text_stop_lists[];
+
+typedef struct {
+    const text_stop_word *words;    /* built-in list */
+    size_t count;
+    HashTable *set;                 /* registered or per-call words */
+    zend_bool owned;                /* set belongs to this call */
+} text_stop_words;
+
+static zend_always_inline zend_bool text_stop_words_active(const text_stop_words *sw)
+{
+    return sw->words != NULL || sw->set != NULL;
+}
+
+/* option: true (language of stem_language, else of locale), a language or registered name, or an array of words */
+int text_stop_words_open(text_stop_words *sw, zval *option, const char *language, const char *locale, const char *fn);
+zend_bool text_stop_words_contains(const text_stop_words *sw, const char *word, size_t len);
+void text_stop_words_close(text_stop_words *sw);
+
+/*
+ * N-grams over the pipeline's terms. Word n-grams join the last min..max
+ * terms with a single space, kept in a sliding window that is reset per
+ * document; character n-grams are min..max grapheme clusters of each term
+ * padded with a space on both sides, so prefixes and suffixes stand out.
+ * Both are emitted shortest first, as soon as the term that ends them
+ * arrives.
+ */
+typedef struct {
+    int word_min, word_max;         /* 0 = terms as they are */
+    int char_min, char_max;         /* 0 = no character n-grams */
+
+    UBreakIterator *graphemes;      /* non-ASCII terms only */
+    char *window;                   /* last word_max - 1 terms, space-separated */
+    size_t window_len;
+    size_t window_capacity;
+    size_t starts[TEXT_NGRAM_MAX];
+    int terms;
+} text_ngrams;
+
+static zend_always_inline zend_bool text_ngrams_active(const text_ngrams *ng)
+{
+    return ng->word_max > 0 || ng->char_max > 0;
+}
+
+/*
+ * Word-break rules registered with Text::registerBreakRules(), kept compiled
+ * (binary) for the life of the process. Segments whose rule status is 0
+ * are skipped, as whitespace and punctuation are with the default rules.
+ */
+UBreakIterator *text_break_rules_open(const char *name, const char *fn);
+
+/*
+ * Token pipeline: ICU word breaking followed by the per-term steps of
+ * Text::termFrequency() (strip_numbers, remove_diacritics, lowercase, stem),
+ * run natively without creating a PHP string per token.
+ */
+typedef struct {
+    const char *locale;
+    zend_bool lowercase;
+    zend_bool remove_diacritics;
+    zend_bool strip_numbers;
+    const char *stem_language;      /* NULL = no stemming */
+    zval *stop_option;              /* stop_words option, resolved by text_pipeline_start() */
+    const char *break_rules;        /* registered rule set, NULL = the locale's word rules */
+    uint32_t types;                 /* TEXT_TYPE_* to keep, 0 = all */
+    int32_t min_length;             /* code points of the token as written, 0 = no bound */
+    int32_t max_length;
+    zend_bool simple_case;          /* ASCII lowercasing matches ICU for locale */
+
+    UBreakIterator *bi;
+    UTransliterator *trans;
+    struct sb_stemmer *stemmer;
+    text_stop_words stop;
+    text_ngrams ngrams;
+} text_pipeline;
+
+/* Receives each processed token as UTF-8 (not NUL-terminated) */
+typedef void (*text_token_fn)(const char *token, size_t len, void *ctx);
+
+/* ngrams / char_ngrams options: an int n (exactly n) or [min, max] */
+int text_ngrams_options(text_ngrams *ng, zval *options, const char *fn);
+int text_ngrams_open(text_ngrams *ng, const char *fn);
+void text_ngrams_reset(text_ngrams *ng);
+void text_ngrams_push(text_ngrams *ng, const char *term, size_t len, text_token_fn cb, void *ctx);
+void text_ngrams_close(text_ngrams *ng);
+
+/*
+ * open() = defaults() + options() + start(). Callers that only tokenize
+ * (wordBreak) set the fields themselves and read the options that also
+ * apply to raw tokens (strip_numbers, stop_words, break_rules, types,
+ * min_length, max_length, ngrams, char_ngrams) with filter_options().
+ * Errors are raised as "fn(): ...".
+ */
+void text_pipeline_defaults(text_pipeline *tp);
+int text_pipeline_options(text_pipeline *tp, zval *options, const char *fn);
+int text_pipeline_filter_options(text_pipeline *tp, zval *options, const char *fn);
+int text_pipeline_start(text_pipeline *tp, const char *fn);
+int text_pipeline_open(text_pipeline *tp, zval *options, const char *fn);
+int text_pipeline_run(text_pipeline *tp, const char *text, size_t len, text_token_fn cb, void *ctx, const char *fn);
+/* run() without starting a new document: the next piece of one, cut at a word boundary */
+int text_pipeline_feed(text_pipeline *tp, const char *text, size_t len, text_token_fn cb, void *ctx, const char *fn);
+void text_pipeline_close(text_pipeline *tp);
+
+/*
+ * Sparse vector accumulator shared by the vectorizers: push one entry per
+ * token, then finish() sorts by column, sums duplicates, drops columns that
+ * cancelled out, applies tf weighting, idf (indexed by column, optional)
+ * and normalization.
+ */
+typedef struct {
+    uint32_t index;
+    float value;
+} text_sparse_entry;
+
+typedef struct {
+    text_sparse_entry *entries;
+    size_t count;
+    size_t capacity;
+} text_sparse;
+
+static zend_always_inline void text_sparse_push(text_sparse *sp, uint32_t index, float value)
+{
+    if (sp->count == sp->capacity) {
+        sp->capacity = sp->capacity ? sp->capacity * 2 : 256;
+        sp->entries = erealloc(sp->entries, sizeof(text_sparse_entry) * sp->capacity);
+    }
+
+    sp->entries[sp->count].index = index;
+    sp->entries[sp->count].value = value;
+    sp->count++;
+}
+
+void text_sparse_finish(text_sparse *sp, int tf, const float *idf, int norm);
+void text_sparse_emit(const text_sparse *sp, zval *out);
+void text_sparse_free(text_sparse *sp);
+
+/*
+ * Files on disk, mapped read-only (mmap) and read sequentially: documents
+ * are fed to the pipeline straight from the mapping, in windows of
+ * TEXT_CORPUS_WINDOW bytes cut after whitespace, so no PHP string is
+ * created for their content and the UTF-16 scratch buffer stays bounded.
+ * Pages already processed are handed back to the page cache.
+ */
+#define TEXT_CORPUS_WINDOW (4 << 20)
+
+typedef struct {
+    const char *data;
+    size_t len;
+    size_t released;                /* bytes before this offset have been advised away */
+} text_mapped_file;
+
+int text_corpus_map(text_mapped_file *mf, const char *path, const char *fn);
+void text_corpus_unmap(text_mapped_file *mf);
+/* One document (a whole file or one line of it), as run() */
+int text_corpus_run(text_pipeline *tp, text_mapped_file *mf, const char *text, size_t len, text_token_fn cb, void *ctx, const char *fn);
+
+/* MurmurHash3 x86_32 */
+uint32_t text_murmur3_32(const char *key, size_t len, uint32_t seed);
+
+#endif /* TEXT_INTERNAL_H */
@@ -0,0 +1,55 @@
+<?php
+
+namespace Zephir\Optimizers\FunctionCall;
+
+use Zephir\Call;
+use Zephir\CompilationContext;
+use Zephir\CompiledExpression;
+use Zephir\Exception\CompilerException;
+use Zephir\Optimizers\OptimizerAbstract;
+
+class CmInternConfigureOptimizer extends OptimizerAbstract
+{
+    /**
+     * @param array $expression
+     * @param Call $call
+     * @param CompilationContext $context
+     * @return CompiledExpression
+     * @throws CompilerException
+     */
+    public function optimize(array $expression, Call $call, CompilationContext $context)
+    {
+        if (!isset($expression['parameters']) || count($expression['parameters']) !== 1) {
+            throw new CompilerException(
+                "'cm_intern_configure' requires exactly 1 parameter (limit)",
+                $expression
+            );
+        }
+
+        $params = $call->getReadOnlyResolvedParams(
+            $expression['parameters'],
+            $context,
+            $expression
+        );
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        // Add the intern table header
+        $context->headersManager->add('intern');
+
+        // Generate C code: cm_intern_configure(limit, &return_value)
+        $context->codePrinter->output(
+            sprintf(
+                "cm_intern_configure(zephir_get_intval(%s), &%s);",
+                $params[0],
+                $symbol->getName()
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+}
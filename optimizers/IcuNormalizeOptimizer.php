@@ -0,0 +1,57 @@
+<?php
+
+namespace Zephir\Optimizers\FunctionCall;
+
+use Zephir\Call;
+use Zephir\CompilationContext;
+use Zephir\CompiledExpression;
+use Zephir\Exception\CompilerException;
+use Zephir\Optimizers\OptimizerAbstract;
+
+class IcuNormalizeOptimizer extends OptimizerAbstract
+{
+    /**
+     * @param array $expression
+     * @param Call $call
+     * @param CompilationContext $context
+     * @return CompiledExpression
+     * @throws CompilerException
+     */
+    public function optimize(array $expression, Call $call, CompilationContext $context)
+    {
+        if (!isset($expression['parameters']) || count($expression['parameters']) !== 3) {
+            throw new CompilerException(
+                "'icu_normalize' requires exactly 3 parameters (text, form, stripMarks)",
+                $expression
+            );
+        }
+
+        $params = $call->getReadOnlyResolvedParams(
+            $expression['parameters'],
+            $context,
+            $expression
+        );
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        // Add the ICU bridge header
+        $context->headersManager->add('icu_bridge');
+
+        // Generate C code: icu_normalize(Z_STR_P(text), Z_STRVAL_P(form), strip_marks, &return_value)
+        $context->codePrinter->output(
+            sprintf(
+                "icu_normalize(Z_STR_P(%s), Z_STRVAL_P(%s), zephir_get_boolval(%s), &%s);",
+                $params[0],
+                $params[1],
+                $params[2],
+                $symbol->getName()
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+}
@@ -0,0 +1,48 @@
+<?php
+
+namespace Zephir\Optimizers\FunctionCall;
+
+use Zephir\Call;
+use Zephir\CompilationContext;
+use Zephir\CompiledExpression;
+use Zephir\Exception\CompilerException;
+use Zephir\Optimizers\OptimizerAbstract;
+
+class LibstemmerCacheStatsOptimizer extends OptimizerAbstract
+{
+    /**
+     * @param array $expression
+     * @param Call $call
+     * @param CompilationContext $context
+     * @return CompiledExpression
+     * @throws CompilerException
+     */
+    public function optimize(array $expression, Call $call, CompilationContext $context)
+    {
+        if (isset($expression['parameters']) && count($expression['parameters']) !== 0) {
+            throw new CompilerException(
+                "'libstemmer_cache_stats' takes no parameters",
+                $expression
+            );
+        }
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        // Add the Snowball bridge header
+        $context->headersManager->add('snowball_bridge');
+
+        // Generate C code: libstemmer_cache_stats(&return_value)
+        $context->codePrinter->output(
+            sprintf(
+                "libstemmer_cache_stats(&%s);",
+                $symbol->getName()
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+}
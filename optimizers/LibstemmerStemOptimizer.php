@@ -47,11 +47,25 @@ class LibstemmerStemOptimizer extends OptimizerAbstract
         /**
          * Create a temporary variable to hold the returned zend_string* from your bridge
          */
-        $symbol = $context->symbolTable->getTempVariableForWrite('string', $context, $expression);
+        $symbol = $context->symbolTable->getTempVariableForWrite('variable', $context, $expression);
         
         // Output the actual C call to the generated file
-        // We use ZVAL_STR to wrap the zend_string* returned by your bridge into the Zephir variable
-        $context->codePrinter->output("ZVAL_STR(&" . $symbol->getName() . ", libstemmer_stem(" . $word . ", " . $lang . "));");
+        // We use ZVAL_STR to wrap the zend_string* returned by your bridge into the Zephir variable,
+        // or ZVAL_NULL when the language is unknown
+        $context->codePrinter->output("{");
+        $context->codePrinter->increaseLevel();
+        $context->codePrinter->output("zend_string *stem = libstemmer_stem(" . $word . ", " . $lang . ");");
+        $context->codePrinter->output("if (stem) {");
+        $context->codePrinter->increaseLevel();
+        $context->codePrinter->output("ZVAL_STR(&" . $symbol->getName() . ", stem);");
+        $context->codePrinter->decreaseLevel();
+        $context->codePrinter->output("} else {");
+        $context->codePrinter->increaseLevel();
+        $context->codePrinter->output("ZVAL_NULL(&" . $symbol->getName() . ");");
+        $context->codePrinter->decreaseLevel();
+        $context->codePrinter->output("}");
+        $context->codePrinter->decreaseLevel();
+        $context->codePrinter->output("}");
 
         return new CompiledExpression('variable', $symbol->getName(), $expression);
     }
@@ -0,0 +1,48 @@
+<?php
+
+namespace Zephir\Optimizers\FunctionCall;
+
+use Zephir\Call;
+use Zephir\CompilationContext;
+use Zephir\CompiledExpression;
+use Zephir\Exception\CompilerException;
+use Zephir\Optimizers\OptimizerAbstract;
+
+class LinearAlgebraDenseForwardOptimizer extends OptimizerAbstract
+{
+    public function optimize(array $expression, Call $call, CompilationContext $context)
+    {
+        if (!isset($expression['parameters']) || count($expression['parameters']) !== 3) {
+            throw new CompilerException(
+                "'linear_algebra_dense_forward' requires 3 parameters (layers, inputs, batch)",
+                $expression
+            );
+        }
+
+        $params = $call->getReadOnlyResolvedParams(
+            $expression['parameters'],
+            $context,
+            $expression
+        );
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        $context->headersManager->add('lapack_bridge');
+
+        $context->codePrinter->output(
+            sprintf(
+                "linear_algebra_dense_forward_zval(%s, %s, zephir_get_intval(%s), &%s);",
+                $params[0],
+                $params[1],
+                $params[2],
+                $symbol->getName()
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+}
@@ -0,0 +1,46 @@
+<?php
+
+namespace Zephir\Optimizers\FunctionCall;
+
+use Zephir\Call;
+use Zephir\CompilationContext;
+use Zephir\CompiledExpression;
+use Zephir\Exception\CompilerException;
+use Zephir\Optimizers\OptimizerAbstract;
+
+class LinearAlgebraDenseSaveOptimizer extends OptimizerAbstract
+{
+    public function optimize(array $expression, Call $call, CompilationContext $context)
+    {
+        if (!isset($expression['parameters']) || count($expression['parameters']) !== 1) {
+            throw new CompilerException(
+                "'linear_algebra_dense_save' requires 1 parameter (layers)",
+                $expression
+            );
+        }
+
+        $params = $call->getReadOnlyResolvedParams(
+            $expression['parameters'],
+            $context,
+            $expression
+        );
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        $context->headersManager->add('lapack_bridge');
+
+        $context->codePrinter->output(
+            sprintf(
+                "linear_algebra_dense_save_zval(%s, &%s);",
+                $params[0],
+                $symbol->getName()
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+}
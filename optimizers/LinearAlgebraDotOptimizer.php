@@ -10,12 +10,22 @@ use Zephir\Optimizers\OptimizerAbstract;
 
 class LinearAlgebraDotOptimizer extends OptimizerAbstract
 {
+    /** Mirrors LA_SMALL_DOT_MAX in ext/linalg_small.h */
+    private const SMALL_DOT_MAX = 16;
+
     public function optimize(array $expression, Call $call, CompilationContext $context)
     {
         if (!isset($expression['parameters']) || count($expression['parameters']) !== 2) {
             throw new CompilerException("'linear_algebra_dot' requires exactly two parameters", $expression);
         }
 
+        $left = $this->innerCall($expression, 0, 'linear_algebra_vector_normalize', 2);
+        $right = $this->innerCall($expression, 1, 'linear_algebra_vector_normalize', 2);
+
+        if ($left !== null || $right !== null) {
+            return $this->optimizeNormalized($expression, $call, $context, $left, $right);
+        }
+
         $resolvedParams = $call->getReadOnlyResolvedParams(
             $expression['parameters'],
             $context,
@@ -30,10 +40,111 @@ class LinearAlgebraDotOptimizer extends OptimizerAbstract
 
         $context->headersManager->add('lapack_bridge');
 
+        /*
+         * When either operand is an array literal its length is known at
+         * compile time: emit the fixed-size stack kernel from linalg_small.h.
+         */
+        $length = $this->literalLength($expression, 0) ?? $this->literalLength($expression, 1);
+
+        if ($length !== null && $length > 0 && $length <= self::SMALL_DOT_MAX) {
+            $context->headersManager->add('linalg_small');
+
+            $context->codePrinter->output(
+                "ZVAL_DOUBLE(&{$symbol->getName()}, linear_algebra_dot_fixed({$resolvedParams[0]}, {$resolvedParams[1]}, {$length}));"
+            );
+
+            return new CompiledExpression('variable', $symbol->getName(), $expression);
+        }
+
         $context->codePrinter->output(
             "ZVAL_DOUBLE(&{$symbol->getName()}, linear_algebra_dot_zval({$resolvedParams[0]}, {$resolvedParams[1]}));"
         );
 
         return new CompiledExpression('variable', $symbol->getName(), $expression);
     }
+
+    /**
+     * dot(normalize(a, p), normalize(b, q)): one fused call, no temporary arrays.
+     * A side that is not normalized is passed with method -1 (LA_FUSED_RAW).
+     */
+    private function optimizeNormalized(
+        array $expression,
+        Call $call,
+        CompilationContext $context,
+        ?array $left,
+        ?array $right
+    ): CompiledExpression {
+        $parameters = [];
+
+        foreach ([0 => $left, 1 => $right] as $index => $inner) {
+            if ($inner !== null) {
+                $parameters[] = $inner['parameters'][0];
+                $parameters[] = $inner['parameters'][1];
+            } else {
+                $parameters[] = $expression['parameters'][$index];
+            }
+        }
+
+        $params = $call->getReadOnlyResolvedParams($parameters, $context, $expression);
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        $context->headersManager->add('lapack_bridge');
+
+        $i = 0;
+        $operands = [];
+        foreach ([$left, $right] as $inner) {
+            $operands[] = $params[$i++];
+            $operands[] = $inner !== null ? sprintf('zephir_get_intval(%s)', $params[$i++]) : '-1';
+        }
+
+        $context->codePrinter->output(
+            sprintf(
+                "ZVAL_DOUBLE(&%s, linear_algebra_dot_normalized_zval(%s, %s, %s, %s));",
+                $symbol->getName(),
+                $operands[0],
+                $operands[1],
+                $operands[2],
+                $operands[3]
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+
+    /**
+     * The parameter at $index when it is a direct call to $name with $count arguments
+     */
+    private function innerCall(array $expression, int $index, string $name, int $count): ?array
+    {
+        $param = $expression['parameters'][$index]['parameter'] ?? null;
+
+        if ($param === null || $param['type'] !== 'fcall' || ($param['name'] ?? null) !== $name) {
+            return null;
+        }
+
+        if (count($param['parameters'] ?? []) !== $count) {
+            return null;
+        }
+
+        return $param;
+    }
+
+    /**
+     * Element count of an array literal parameter, or null when it is not a literal
+     */
+    private function literalLength(array $expression, int $index): ?int
+    {
+        $param = $expression['parameters'][$index]['parameter'] ?? null;
+
+        if ($param === null || $param['type'] !== 'array') {
+            return null;
+        }
+
+        return count($param['left'] ?? []);
+    }
 }
\ No newline at end of file
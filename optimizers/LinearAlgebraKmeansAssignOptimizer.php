@@ -0,0 +1,50 @@
+<?php
+
+namespace Zephir\Optimizers\FunctionCall;
+
+use Zephir\Call;
+use Zephir\CompilationContext;
+use Zephir\CompiledExpression;
+use Zephir\Exception\CompilerException;
+use Zephir\Optimizers\OptimizerAbstract;
+
+class LinearAlgebraKmeansAssignOptimizer extends OptimizerAbstract
+{
+    public function optimize(array $expression, Call $call, CompilationContext $context)
+    {
+        if (!isset($expression['parameters']) || count($expression['parameters']) !== 5) {
+            throw new CompilerException(
+                "'linear_algebra_kmeans_assign' requires 5 parameters (x, rows, cols, centroids, k)",
+                $expression
+            );
+        }
+
+        $params = $call->getReadOnlyResolvedParams(
+            $expression['parameters'],
+            $context,
+            $expression
+        );
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        $context->headersManager->add('lapack_bridge');
+
+        $context->codePrinter->output(
+            sprintf(
+                "linear_algebra_kmeans_assign_zval(%s, zephir_get_intval(%s), zephir_get_intval(%s), %s, zephir_get_intval(%s), &%s);",
+                $params[0],
+                $params[1],
+                $params[2],
+                $params[3],
+                $params[4],
+                $symbol->getName()
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+}
@@ -0,0 +1,54 @@
+<?php
+
+namespace Zephir\Optimizers\FunctionCall;
+
+use Zephir\Call;
+use Zephir\CompilationContext;
+use Zephir\CompiledExpression;
+use Zephir\Exception\CompilerException;
+use Zephir\Optimizers\OptimizerAbstract;
+
+class LinearAlgebraKmeansOptimizer extends OptimizerAbstract
+{
+    public function optimize(array $expression, Call $call, CompilationContext $context)
+    {
+        if (!isset($expression['parameters']) || count($expression['parameters']) !== 9) {
+            throw new CompilerException(
+                "'linear_algebra_kmeans' requires 9 parameters (x, rows, cols, k, max_iter, tol, batch_size, seed, threads)",
+                $expression
+            );
+        }
+
+        $params = $call->getReadOnlyResolvedParams(
+            $expression['parameters'],
+            $context,
+            $expression
+        );
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        $context->headersManager->add('lapack_bridge');
+
+        $context->codePrinter->output(
+            sprintf(
+                "linear_algebra_kmeans_zval(%s, zephir_get_intval(%s), zephir_get_intval(%s), zephir_get_intval(%s), zephir_get_intval(%s), zephir_get_doubleval(%s), zephir_get_intval(%s), zephir_get_intval(%s), zephir_get_intval(%s), &%s);",
+                $params[0],
+                $params[1],
+                $params[2],
+                $params[3],
+                $params[4],
+                $params[5],
+                $params[6],
+                $params[7],
+                $params[8],
+                $symbol->getName()
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+}
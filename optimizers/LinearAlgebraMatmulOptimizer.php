@@ -10,6 +10,9 @@ use Zephir\Optimizers\OptimizerAbstract;
 
 class LinearAlgebraMatmulOptimizer extends OptimizerAbstract
 {
+    /** Mirrors LA_SMALL_MATMUL_MAX in ext/linalg_small.h */
+    private const SMALL_MATMUL_MAX = 64;
+
     public function optimize(array $expression, Call $call, CompilationContext $context)
     {
         if (!isset($expression['parameters']) || count($expression['parameters']) < 5) {
@@ -55,6 +58,40 @@ class LinearAlgebraMatmulOptimizer extends OptimizerAbstract
         $transpose_a = $params[5] ?? '0';
         $transpose_b = $params[6] ?? '0';
 
+        /*
+         * Literal sizes small enough for the stack kernels: emit the
+         * fixed-size entry point from linalg_small.h so the C compiler
+         * sees constant loop bounds and unrolls them.
+         */
+        $m = $this->literalInt($expression, 2);
+        $n = $this->literalInt($expression, 3);
+        $k = $this->literalInt($expression, 4);
+        $fixed_a = $this->literalBool($expression, 5);
+        $fixed_b = $this->literalBool($expression, 6);
+
+        if ($m !== null && $n !== null && $k !== null && $fixed_a !== null && $fixed_b !== null
+            && $m > 0 && $n > 0 && $k > 0
+            && $m * $n <= self::SMALL_MATMUL_MAX && $n * $k <= self::SMALL_MATMUL_MAX && $m * $k <= self::SMALL_MATMUL_MAX
+        ) {
+            $context->headersManager->add('linalg_small');
+
+            $context->codePrinter->output(
+                sprintf(
+                    "linear_algebra_matmul_fixed(%s, %s, %d, %d, %d, %d, %d, &%s);",
+                    $params[0],
+                    $params[1],
+                    $m,
+                    $n,
+                    $k,
+                    $fixed_a,
+                    $fixed_b,
+                    $symbol->getName()
+                )
+            );
+
+            return new CompiledExpression('variable', $symbol->getName(), $expression);
+        }
+
         $context->codePrinter->output(
             sprintf(
                 "linear_algebra_matmul_zval(%s, %s, zephir_get_intval(%s), zephir_get_intval(%s), zephir_get_intval(%s), zephir_get_boolval(%s), zephir_get_boolval(%s), &%s);",
@@ -71,4 +108,36 @@ class LinearAlgebraMatmulOptimizer extends OptimizerAbstract
 
         return new CompiledExpression('variable', $symbol->getName(), $expression);
     }
+
+    /**
+     * Value of an integer literal parameter, or null when it is not a literal
+     */
+    private function literalInt(array $expression, int $index): ?int
+    {
+        $param = $expression['parameters'][$index]['parameter'] ?? null;
+
+        if ($param === null || $param['type'] !== 'int') {
+            return null;
+        }
+
+        return (int) $param['value'];
+    }
+
+    /**
+     * 0/1 for a boolean literal parameter, 0 when omitted, null otherwise
+     */
+    private function literalBool(array $expression, int $index): ?int
+    {
+        if (!isset($expression['parameters'][$index])) {
+            return 0;
+        }
+
+        $param = $expression['parameters'][$index]['parameter'];
+
+        if ($param['type'] !== 'bool') {
+            return null;
+        }
+
+        return $param['value'] === 'true' ? 1 : 0;
+    }
 }
\ No newline at end of file
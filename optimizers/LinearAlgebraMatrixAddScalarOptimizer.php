@@ -19,6 +19,15 @@ class LinearAlgebraMatrixAddScalarOptimizer extends OptimizerAbstract
             );
         }
 
+        $inner = $expression['parameters'][0]['parameter'];
+
+        if ($inner['type'] === 'fcall'
+            && ($inner['name'] ?? null) === 'linear_algebra_matmul'
+            && count($inner['parameters'] ?? []) >= 5
+        ) {
+            return $this->optimizeMatmul($expression, $call, $context, $inner);
+        }
+
         $params = $call->getReadOnlyResolvedParams(
             $expression['parameters'],
             $context,
@@ -46,4 +55,53 @@ class LinearAlgebraMatrixAddScalarOptimizer extends OptimizerAbstract
 
         return new CompiledExpression('variable', $symbol->getName(), $expression);
     }
+
+    /**
+     * addScalar(matmul(a, b, m, n, k), t) → one cblas_sgemm with C preset to t
+     * and beta = 1, so the product never becomes a PHP array
+     */
+    private function optimizeMatmul(
+        array $expression,
+        Call $call,
+        CompilationContext $context,
+        array $inner
+    ): CompiledExpression {
+        $parameters = array_merge(
+            $inner['parameters'],
+            [$expression['parameters'][1], $expression['parameters'][2], $expression['parameters'][3]]
+        );
+        $count = count($inner['parameters']);
+
+        $params = $call->getReadOnlyResolvedParams($parameters, $context, $expression);
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        $context->headersManager->add('lapack_bridge');
+
+        $transpose_a = $count > 5 ? sprintf('zephir_get_boolval(%s)', $params[5]) : '0';
+        $transpose_b = $count > 6 ? sprintf('zephir_get_boolval(%s)', $params[6]) : '0';
+
+        $context->codePrinter->output(
+            sprintf(
+                "linear_algebra_matmul_add_scalar_zval(%s, %s, zephir_get_intval(%s), zephir_get_intval(%s), zephir_get_intval(%s), %s, %s, zephir_get_doubleval(%s), zephir_get_intval(%s), zephir_get_intval(%s), &%s);",
+                $params[0],
+                $params[1],
+                $params[2],
+                $params[3],
+                $params[4],
+                $transpose_a,
+                $transpose_b,
+                $params[$count],
+                $params[$count + 1],
+                $params[$count + 2],
+                $symbol->getName()
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
 }
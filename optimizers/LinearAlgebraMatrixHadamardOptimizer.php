@@ -10,6 +10,14 @@ use Zephir\Optimizers\OptimizerAbstract;
 
 class LinearAlgebraMatrixHadamardOptimizer extends OptimizerAbstract
 {
+    /**
+     * Scaling calls the chain may start with => the PHP method their errors name
+     */
+    private const SCALE_CALLS = [
+        'linear_algebra_matrix_scale' => 'matrixScale',
+        'linear_algebra_matrix_multiply_scalar' => 'matrixMultiplyScalar',
+    ];
+
     public function optimize(array $expression, Call $call, CompilationContext $context)
     {
         if (!isset($expression['parameters']) || count($expression['parameters']) !== 4) {
@@ -19,6 +27,12 @@ class LinearAlgebraMatrixHadamardOptimizer extends OptimizerAbstract
             );
         }
 
+        $affine = $this->affineOperand($expression, 0) ?? $this->affineOperand($expression, 1);
+
+        if ($affine !== null) {
+            return $this->optimizeAffine($expression, $call, $context, $affine);
+        }
+
         $params = $call->getReadOnlyResolvedParams(
             $expression['parameters'],
             $context,
@@ -46,4 +60,139 @@ class LinearAlgebraMatrixHadamardOptimizer extends OptimizerAbstract
 
         return new CompiledExpression('variable', $symbol->getName(), $expression);
     }
+
+    /**
+     * hadamard(addScalar(scale(a, s), t), b) → (s·a + t) ⊙ b in one fused call.
+     * Either link of the chain may be missing (s = 1 or t = 0).
+     */
+    private function optimizeAffine(
+        array $expression,
+        Call $call,
+        CompilationContext $context,
+        array $affine
+    ): CompiledExpression {
+        $parameters = [$affine['a'], $expression['parameters'][$affine['other']]];
+        if ($affine['scale'] !== null) {
+            $parameters[] = $affine['scale'];
+        }
+        if ($affine['shift'] !== null) {
+            $parameters[] = $affine['shift'];
+        }
+        $parameters[] = $expression['parameters'][2];
+        $parameters[] = $expression['parameters'][3];
+
+        $params = $call->getReadOnlyResolvedParams($parameters, $context, $expression);
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        $context->headersManager->add('lapack_bridge');
+
+        $i = 2;
+        $scale = $affine['scale'] !== null ? sprintf('zephir_get_doubleval(%s)', $params[$i++]) : '1.0';
+        $shift = $affine['shift'] !== null ? sprintf('zephir_get_doubleval(%s)', $params[$i++]) : '0.0';
+
+        $context->codePrinter->output(
+            sprintf(
+                "linear_algebra_affine_hadamard_zval(%s, %s, %s, %s, zephir_get_intval(%s), zephir_get_intval(%s), \"%s\", %d, &%s);",
+                $params[0],
+                $scale,
+                $shift,
+                $params[1],
+                $params[$i],
+                $params[$i + 1],
+                $affine['function'],
+                $affine['other'],
+                $symbol->getName()
+            )
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+
+    /**
+     * Decompose operand $index when it is scale(), addScalar() or
+     * addScalar(scale()) over the same rows/cols as the Hadamard product.
+     * 'function' is the innermost call, whose checks run first unfused
+     */
+    private function affineOperand(array $expression, int $index): ?array
+    {
+        $rows = $expression['parameters'][2]['parameter'];
+        $cols = $expression['parameters'][3]['parameter'];
+        $node = $expression['parameters'][$index]['parameter'] ?? null;
+        $scale = null;
+        $shift = null;
+        $function = null;
+
+        if ($this->isCall($node, 'linear_algebra_matrix_add_scalar', $rows, $cols)) {
+            $shift = $node['parameters'][1];
+            $node = $node['parameters'][0]['parameter'];
+            $function = 'matrixAddScalar';
+        }
+
+        foreach (self::SCALE_CALLS as $name => $method) {
+            if ($this->isCall($node, $name, $rows, $cols)) {
+                $scale = $node['parameters'][1];
+                $node = $node['parameters'][0]['parameter'];
+                $function = $method;
+                break;
+            }
+        }
+
+        if ($scale === null && $shift === null) {
+            return null;
+        }
+
+        return [
+            'a' => ['parameter' => $node] + $expression['parameters'][$index],
+            'scale' => $scale,
+            'shift' => $shift,
+            'function' => $function,
+            'other' => 1 - $index,
+        ];
+    }
+
+    /**
+     * True for a 4-argument call to $name whose rows/cols match the outer call
+     */
+    private function isCall(?array $node, string $name, array $rows, array $cols): bool
+    {
+        if ($node === null || $node['type'] !== 'fcall' || ($node['name'] ?? null) !== $name) {
+            return false;
+        }
+
+        if (count($node['parameters'] ?? []) !== 4) {
+            return false;
+        }
+
+        return $this->sameExpression($node['parameters'][2]['parameter'], $rows)
+            && $this->sameExpression($node['parameters'][3]['parameter'], $cols);
+    }
+
+    /**
+     * Structural equality of two expressions, ignoring source positions
+     */
+    private function sameExpression($a, $b): bool
+    {
+        if (!is_array($a) || !is_array($b)) {
+            return $a === $b;
+        }
+
+        unset($a['file'], $a['line'], $a['char'], $b['file'], $b['line'], $b['char']);
+
+        if (array_keys($a) !== array_keys($b)) {
+            return false;
+        }
+
+        foreach ($a as $key => $value) {
+            if (!$this->sameExpression($value, $b[$key])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
 }
@@ -0,0 +1,39 @@
+<?php
+
+namespace Zephir\Optimizers\FunctionCall;
+
+use Zephir\Call;
+use Zephir\CompilationContext;
+use Zephir\CompiledExpression;
+use Zephir\Exception\CompilerException;
+use Zephir\Optimizers\OptimizerAbstract;
+
+class LinearAlgebraSparseCosineOptimizer extends OptimizerAbstract
+{
+    public function optimize(array $expression, Call $call, CompilationContext $context)
+    {
+        if (!isset($expression['parameters']) || count($expression['parameters']) !== 2) {
+            throw new CompilerException("'linear_algebra_sparse_cosine' requires exactly two parameters", $expression);
+        }
+
+        $resolvedParams = $call->getReadOnlyResolvedParams(
+            $expression['parameters'],
+            $context,
+            $expression
+        );
+
+        $symbol = $context->symbolTable->getTempVariableForWrite(
+            'variable',
+            $context,
+            $expression
+        );
+
+        $context->headersManager->add('lapack_bridge');
+
+        $context->codePrinter->output(
+            "ZVAL_DOUBLE(&{$symbol->getName()}, linear_algebra_sparse_cosine_zval({$resolvedParams[0]}, {$resolvedParams[1]}));"
+        );
+
+        return new CompiledExpression('variable', $symbol->getName(), $expression);
+    }
+}
@@ -0,0 +1,222 @@
+<?php
+
+/**
+ * CoralMedia Activation Functions Test Suite
+ *
+ * Tests element-wise and row-wise activations:
+ * - relu, sigmoid, tanh, gelu
+ * - softmax, logSoftmax, logSumExp
+ */
+
+use CoralMedia\LinearAlgebra;
+use CoralMedia\Constants;
+
+class ActivationTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia Activation Functions Test Suite ===\n\n";
+
+        $this->testElementwise();
+        $this->testSoftmax();
+        $this->testMatmulPipeline();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    private function testElementwise(): void {
+        echo "### Element-wise Activations ###\n";
+
+        $x = [-2, -0.5, 0, 0.5, 2, 4];
+
+        $this->assertArray(LinearAlgebra::relu($x, 2, 3), [0, 0, 0, 0.5, 2, 4], "ReLU");
+        $this->assertArray(
+            LinearAlgebra::sigmoid($x, 2, 3),
+            array_map(fn($v) => 1 / (1 + exp(-$v)), $x),
+            "Sigmoid"
+        );
+        $this->assertArray(LinearAlgebra::tanh($x, 2, 3), array_map('tanh', $x), "Tanh");
+        $this->assertArray(
+            LinearAlgebra::gelu($x, 2, 3),
+            array_map(fn($v) => 0.5 * $v * (1 + tanh(sqrt(2 / M_PI) * ($v + 0.044715 * $v ** 3))), $x),
+            "GELU (tanh approximation)"
+        );
+        $this->assertArray(
+            LinearAlgebra::activation($x, 2, 3, Constants::LA_ACT_IDENTITY),
+            $x,
+            "Identity"
+        );
+        $this->assertArray(LinearAlgebra::sigmoid([-1000, 1000], 1, 2), [0, 1], "Sigmoid saturates without NaN");
+
+        echo "\n";
+    }
+
+    private function testSoftmax(): void {
+        echo "### Softmax ###\n";
+
+        $softmax = LinearAlgebra::softmax([1, 2, 3, 1, 1, 1], 2, 3);
+        $this->assertArray($softmax, [0.0900306, 0.2447285, 0.6652410, 1 / 3, 1 / 3, 1 / 3], "Row-wise softmax");
+        $this->assertScalar(array_sum(array_slice($softmax, 0, 3)), 1.0, "Softmax row sums to 1");
+
+        // Large logits must not overflow
+        $this->assertArray(
+            LinearAlgebra::softmax([1000, 1001, 1002], 1, 3),
+            [0.0900306, 0.2447285, 0.6652410],
+            "Softmax is shift-invariant (large logits)"
+        );
+
+        $this->assertArray(
+            LinearAlgebra::logSoftmax([1, 2, 3], 1, 3),
+            [-2.4076059, -1.4076059, -0.4076059],
+            "Log-softmax"
+        );
+
+        // Infinite logits: the limit, not NaN
+        $this->assertArray(
+            LinearAlgebra::softmax([INF, 1, INF, -INF, -INF, -INF], 2, 3),
+            [0.5, 0, 0.5, 1 / 3, 1 / 3, 1 / 3],
+            "Softmax with infinite logits"
+        );
+        $this->assertArray(
+            LinearAlgebra::logSoftmax([-INF, -INF], 1, 2),
+            [log(0.5), log(0.5)],
+            "Log-softmax with infinite logits"
+        );
+
+        $this->assertArray(
+            LinearAlgebra::logSumExp([1, 2, 3, 1000, 1001, 1002], 2, 3),
+            [3.4076059, 1002.4076059],
+            "Log-sum-exp per row",
+            0.001
+        );
+
+        echo "\n";
+    }
+
+    private function testMatmulPipeline(): void {
+        echo "### Matmul Pipeline ###\n";
+
+        // 2 samples × 3 features, 3 features × 2 classes
+        $x = [1, 0, 2, 0, 1, 1];
+        $w = [1, -1, 0, 2, 1, 0];
+        $logits = LinearAlgebra::matmul($x, $w, 2, 3, 2);
+        $probs = LinearAlgebra::softmax($logits, 2, 2);
+
+        $this->assertArray(
+            LinearAlgebra::matrixArgmax($probs, 2, 2, Constants::LA_AXIS_ROWS),
+            [0, 1],
+            "softmax(matmul) → argmax"
+        );
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::softmax([1, 2, 3], 2, 2);
+            },
+            "ValueError",
+            "Size mismatch"
+        );
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::activation([1, 2], 1, 2, 99);
+            },
+            "ValueError",
+            "Invalid activation"
+        );
+
+        echo "\n";
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertArray($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_array($actual) && $this->arraysEqual($actual, $expected, $epsilon)) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function arraysEqual(array $a, array $b, float $epsilon): bool {
+        if (count($a) !== count($b)) {
+            return false;
+        }
+
+        for ($i = 0; $i < count($a); $i++) {
+            if (abs($a[$i] - $b[$i]) > $epsilon) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new ActivationTestRunner($verbose);
+$runner->runTests();
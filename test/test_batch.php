@@ -0,0 +1,170 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * ICU Batch Test Suite
+ *
+ * Tests the array-in, array-out variants (wordBreakAll, sentenceBreakAll,
+ * lowercaseAll, removeDiacriticsAll): keys, parity with the single-string
+ * calls, and error handling
+ */
+
+use CoralMedia\Text;
+
+class BatchTestRunner
+{
+    private $verbose = false;
+    private $passed = 0;
+    private $failed = 0;
+
+    private $texts = [
+        'greeting' => 'Hello World',
+        'food' => 'Crème Brûlée',
+        7 => 'Zürich, São Paulo. İstanbul!',
+        'empty' => '',
+        'ja' => '私は学生です。',
+    ];
+
+    public function __construct(bool $verbose = false)
+    {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void
+    {
+        echo "=== CoralMedia ICU Batch Test Suite ===\n\n";
+
+        $this->testParity();
+        $this->testLocale();
+        $this->testWordBreakOptions();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    private function testParity(): void
+    {
+        echo "Test 1: Parity With Single-String Calls\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $this->assertSame(
+            Text::wordBreakAll($this->texts),
+            array_map(fn($t) => Text::wordBreak($t), $this->texts),
+            "wordBreakAll"
+        );
+        $this->assertSame(
+            Text::sentenceBreakAll($this->texts),
+            array_map(fn($t) => Text::sentenceBreak($t), $this->texts),
+            "sentenceBreakAll"
+        );
+        $this->assertSame(
+            Text::lowercaseAll($this->texts),
+            array_map(fn($t) => Text::lowercase($t), $this->texts),
+            "lowercaseAll"
+        );
+        $this->assertSame(
+            Text::removeDiacriticsAll($this->texts),
+            array_map(fn($t) => Text::removeDiacritics($t), $this->texts),
+            "removeDiacriticsAll"
+        );
+
+        $this->assertSame(array_keys(Text::lowercaseAll($this->texts)), array_keys($this->texts), "String and integer keys are preserved");
+        $this->assertSame(Text::lowercaseAll([]), [], "Empty batch");
+        $this->assertSame(Text::wordBreakAll([]), [], "Empty batch (wordBreakAll)");
+        echo "\n";
+    }
+
+    private function testLocale(): void
+    {
+        echo "Test 2: Locale\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $this->assertSame(
+            Text::lowercaseAll(['a' => 'İSTANBUL', 'b' => 'DİYARBAKIR'], 'tr_TR'),
+            ['a' => 'istanbul', 'b' => 'diyarbakır'],
+            "Turkish casing applies to every element"
+        );
+        $this->assertSame(
+            Text::wordBreakAll(['私は学生です'], 'ja_JP'),
+            [Text::wordBreak('私は学生です', 'ja_JP')],
+            "Japanese segmentation"
+        );
+        echo "\n";
+    }
+
+    private function testWordBreakOptions(): void
+    {
+        echo "Test 3: wordBreakAll Options\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $options = ['strip_numbers' => true, 'stop_words' => true];
+        $texts = ['x' => 'The 3 cats sat on the mat', 'y' => 'A dog and 42 birds'];
+
+        $this->assertSame(
+            Text::wordBreakAll($texts, 'en_US', $options),
+            array_map(fn($t) => Text::wordBreak($t, 'en_US', $options), $texts),
+            "Options go through the token pipeline, keys preserved"
+        );
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void
+    {
+        echo "Test 4: Error Handling\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $calls = [
+            'wordBreakAll' => fn() => Text::wordBreakAll(['ok', 42]),
+            'sentenceBreakAll' => fn() => Text::sentenceBreakAll(['ok', null]),
+            'lowercaseAll' => fn() => Text::lowercaseAll(['ok', ['nested']]),
+            'removeDiacriticsAll' => fn() => Text::removeDiacriticsAll([1.5]),
+        ];
+
+        foreach ($calls as $name => $fn) {
+            try {
+                $fn();
+                echo "  ✗ {$name}: no error for a non-string element\n";
+                $this->failed++;
+            } catch (TypeError $e) {
+                echo "  ✓ {$name} throws TypeError for a non-string element\n";
+                $this->passed++;
+            }
+        }
+        echo "\n";
+    }
+
+    private function assertSame($actual, $expected, string $desc): void
+    {
+        if ($actual === $expected) {
+            echo "  ✓ {$desc}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$desc}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected, JSON_UNESCAPED_UNICODE) . "\n";
+                echo "    Got:      " . json_encode($actual, JSON_UNESCAPED_UNICODE) . "\n";
+            }
+            $this->failed++;
+        }
+    }
+
+    private function printSummary(): void
+    {
+        $total = $this->passed + $this->failed;
+        echo "\n=== Test Summary ===\n";
+        echo sprintf("Total:  %d tests\n", $total);
+        echo sprintf("✓ Passed: %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed: %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Run tests
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+$runner = new BatchTestRunner($verbose);
+$runner->runTests();
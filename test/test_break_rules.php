@@ -0,0 +1,177 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * Custom Break Rules Test Suite
+ *
+ * Tests word-break rules registered with Text::registerBreakRules() and
+ * selected with the break_rules option
+ */
+
+use CoralMedia\Text;
+
+class BreakRulesTestRunner
+{
+    private $verbose = false;
+    private $passed = 0;
+    private $failed = 0;
+
+    private $rules = <<<'RULES'
+!!chain;
+$Alnum = [[:Alphabetic:][:Nd:][:M:]];
+$Host  = [[:Alphabetic:][:Nd:]\-]+ (\. [[:Alphabetic:][:Nd:]\-]+)+;
+
+$Alnum+ (['’] $Alnum+)*                   {200};
+[:Nd:]+ (\. [:Nd:]+)+                     {100};
+[\#\@] $Alnum+                            {200};
+[:Alphabetic:]+ [\+\#]+                   {200};
+[:Alphabetic:]+ \: \/ \/ [^[:White_Space:]\<\>\"]*[^[:White_Space:]\<\>\"\.\,\;\:\!\?\)] {300};
+[[:Alphabetic:][:Nd:]\.\_\%\+\-]+ \@ $Host {300};
+RULES;
+
+    private $text = 'Mail john.doe@example.com or see https://example.com/a?b=1. C++ and C# #nlp v2.10.3, don\'t!';
+
+    public function __construct(bool $verbose = false)
+    {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void
+    {
+        echo "=== CoralMedia Custom Break Rules Test Suite ===\n\n";
+
+        $this->testWordBreak();
+        $this->testPipeline();
+        $this->testBinaryRules();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    private function testWordBreak(): void
+    {
+        echo "Test 1: wordBreak() with break_rules\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $compiled = Text::registerBreakRules('web', $this->rules);
+        $this->assertTrue(is_string($compiled) && strlen($compiled) > 0, "Compiled rules are returned");
+
+        $this->assertSame(
+            Text::wordBreak($this->text, 'en_US', ['break_rules' => 'web']),
+            ['Mail', 'john.doe@example.com', 'or', 'see', 'https://example.com/a?b=1', 'C++', 'and', 'C#', '#nlp', 'v2.10.3', 'don\'t'],
+            "URLs, e-mail, C++, hashtags and versions stay whole"
+        );
+        $this->assertTrue(in_array('C', Text::wordBreak($this->text), true), "Default rules are unchanged");
+
+        $this->assertSame(
+            Text::wordBreak($this->text, 'en_US', ['break_rules' => 'web', 'stop_words' => true]),
+            ['Mail', 'john.doe@example.com', 'see', 'https://example.com/a?b=1', 'C++', 'C#', '#nlp', 'v2.10.3'],
+            "Combined with stop_words"
+        );
+
+        Text::registerBreakRules('letters', '[a-z]+;');
+        $this->assertSame(Text::wordBreak('abc def', 'en_US', ['break_rules' => 'letters']), [], "Untagged segments are skipped");
+        echo "\n";
+    }
+
+    private function testPipeline(): void
+    {
+        echo "Test 2: termFrequency() and idf()\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $tf = Text::termFrequency($this->text, ['break_rules' => 'web']);
+        $this->assertTrue(($tf['c++'] ?? 0) === 1 && ($tf['john.doe@example.com'] ?? 0) === 1, "Terms are lowercased after breaking");
+
+        $idf = Text::idf(['Learn C++ today', 'C# or C++?', 'Java'], ['break_rules' => 'web', 'smooth' => false]);
+        $this->assertTrue(isset($idf['c++']) && abs($idf['c++'] - log(3 / 2)) < 1e-9, "idf() counts whole tokens");
+        echo "\n";
+    }
+
+    private function testBinaryRules(): void
+    {
+        echo "Test 3: Compiled Rules\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $compiled = Text::registerBreakRules('web', $this->rules);
+        $this->assertSame(Text::registerBreakRules('web-binary', $compiled, true), $compiled, "Binary rules register as they are");
+        $this->assertSame(
+            Text::wordBreak($this->text, 'en_US', ['break_rules' => 'web-binary']),
+            Text::wordBreak($this->text, 'en_US', ['break_rules' => 'web']),
+            "Binary rules break the same way"
+        );
+
+        Text::registerBreakRules('web-binary', '[a-z]+ {200};');
+        $this->assertSame(Text::wordBreak('C++ abc', 'en_US', ['break_rules' => 'web-binary']), ['abc'], "Registering a name again replaces the rules");
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void
+    {
+        echo "Test 4: Error Handling\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $calls = [
+            "Unknown rule set" => fn() => Text::wordBreak('text', 'en_US', ['break_rules' => 'missing']),
+            "Invalid rule syntax" => fn() => Text::registerBreakRules('bad', '$x = [a-z;'),
+            "Invalid binary rules" => fn() => Text::registerBreakRules('bad', 'not compiled rules', true),
+        ];
+
+        foreach ($calls as $desc => $fn) {
+            try {
+                $fn();
+                echo "  ✗ {$desc}: no error thrown\n";
+                $this->failed++;
+            } catch (ValueError $e) {
+                echo "  ✓ {$desc} throws ValueError\n";
+                $this->passed++;
+            }
+        }
+        echo "\n";
+    }
+
+    private function assertTrue(bool $condition, string $desc): void
+    {
+        if ($condition) {
+            echo "  ✓ {$desc}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$desc}\n";
+            $this->failed++;
+        }
+    }
+
+    private function assertSame($actual, $expected, string $desc): void
+    {
+        if ($actual === $expected) {
+            echo "  ✓ {$desc}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$desc}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected, JSON_UNESCAPED_UNICODE) . "\n";
+                echo "    Got:      " . json_encode($actual, JSON_UNESCAPED_UNICODE) . "\n";
+            }
+            $this->failed++;
+        }
+    }
+
+    private function printSummary(): void
+    {
+        $total = $this->passed + $this->failed;
+        echo "\n=== Test Summary ===\n";
+        echo sprintf("Total:  %d tests\n", $total);
+        echo sprintf("✓ Passed: %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed: %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Run tests
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+$runner = new BreakRulesTestRunner($verbose);
+$runner->runTests();
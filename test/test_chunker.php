@@ -0,0 +1,177 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * Chunker Test Suite
+ *
+ * Tests the token-budget chunker: soft (sentence) and hard (word)
+ * boundaries, overlap, byte offsets, and option validation
+ */
+
+use CoralMedia\Text;
+use CoralMedia\Text\Chunker;
+
+class ChunkerTestRunner
+{
+    private $verbose = false;
+    private $passed = 0;
+    private $failed = 0;
+
+    private $text = "One two three. Four five six seven! Eight nine.  Ten eleven twelve thirteen fourteen fifteen sixteen. Done.  ";
+
+    public function __construct(bool $verbose = false)
+    {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void
+    {
+        echo "=== CoralMedia Chunker Test Suite ===\n\n";
+
+        $this->testSoftBoundaries();
+        $this->testHardBoundaries();
+        $this->testOffsets();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    private function testSoftBoundaries(): void
+    {
+        echo "Test 1: Soft Boundaries\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $this->assertSame(
+            (new Chunker(['max_tokens' => 7]))->chunk($this->text),
+            ["One two three. Four five six seven!", "Eight nine.", "Ten eleven twelve thirteen fourteen fifteen sixteen.", "Done."],
+            "Whole sentences while they fit"
+        );
+        $this->assertSame(
+            (new Chunker(['max_tokens' => 5, 'overlap' => 2]))->chunk($this->text),
+            ["One two three.", "Four five six seven!", "Eight nine.", "Ten eleven twelve thirteen fourteen", "thirteen fourteen fifteen sixteen.", "Done."],
+            "Long sentence split at words, overlap inside it"
+        );
+        $this->assertSame(
+            (new Chunker(['max_tokens' => 6, 'overlap' => 3]))->chunk("A b. C d e. F g h. I j."),
+            ["A b. C d e.", "C d e. F g h.", "F g h. I j."],
+            "Overlap by whole trailing sentences"
+        );
+        $this->assertSame(
+            (new Chunker(['max_tokens' => 6, 'overlap' => 2, 'locale' => 'ja_JP']))->chunk("私は学生です。東京大学で日本語を勉強しています。今日はいい天気ですね。"),
+            ["私は学生です。", "東京大学で日本語を勉強", "を勉強しています。", "今日はいい天気ですね。"],
+            "Japanese"
+        );
+        $this->assertSame((new Chunker())->chunk(""), [], "Empty text");
+        $this->assertSame((new Chunker())->chunk(" ... !! "), [], "No words");
+        echo "\n";
+    }
+
+    private function testHardBoundaries(): void
+    {
+        echo "Test 2: Hard Boundaries\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $chunks = (new Chunker(['max_tokens' => 4, 'overlap' => 1, 'boundary' => 'hard']))->chunk($this->text);
+        $this->assertSame(
+            $chunks,
+            ["One two three. Four", "Four five six seven", "seven! Eight nine.  Ten", "Ten eleven twelve thirteen", "thirteen fourteen fifteen sixteen", "sixteen. Done"],
+            "Fixed windows of words, sharing overlap words"
+        );
+        $this->assertSame(
+            array_map(fn($c) => count(Text::wordBreak($c)), $chunks),
+            [4, 4, 4, 4, 4, 2],
+            "Every chunk but the last has max_tokens words"
+        );
+        echo "\n";
+    }
+
+    private function testOffsets(): void
+    {
+        echo "Test 3: Byte Offsets\n";
+        echo str_repeat('-', 50) . "\n";
+
+        foreach (['soft', 'hard'] as $boundary) {
+            $chunker = new Chunker(['max_tokens' => 5, 'overlap' => 1, 'boundary' => $boundary]);
+            $ranges = $chunker->chunkOffsets($this->text);
+
+            $this->assertSame(
+                array_map(fn($r) => substr($this->text, $r[0], $r[1] - $r[0]), $ranges),
+                $chunker->chunk($this->text),
+                "{$boundary}: substr() of each range is the chunk"
+            );
+            $this->assertSame(
+                array_map(fn($r) => $r[2], $ranges),
+                array_map(fn($c) => count(Text::wordBreak($c)), $chunker->chunk($this->text)),
+                "{$boundary}: token counts"
+            );
+        }
+
+        $text = "Crème brûlée. Ça va très bien.";
+        $this->assertSame(
+            (new Chunker(['max_tokens' => 2]))->chunkOffsets($text),
+            [[0, 16, 2], [17, 23, 2], [24, strlen($text), 2]],
+            "Offsets are bytes, not characters"
+        );
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void
+    {
+        echo "Test 4: Error Handling\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $cases = [
+            "max_tokens must be > 0" => ['max_tokens' => 0],
+            "overlap must be less than max_tokens" => ['max_tokens' => 4, 'overlap' => 4],
+            "overlap must not be negative" => ['overlap' => -1],
+            "boundary must be soft or hard" => ['boundary' => 'paragraph'],
+        ];
+
+        foreach ($cases as $desc => $options) {
+            try {
+                new Chunker($options);
+                echo "  ✗ {$desc} - Expected ValueError but no error thrown\n";
+                $this->failed++;
+            } catch (ValueError $e) {
+                echo "  ✓ {$desc}\n";
+                $this->passed++;
+            }
+        }
+        echo "\n";
+    }
+
+    private function assertSame($actual, $expected, string $desc): void
+    {
+        if ($actual === $expected) {
+            echo "  ✓ {$desc}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$desc}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected, JSON_UNESCAPED_UNICODE) . "\n";
+                echo "    Got:      " . json_encode($actual, JSON_UNESCAPED_UNICODE) . "\n";
+            }
+            $this->failed++;
+        }
+    }
+
+    private function printSummary(): void
+    {
+        $total = $this->passed + $this->failed;
+        echo "\n=== Test Summary ===\n";
+        echo sprintf("Total:  %d tests\n", $total);
+        echo sprintf("✓ Passed: %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed: %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Run tests
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+$runner = new ChunkerTestRunner($verbose);
+$runner->runTests();
@@ -0,0 +1,138 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * ICU Counting Test Suite
+ *
+ * Tests the count-only calls (countWords, countSentences, textStats):
+ * parity with count() over wordBreak() and sentenceBreak(), grapheme
+ * counting, and edge cases
+ */
+
+use CoralMedia\Text;
+
+class CountsTestRunner
+{
+    private $verbose = false;
+    private $passed = 0;
+    private $failed = 0;
+
+    private $texts = [
+        'en_US' => "Hello world. How are you? Fine! I'm running, aren't you? Mr. Smith paid \$5.99.",
+        'ja_JP' => "私は学生です。東京大学で日本語を勉強しています。",
+        'th_TH' => "ภาษาไทยไม่มีการเว้นวรรคระหว่างคำ",
+        'fr_FR' => "Crème brûlée à Zürich. São Paulo : naïve café 👍🏽 famille 👨‍👩‍👧 fin",
+    ];
+
+    public function __construct(bool $verbose = false)
+    {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void
+    {
+        echo "=== CoralMedia ICU Counting Test Suite ===\n\n";
+
+        $this->testParity();
+        $this->testTextStats();
+        $this->testEdgeCases();
+
+        $this->printSummary();
+    }
+
+    private function testParity(): void
+    {
+        echo "Test 1: Parity With wordBreak() and sentenceBreak()\n";
+        echo str_repeat('-', 50) . "\n";
+
+        foreach ($this->texts as $locale => $text) {
+            $this->assertSame(Text::countWords($text, $locale), count(Text::wordBreak($text, $locale)), "{$locale}: countWords");
+            $this->assertSame(Text::countSentences($text, $locale), count(Text::sentenceBreak($text, $locale)), "{$locale}: countSentences");
+        }
+        echo "\n";
+    }
+
+    private function testTextStats(): void
+    {
+        echo "Test 2: textStats\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $this->assertSame(
+            Text::textStats("Hello world. How are you? Fine!"),
+            ['words' => 6, 'sentences' => 3, 'graphemes' => 31, 'bytes' => 31, 'avg_word_length' => 23 / 6],
+            "English"
+        );
+
+        $stats = Text::textStats("naïve cafe\u{0301} 👨‍👩‍👧", 'fr_FR');
+        $this->assertSame($stats['graphemes'], 12, "Combining marks and emoji sequences are one grapheme");
+        $this->assertSame($stats['avg_word_length'], 4.5, "Word length in graphemes, not bytes");
+
+        foreach ($this->texts as $locale => $text) {
+            $stats = Text::textStats($text, $locale);
+            $words = Text::wordBreak($text, $locale);
+            $this->assertSame(
+                [$stats['words'], $stats['sentences'], $stats['bytes']],
+                [count($words), count(Text::sentenceBreak($text, $locale)), strlen($text)],
+                "{$locale}: counts agree with the other calls"
+            );
+            $this->assertSame(
+                round($stats['avg_word_length'], 9),
+                round(array_sum(array_map(fn($w) => preg_match_all('/\X/u', $w), $words)) / count($words), 9),
+                "{$locale}: avg_word_length"
+            );
+        }
+        echo "\n";
+    }
+
+    private function testEdgeCases(): void
+    {
+        echo "Test 3: Edge Cases\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $this->assertSame(Text::countWords(""), 0, "Empty text has no words");
+        $this->assertSame(Text::countSentences(""), 0, "Empty text has no sentences");
+        $this->assertSame(Text::countWords(" ,. \n"), 0, "Punctuation is not a word");
+        $this->assertSame(
+            Text::textStats(""),
+            ['words' => 0, 'sentences' => 0, 'graphemes' => 0, 'bytes' => 0, 'avg_word_length' => 0.0],
+            "Empty textStats"
+        );
+        $this->assertSame(Text::countWords("bad \xff utf8 word"), 3, "Ill-formed UTF-8 is counted, not rejected");
+        echo "\n";
+    }
+
+    private function assertSame($actual, $expected, string $desc): void
+    {
+        if ($actual === $expected) {
+            echo "  ✓ {$desc}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$desc}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected, JSON_UNESCAPED_UNICODE) . "\n";
+                echo "    Got:      " . json_encode($actual, JSON_UNESCAPED_UNICODE) . "\n";
+            }
+            $this->failed++;
+        }
+    }
+
+    private function printSummary(): void
+    {
+        $total = $this->passed + $this->failed;
+        echo "\n=== Test Summary ===\n";
+        echo sprintf("Total:  %d tests\n", $total);
+        echo sprintf("✓ Passed: %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed: %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Run tests
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+$runner = new CountsTestRunner($verbose);
+$runner->runTests();
@@ -0,0 +1,235 @@
+<?php
+
+/**
+ * CoralMedia Dense Model Test Suite
+ *
+ * Tests packed buffers and the fused DenseModel forward pass
+ */
+
+use CoralMedia\LinearAlgebra;
+use CoralMedia\LinearAlgebra\DenseModel;
+use CoralMedia\Constants;
+
+class DenseModelTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia Dense Model Test Suite ===\n\n";
+
+        $this->testPacking();
+        $this->testForwardPass();
+        $this->testAgainstElementwisePipeline();
+        $this->testPersistence();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    private function testPacking(): void {
+        echo "### Packed Buffers ###\n";
+
+        $packed = LinearAlgebra::pack([1, 2.5, -3]);
+        $this->assertScalar(strlen($packed), 12, "pack() produces 4 bytes per value");
+        $this->assertArray(LinearAlgebra::unpack($packed), [1, 2.5, -3], "unpack(pack(x)) round trip");
+
+        echo "\n";
+    }
+
+    private function testForwardPass(): void {
+        echo "### Forward Pass ###\n";
+
+        // Layer 1: 3 → 2, ReLU. Layer 2: 2 → 3, identity.
+        $model = (new DenseModel())
+            ->addLayer([1, -1, 0, 2, 1, 0], [0.5, -10], 3, 2, Constants::LA_ACT_RELU)
+            ->addLayer([1, 1, -1, 2, 0, 1], [0, 0, 0], 2, 3);
+
+        $this->assertArray(
+            $model->predict([1, 0, 2, 0, 1, 1], 2),
+            [3.5, 3.5, -3.5, 1.5, 1.5, -1.5],
+            "Two-layer MLP, batch of 2"
+        );
+
+        $fromSpec = new DenseModel([
+            ["weights" => [1, 1], "bias" => [0, 0], "inputs" => 1, "outputs" => 2, "activation" => Constants::LA_ACT_SOFTMAX]
+        ]);
+        $this->assertArray($fromSpec->predict([3], 1), [0.5, 0.5], "Constructor layer specs with softmax");
+
+        echo "\n";
+    }
+
+    private function testAgainstElementwisePipeline(): void {
+        echo "### Matches matmul + add + activation ###\n";
+
+        mt_srand(7);
+        $in = 5; $out = 4; $batch = 3;
+        $w = []; $b = []; $x = [];
+        for ($i = 0; $i < $in * $out; $i++) { $w[] = mt_rand(-100, 100) / 100; }
+        for ($i = 0; $i < $out; $i++) { $b[] = mt_rand(-100, 100) / 100; }
+        for ($i = 0; $i < $batch * $in; $i++) { $x[] = mt_rand(-100, 100) / 100; }
+
+        $bias = [];
+        for ($r = 0; $r < $batch; $r++) { $bias = array_merge($bias, $b); }
+
+        $expected = LinearAlgebra::tanh(
+            LinearAlgebra::matrixAdd(LinearAlgebra::matmul($x, $w, $batch, $in, $out), $bias, $batch, $out),
+            $batch,
+            $out
+        );
+
+        $model = (new DenseModel())->addLayer($w, $b, $in, $out, Constants::LA_ACT_TANH);
+        $this->assertArray($model->predict($x, $batch), $expected, "Fused layer equals separate calls");
+
+        echo "\n";
+    }
+
+    private function testPersistence(): void {
+        echo "### Persistence ###\n";
+
+        $model = (new DenseModel())->addLayer([2, 0, 0, 3], [1, 1], 2, 2);
+        $path = tempnam(sys_get_temp_dir(), 'cmdn');
+        $model->save($path);
+
+        $loaded = DenseModel::fromFile($path);
+        unlink($path);
+
+        $this->assertArray($loaded->predict([1, 1], 1), [3, 4], "save() / fromFile() round trip");
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                (new DenseModel())->addLayer([1, 2, 3], [0, 0], 2, 2);
+            },
+            "ValueError",
+            "Weights size mismatch"
+        );
+
+        $this->assertError(
+            function() {
+                (new DenseModel())
+                    ->addLayer([1, 2], [0, 0], 1, 2)
+                    ->addLayer([1, 2, 3], [0], 3, 1)
+                    ->predict([1], 1);
+            },
+            "ValueError",
+            "Layer shape chain mismatch"
+        );
+
+        $this->assertError(
+            function() {
+                (new DenseModel())->addLayer([1], [0], 1, 1)->predict([1, 2], 1);
+            },
+            "ValueError",
+            "Input size mismatch"
+        );
+
+        $this->assertError(
+            function() {
+                (new DenseModel())->loadBinary("not a model");
+            },
+            "ValueError",
+            "Invalid model data"
+        );
+
+        $this->assertError(
+            function() {
+                // Valid header claiming 2^32 - 1 layers, and no layer data
+                (new DenseModel())->loadBinary("CMDN" . pack("V", 1) . pack("V", 0xFFFFFFFF));
+            },
+            "ValueError",
+            "Huge layer count in a truncated file"
+        );
+
+        echo "\n";
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertArray($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_array($actual) && $this->arraysEqual($actual, $expected, $epsilon)) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function arraysEqual(array $a, array $b, float $epsilon): bool {
+        if (count($a) !== count($b)) {
+            return false;
+        }
+
+        for ($i = 0; $i < count($a); $i++) {
+            if (abs($a[$i] - $b[$i]) > $epsilon) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new DenseModelTestRunner($verbose);
+$runner->runTests();
@@ -172,8 +172,8 @@ class DotProductTestRunner
         echo "Test 8: Large Vectors\n";
         echo str_repeat('-', 50) . "\n";
 
-        // Test with different sizes
-        $sizes = [100, 1000, 10000];
+        // Test with different sizes (≤ 16 uses the stack kernel, larger goes through BLAS)
+        $sizes = [3, 15, 16, 17, 100, 1000, 10000];
 
         foreach ($sizes as $size) {
             $a = array_fill(0, $size, 1.0);
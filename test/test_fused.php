@@ -0,0 +1,249 @@
+<?php
+
+/**
+ * CoralMedia Fused Operations Test Suite
+ *
+ * Fused chains must match the unfused calls:
+ * - cosineSimilarity = dot(normalize(a), normalize(b))
+ * - affineHadamard = hadamard(addScalar(scale(a)), b)
+ * - matmulAddScalar = addScalar(matmul(a, b))
+ */
+
+use CoralMedia\LinearAlgebra;
+use CoralMedia\Constants;
+
+class FusedTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia Fused Operations Test Suite ===\n\n";
+
+        $this->testCosineSimilarity();
+        $this->testAffineHadamard();
+        $this->testMatmulAddScalar();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    private function testCosineSimilarity(): void {
+        echo "### dot(normalize, normalize) ###\n";
+
+        $this->assertScalar(LinearAlgebra::cosineSimilarity([3, 4], [4, 3]), 0.96, "Cosine of [3,4] and [4,3]");
+        $this->assertScalar(LinearAlgebra::cosineSimilarity([1, 0], [0, 5]), 0.0, "Orthogonal vectors");
+        $this->assertScalar(LinearAlgebra::cosineSimilarity([2, 2, 2], [-1, -1, -1]), -1.0, "Opposite vectors");
+
+        mt_srand(11);
+        $a = [];
+        $b = [];
+        for ($i = 0; $i < 100; $i++) {
+            $a[] = mt_rand(-100, 100) / 10;
+            $b[] = mt_rand(-100, 100) / 10;
+        }
+        $unfused = LinearAlgebra::dot(LinearAlgebra::normalize($a), LinearAlgebra::normalize($b));
+        $this->assertScalar(LinearAlgebra::cosineSimilarity($a, $b), $unfused, "Matches unfused chain (n=100)");
+        $this->assertScalar(1 - LinearAlgebra::cosineSimilarity($a, $b), LinearAlgebra::distance($a, $b, Constants::LA_DIST_COS), "Matches cosine distance");
+
+        echo "\n";
+    }
+
+    private function testAffineHadamard(): void {
+        echo "### hadamard(addScalar(scale)) ###\n";
+
+        $a = [1, 2, 3, 4, 5, 6];
+        $b = [2, -1, 0.5, 3, 0, 1];
+
+        $this->assertArray(LinearAlgebra::affineHadamard($a, 3.0, 1.0, $b, 2, 3), [8, -7, 5, 39, 0, 19], "(3·A + 1) ⊙ B");
+
+        $unfused = LinearAlgebra::matrixHadamard(
+            LinearAlgebra::matrixAddScalar(LinearAlgebra::matrixScale($a, -0.5, 2, 3), 2.0, 2, 3),
+            $b,
+            2,
+            3
+        );
+        $this->assertArray(LinearAlgebra::affineHadamard($a, -0.5, 2.0, $b, 2, 3), $unfused, "Matches unfused chain");
+
+        echo "\n";
+    }
+
+    private function testMatmulAddScalar(): void {
+        echo "### addScalar(matmul) ###\n";
+
+        $a = [1, 2, 3, 4, 5, 6];
+        $b = [7, 8, 9, 10, 11, 12];
+
+        $this->assertArray(LinearAlgebra::matmulAddScalar($a, $b, 2, 3, 2, 1.0), [59, 65, 140, 155], "(2×3)·(3×2) + 1");
+
+        foreach ([[true, false], [false, true]] as [$ta, $tb]) {
+            $unfused = LinearAlgebra::matrixAddScalar(LinearAlgebra::matmul($a, $b, 2, 3, 2, $ta, $tb), -2.5, 2, 2);
+            $this->assertArray(
+                LinearAlgebra::matmulAddScalar($a, $b, 2, 3, 2, -2.5, $ta, $tb),
+                $unfused,
+                sprintf("Matches unfused chain (transpose_a=%d, transpose_b=%d)", $ta, $tb)
+            );
+        }
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::cosineSimilarity([0, 0], [1, 2]);
+            },
+            "ValueError",
+            "Zero-norm vector"
+        );
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::cosineSimilarity([1, 2, 3], [1, 2]);
+            },
+            "ValueError",
+            "Length mismatch"
+        );
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::affineHadamard([1, 2, 3], 1.0, 0.0, [1, 2, 3, 4], 2, 2);
+            },
+            "ValueError",
+            "Hadamard size mismatch"
+        );
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::matmulAddScalar([1, 2, 3], [1, 2, 3, 4], 2, 2, 2, 1.0);
+            },
+            "ValueError",
+            "Matmul size mismatch"
+        );
+
+        // Same message as the unfused chain would raise
+        $this->assertSameError(
+            fn() => LinearAlgebra::cosineSimilarity([], [1, 2]),
+            fn() => LinearAlgebra::dot(LinearAlgebra::normalize([]), LinearAlgebra::normalize([1, 2])),
+            "cosineSimilarity empty operand"
+        );
+        $this->assertSameError(
+            fn() => LinearAlgebra::affineHadamard([1, 2, 3], 2.0, 1.0, [1, 2, 3, 4], 2, 2),
+            fn() => LinearAlgebra::matrixHadamard(LinearAlgebra::matrixAddScalar(LinearAlgebra::matrixScale([1, 2, 3], 2.0, 2, 2), 1.0, 2, 2), [1, 2, 3, 4], 2, 2),
+            "affineHadamard A size mismatch"
+        );
+        $this->assertSameError(
+            fn() => LinearAlgebra::affineHadamard([1, 2, 3, 4], 2.0, 1.0, [1, 2], 2, 2),
+            fn() => LinearAlgebra::matrixHadamard(LinearAlgebra::matrixAddScalar(LinearAlgebra::matrixScale([1, 2, 3, 4], 2.0, 2, 2), 1.0, 2, 2), [1, 2], 2, 2),
+            "affineHadamard B size mismatch"
+        );
+
+        echo "\n";
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertArray($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_array($actual) && $this->arraysEqual($actual, $expected, $epsilon)) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function assertSameError(callable $fused, callable $unfused, string $description): void {
+        $messages = [];
+        foreach ([$fused, $unfused] as $fn) {
+            try {
+                $fn();
+                $messages[] = null;
+            } catch (TypeError | ValueError $e) {
+                $messages[] = get_class($e) . ": " . $e->getMessage();
+            }
+        }
+
+        if ($messages[0] !== null && $messages[0] === $messages[1]) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description} - fused: " . json_encode($messages[0]) . ", unfused: " . json_encode($messages[1]) . "\n";
+        }
+    }
+
+    private function arraysEqual(array $a, array $b, float $epsilon): bool {
+        if (count($a) !== count($b)) {
+            return false;
+        }
+
+        for ($i = 0; $i < count($a); $i++) {
+            if (abs($a[$i] - $b[$i]) > $epsilon) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new FusedTestRunner($verbose);
+$runner->runTests();
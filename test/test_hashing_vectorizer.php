@@ -0,0 +1,311 @@
+<?php
+
+/**
+ * CoralMedia Hashing Vectorizer Test Suite
+ *
+ * Tests native feature hashing:
+ * - Column and sign placement (MurmurHash3, checked against hash('murmur3a'))
+ * - tf weighting and normalization
+ * - Sparse, dense and packed output, batches
+ * - Term pipeline parity with Text::termFrequency
+ */
+
+use CoralMedia\Constants;
+use CoralMedia\LinearAlgebra;
+use CoralMedia\Text;
+use CoralMedia\Text\HashingVectorizer;
+
+class HashingVectorizerTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia Hashing Vectorizer Test Suite ===\n\n";
+
+        $this->testPlacement();
+        $this->testWeighting();
+        $this->testOutputs();
+        $this->testPipeline();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    /** Expected sparse vector for a list of terms, computed in PHP */
+    private function expected(array $terms, int $bits, bool $alternateSign, int $seed = 0): array {
+        $vector = [];
+        foreach ($terms as $term) {
+            $h = hexdec(hash('murmur3a', $term, false, ['seed' => $seed]));
+            $column = $h & ((1 << $bits) - 1);
+            $sign = ($alternateSign && ($h >> 31)) ? -1.0 : 1.0;
+            $vector[$column] = ($vector[$column] ?? 0.0) + $sign;
+        }
+        $vector = array_filter($vector, fn($v) => $v != 0.0);
+        ksort($vector);
+        return $vector;
+    }
+
+    private function testPlacement(): void {
+        echo "### Column and Sign ###\n";
+
+        $raw = ['norm' => Constants::TEXT_NORM_NONE, 'bits' => 12];
+        $terms = ['the', 'cat', 'sat', 'on', 'the', 'mat'];
+
+        $hv = new HashingVectorizer($raw + ['alternate_sign' => false]);
+        $this->assertVector($hv->transform('The cat sat on the mat.'), $this->expected($terms, 12, false), "Unsigned counts per column");
+
+        $hv = new HashingVectorizer($raw);
+        $this->assertVector($hv->transform('The cat sat on the mat.'), $this->expected($terms, 12, true), "Signed counts per column");
+
+        $hv = new HashingVectorizer($raw + ['seed' => 42]);
+        $this->assertVector($hv->transform('The cat sat on the mat.'), $this->expected($terms, 12, true, 42), "Seeded hash");
+
+        $vector = $hv->transform('alpha beta gamma delta');
+        $this->assertTrue($this->ascending(array_keys($vector)), "Columns are ascending");
+
+        echo "\n";
+    }
+
+    private function testWeighting(): void {
+        echo "### Weighting and Normalization ###\n";
+
+        $text = 'spam spam spam eggs';
+        $terms = ['spam', 'spam', 'spam', 'eggs'];
+        $base = ['bits' => 16, 'alternate_sign' => false];
+
+        $raw = $this->expected($terms, 16, false);
+
+        $log = array_map(fn($v) => log(1 + $v), $raw);
+        $hv = new HashingVectorizer($base + ['tf' => Constants::TEXT_TF_LOG, 'norm' => Constants::TEXT_NORM_NONE]);
+        $this->assertVector($hv->transform($text), $log, "log(1 + tf)");
+
+        $hv = new HashingVectorizer($base + ['tf' => Constants::TEXT_TF_BINARY, 'norm' => Constants::TEXT_NORM_NONE]);
+        $this->assertVector($hv->transform($text), array_map(fn($v) => 1.0, $raw), "Binary tf");
+
+        $hv = new HashingVectorizer($base + ['norm' => Constants::TEXT_NORM_L1]);
+        $this->assertVector($hv->transform($text), array_map(fn($v) => $v / 4, $raw), "L1 normalization");
+
+        $hv = new HashingVectorizer($base);
+        $l2 = sqrt(10);
+        $this->assertVector($hv->transform($text), array_map(fn($v) => $v / $l2, $raw), "L2 normalization (default)");
+
+        echo "\n";
+    }
+
+    private function testOutputs(): void {
+        echo "### Sparse / Dense / Packed ###\n";
+
+        $hv = new HashingVectorizer(['bits' => 8]);
+        $docs = ['x' => 'machine learning', 'y' => 'learning machines', 'z' => 'cooking recipes'];
+
+        $sparse = $hv->transform($docs);
+        $this->assertTrue(array_keys($sparse) === ['x', 'y', 'z'], "Batch keeps document keys");
+        $this->assertVector($sparse['x'], $hv->transform('machine learning'), "Batch row equals single document");
+
+        $dense = $hv->transformDense('machine learning');
+        $this->assertTrue(count($dense) === 256 && $hv->getFeatures() === 256, "Dense output has 2^bits values");
+        $this->assertScalar(LinearAlgebra::dot($dense, $dense), 1.0, "Dense output is L2-normalized");
+
+        $expected = array_fill(0, 256, 0.0);
+        foreach ($sparse['x'] as $column => $value) {
+            $expected[$column] = $value;
+        }
+        $this->assertArray($dense, $expected, "Dense matches sparse");
+
+        $packed = $hv->transformPacked(array_values($docs));
+        $this->assertTrue(strlen($packed) === 3 * 256 * 4, "Packed output is rows × 2^bits float32");
+
+        $rows = array_merge(...array_map(fn($d) => $hv->transformDense($d), array_values($docs)));
+        $this->assertArray(LinearAlgebra::unpack($packed), $rows, "Packed rows match dense rows");
+
+        $this->assertVector(Text::hashVector('machine learning', ['bits' => 8]), $sparse['x'], "Text::hashVector()");
+
+        echo "\n";
+    }
+
+    private function testPipeline(): void {
+        echo "### Term Pipeline ###\n";
+
+        $options = ['remove_diacritics' => true, 'stem' => true, 'strip_numbers' => true];
+        $text = 'Running runners ran 42 times to the Café, CAFÉ!';
+
+        $terms = [];
+        foreach (Text::termFrequency($text, $options) as $term => $count) {
+            $terms = array_merge($terms, array_fill(0, $count, (string) $term));
+        }
+
+        $hv = new HashingVectorizer($options + ['bits' => 18, 'norm' => Constants::TEXT_NORM_NONE]);
+        $this->assertVector($hv->transform($text), $this->expected($terms, 18, true), "Same terms as termFrequency()");
+
+        $hv = new HashingVectorizer(['locale' => 'ja_JP', 'bits' => 18, 'alternate_sign' => false, 'norm' => Constants::TEXT_NORM_NONE]);
+        $this->assertVector($hv->transform('私は学生です私は'), $this->expected(['私', 'は', '学生', 'です', '私', 'は'], 18, false), "Japanese segmentation");
+
+        $this->assertTrue($hv->transform('') === [], "Empty text gives an empty vector");
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                new HashingVectorizer(['bits' => 0]);
+            },
+            "ValueError",
+            "bits out of range"
+        );
+
+        $this->assertError(
+            function() {
+                (new HashingVectorizer())->transform(['ok', 42]);
+            },
+            "TypeError",
+            "Non-string document"
+        );
+
+        $this->assertError(
+            function() {
+                (new HashingVectorizer(['stem' => true, 'stem_language' => 'klingon']))->transform('hello');
+            },
+            "ValueError",
+            "Unsupported stem language"
+        );
+
+        $this->assertError(
+            function() {
+                (new HashingVectorizer(['tf' => 9]))->transform('hello');
+            },
+            "ValueError",
+            "Invalid tf weighting"
+        );
+
+        echo "\n";
+    }
+
+    private function ascending(array $keys): bool {
+        $sorted = $keys;
+        sort($sorted);
+        return $sorted === $keys;
+    }
+
+    private function assertTrue(bool $condition, string $description): void {
+        if ($condition) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+        }
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertArray($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_array($actual) && $this->arraysEqual($actual, $expected, $epsilon)) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    /** Sparse vectors: same keys in the same order, values within epsilon */
+    private function assertVector($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        $ok = is_array($actual) && array_keys($actual) === array_keys($expected);
+        if ($ok) {
+            foreach ($expected as $column => $value) {
+                if (abs($actual[$column] - $value) > $epsilon) {
+                    $ok = false;
+                    break;
+                }
+            }
+        }
+
+        if ($ok) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function arraysEqual(array $a, array $b, float $epsilon): bool {
+        if (count($a) !== count($b)) {
+            return false;
+        }
+
+        for ($i = 0; $i < count($a); $i++) {
+            if (abs($a[$i] - $b[$i]) > $epsilon) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new HashingVectorizerTestRunner($verbose);
+$runner->runTests();
@@ -4,7 +4,8 @@
 /**
  * IDF and TF-IDF Test Suite
  *
- * Tests inverse document frequency and TF-IDF scoring
+ * Tests inverse document frequency and TF-IDF scoring, in memory and
+ * over files on disk
  */
 
 use CoralMedia\Text;
@@ -32,6 +33,7 @@ class IdfTfidfTestRunner
         $this->testTfidfPipeline();
         $this->testStemming();
         $this->testEdgeCases();
+        $this->testCorpusFiles();
 
         $this->printSummary();
     }
@@ -282,6 +284,70 @@ class IdfTfidfTestRunner
         echo "\n";
     }
 
+    private function testCorpusFiles(): void
+    {
+        echo "Test 9: Corpora on Disk\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $corpus = [
+            'The cat sat on the mat',
+            'The dog sat on the log',
+            '',
+            'Running runners ran 42 times to the Café, CAFÉ!',
+        ];
+        $options = ['stem' => true, 'remove_diacritics' => true];
+
+        $dir = sys_get_temp_dir() . '/cm_corpus_' . getmypid();
+        mkdir($dir);
+
+        $paths = [];
+        foreach ($corpus as $i => $doc) {
+            $paths[] = $path = "{$dir}/doc{$i}.txt";
+            file_put_contents($path, $doc);
+        }
+        file_put_contents("{$dir}/corpus.txt", implode("\r\n", $corpus) . "\n");
+
+        $this->assertSameScores(Text::idfFromFiles($paths), Text::idf($corpus), "idfFromFiles() matches idf()");
+        $this->assertSameScores(Text::idfFromFiles($paths, $options), Text::idf($corpus, $options), "idfFromFiles() with pipeline options");
+        $this->assertSameScores(Text::idfFromCorpus("{$dir}/corpus.txt", ['smooth' => false]), Text::idf($corpus, ['smooth' => false]), "idfFromCorpus(): one document per line");
+        $this->assertEquals(Text::termFrequencyFromFile($paths[3], $options), Text::termFrequency($corpus[3], $options), "termFrequencyFromFile() matches termFrequency()");
+
+        // Larger than one 4 MiB window: no word is lost or split at a window edge
+        $big = str_repeat("alpha beta gamma\n", 300000) . "omega";
+        file_put_contents("{$dir}/big.txt", $big);
+        $tf = Text::termFrequencyFromFile("{$dir}/big.txt", ['ngrams' => [1, 2]]);
+        $this->assertTrue($tf['alpha'] === 300000 && $tf['gamma alpha'] === 299999 && $tf['gamma omega'] === 1, "Windows of a large file");
+
+        $this->assertEquals(Text::idfFromFiles([]), [], "No files");
+        $this->assertTrue($this->throws(fn() => Text::idfFromFiles(["{$dir}/missing.txt"]), ValueError::class), "Missing file throws ValueError");
+        $this->assertTrue($this->throws(fn() => Text::idfFromFiles([42]), TypeError::class), "Non-string path throws TypeError");
+
+        array_map('unlink', glob("{$dir}/*"));
+        rmdir($dir);
+
+        echo "\n";
+    }
+
+    private function assertSameScores(array $actual, array $expected, string $desc): void
+    {
+        $ok = array_keys($actual) === array_keys($expected);
+        foreach ($expected as $term => $score) {
+            $ok = $ok && abs($actual[$term] - $score) < 1e-12;
+        }
+        $this->assertTrue($ok, $desc);
+    }
+
+    private function throws(callable $fn, string $class): bool
+    {
+        try {
+            $fn();
+        } catch (Throwable $e) {
+            return $e instanceof $class;
+        }
+
+        return false;
+    }
+
     private function assertFloatEquals(float $actual, float $expected, float $tolerance, string $desc): void
     {
         $diff = abs($actual - $expected);
@@ -0,0 +1,152 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * Token Interning Test Suite
+ *
+ * Tests the opt-in intern table (Text::internTokens): identical results,
+ * memory saved on repeated tokens, the limit, and switching it off
+ */
+
+use CoralMedia\Text;
+use CoralMedia\Stemmer\Snowball;
+
+class InternTestRunner
+{
+    private $verbose = false;
+    private $passed = 0;
+    private $failed = 0;
+
+    private $text = "The cat and the hat and the bat. The cats were running, the dogs ran 42 laps.";
+
+    public function __construct(bool $verbose = false)
+    {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void
+    {
+        echo "=== CoralMedia Token Interning Test Suite ===\n\n";
+
+        $this->testSameResults();
+        $this->testMemory();
+        $this->testLimit();
+
+        Text::internTokens(0);
+        $this->printSummary();
+    }
+
+    private function testSameResults(): void
+    {
+        echo "Test 1: Same Results With Interning\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $calls = [
+            'wordBreak' => fn() => Text::wordBreak($this->text),
+            'wordBreak (options)' => fn() => Text::wordBreak($this->text, 'en_US', ['strip_numbers' => true]),
+            'wordBreakAll' => fn() => Text::wordBreakAll(['a' => $this->text, 'b' => 'the end']),
+            'termFrequency' => fn() => Text::termFrequency($this->text, ['stem' => true]),
+            'termFrequency (numbers)' => fn() => Text::termFrequency("7 7 42 x"),
+            'Snowball::stem' => fn() => array_map(fn($w) => Snowball::stem($w), ['running', 'runs', 'ran', 'a', '']),
+        ];
+
+        Text::internTokens(0);
+        $expected = array_map(fn($call) => $call(), $calls);
+
+        Text::internTokens();
+        foreach ($calls as $name => $call) {
+            $this->assertSame($call(), $expected[$name], $name);
+        }
+        $this->assertSame($call(), $expected[$name], "Second call through the populated table");
+        echo "\n";
+    }
+
+    private function testMemory(): void
+    {
+        echo "Test 2: Repeated Tokens Share Memory\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $text = str_repeat("alpha beta gamma delta epsilon ", 20000);
+
+        Text::internTokens(0);
+        $before = memory_get_usage();
+        $plain = Text::wordBreak($text);
+        $plainBytes = memory_get_usage() - $before;
+        unset($plain);
+
+        Text::internTokens();
+        $before = memory_get_usage();
+        $shared = Text::wordBreak($text);
+        $sharedBytes = memory_get_usage() - $before;
+
+        $this->assertSame(count($shared), 100000, "All tokens returned");
+        $this->assertTrue($sharedBytes < $plainBytes / 2, "Less than half the memory ({$sharedBytes} vs {$plainBytes} bytes)");
+        unset($shared);
+        echo "\n";
+    }
+
+    private function testLimit(): void
+    {
+        echo "Test 3: Limit and Switching Off\n";
+        echo str_repeat('-', 50) . "\n";
+
+        Text::internTokens(0);
+        $this->assertSame(Text::internTokens(3), 0, "Empty table when switched on");
+
+        Text::wordBreak("one two three four five one two");
+        $this->assertSame(Text::internTokens(3), 3, "Table stops growing at the limit");
+        $this->assertSame(Text::wordBreak("one two three four five six"), ["one", "two", "three", "four", "five", "six"], "Tokens past the limit are still returned");
+        $this->assertSame(Text::internTokens(0), 3, "Switching off reports the strings held");
+        $this->assertSame(Text::internTokens(), 0, "Switching off releases the table");
+
+        try {
+            Text::internTokens(-1);
+            echo "  ✗ Negative limit should throw ValueError\n";
+            $this->failed++;
+        } catch (ValueError $e) {
+            echo "  ✓ Negative limit throws ValueError\n";
+            $this->passed++;
+        }
+        echo "\n";
+    }
+
+    private function assertSame($actual, $expected, string $desc): void
+    {
+        $this->assertTrue($actual === $expected, $desc);
+        if ($actual !== $expected && $this->verbose) {
+            echo "    Expected: " . json_encode($expected, JSON_UNESCAPED_UNICODE) . "\n";
+            echo "    Got:      " . json_encode($actual, JSON_UNESCAPED_UNICODE) . "\n";
+        }
+    }
+
+    private function assertTrue(bool $condition, string $desc): void
+    {
+        if ($condition) {
+            echo "  ✓ {$desc}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$desc}\n";
+            $this->failed++;
+        }
+    }
+
+    private function printSummary(): void
+    {
+        $total = $this->passed + $this->failed;
+        echo "\n=== Test Summary ===\n";
+        echo sprintf("Total:  %d tests\n", $total);
+        echo sprintf("✓ Passed: %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed: %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Run tests
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+$runner = new InternTestRunner($verbose);
+$runner->runTests();
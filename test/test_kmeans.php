@@ -0,0 +1,252 @@
+<?php
+
+/**
+ * CoralMedia K-Means Test Suite
+ *
+ * Tests native k-means clustering:
+ * - KMeans::fit (Lloyd and mini-batch), predict
+ * - Codebook reuse via packed centroids
+ * - LinearAlgebra::kmeans
+ */
+
+use CoralMedia\LinearAlgebra;
+use CoralMedia\LinearAlgebra\KMeans;
+
+class KMeansTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia K-Means Test Suite ===\n\n";
+
+        $this->testSmallBlobs();
+        $this->testPredictAndCodebook();
+        $this->testMiniBatch();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    /** Well separated 2-D blobs around (0,0), (10,10) and (-10,10) */
+    private function blobs(int $perCluster): array {
+        mt_srand(7);
+        $centers = [[0, 0], [10, 10], [-10, 10]];
+        $x = [];
+        $truth = [];
+        for ($i = 0; $i < $perCluster; $i++) {
+            foreach ($centers as $c => $center) {
+                $x[] = $center[0] + mt_rand(-100, 100) / 100;
+                $x[] = $center[1] + mt_rand(-100, 100) / 100;
+                $truth[] = $c;
+            }
+        }
+        return [$x, $truth];
+    }
+
+    /** True if every ground-truth cluster maps to exactly one distinct label */
+    private function sameClustering(array $labels, array $truth): bool {
+        $map = [];
+        foreach ($truth as $i => $t) {
+            if (!isset($map[$t])) {
+                $map[$t] = $labels[$i];
+            } elseif ($map[$t] !== $labels[$i]) {
+                return false;
+            }
+        }
+        return count(array_unique($map)) === count($map);
+    }
+
+    private function testSmallBlobs(): void {
+        echo "### Lloyd Iterations ###\n";
+
+        [$x, $truth] = $this->blobs(50);
+        $kmeans = new KMeans(3, ['seed' => 1]);
+        $result = $kmeans->fit($x, 150, 2);
+
+        $this->assertTrue(count($result['centroids']) === 6, "Returns k × cols centroids");
+        $this->assertTrue(count($result['labels']) === 150, "Returns one label per row");
+        $this->assertTrue($this->sameClustering($result['labels'], $truth), "Recovers the three blobs");
+        $this->assertTrue($result['inertia'] > 0 && $result['inertia'] < 150, "Inertia within blob spread");
+        $this->assertTrue($result['iterations'] >= 1, "Reports iterations");
+        $this->assertScalar($kmeans->getInertia(), $result['inertia'], "getInertia() matches fit()");
+
+        // Each centroid sits at the mean of its cluster
+        $sums = [];
+        foreach ($result['labels'] as $i => $l) {
+            $sums[$l][0] = ($sums[$l][0] ?? 0) + $x[2 * $i] / 50;
+            $sums[$l][1] = ($sums[$l][1] ?? 0) + $x[2 * $i + 1] / 50;
+        }
+        $expected = [];
+        for ($j = 0; $j < 3; $j++) {
+            $expected[] = $sums[$j][0];
+            $expected[] = $sums[$j][1];
+        }
+        $this->assertArray($result['centroids'], $expected, "Centroids are cluster means", 0.001);
+
+        $again = LinearAlgebra::kmeans($x, 150, 2, 3, ['seed' => 1]);
+        $this->assertArray($again['labels'], $result['labels'], "Same seed, same labels");
+
+        echo "\n";
+    }
+
+    private function testPredictAndCodebook(): void {
+        echo "### Predict / Codebook ###\n";
+
+        [$x, $truth] = $this->blobs(20);
+        $kmeans = new KMeans(3, ['seed' => 3]);
+        $result = $kmeans->fit($x, 60, 2);
+
+        $this->assertArray($kmeans->predict($x, 60), $result['labels'], "predict() on training data matches labels");
+
+        $codebook = KMeans::fromCentroids($kmeans->getPackedCentroids(), 3, 2);
+        $this->assertArray($codebook->predict([0.2, -0.1, 9.5, 10.2], 2), array_slice($result['labels'], 0, 2), "Codebook from packed centroids");
+        $this->assertArray($codebook->getCentroids(), $result['centroids'], "Codebook centroids round-trip");
+
+        echo "\n";
+    }
+
+    private function testMiniBatch(): void {
+        echo "### Mini-batch ###\n";
+
+        [$x, $truth] = $this->blobs(400);
+        $result = LinearAlgebra::kmeans($x, 1200, 2, 3, ['batch_size' => 64, 'seed' => 5, 'max_iter' => 200]);
+
+        $this->assertTrue($this->sameClustering($result['labels'], $truth), "Mini-batch recovers the three blobs");
+        $this->assertTrue($result['inertia'] / 1200 < 1.0, "Mini-batch inertia per sample within blob spread");
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::kmeans([1, 2, 3, 4], 2, 2, 3);
+            },
+            "ValueError",
+            "k larger than the number of rows"
+        );
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::kmeans([1, 2, 3], 2, 2, 1);
+            },
+            "ValueError",
+            "Size mismatch"
+        );
+
+        $this->assertError(
+            function() {
+                new KMeans(0);
+            },
+            "ValueError",
+            "k must be positive"
+        );
+
+        $this->assertError(
+            function() {
+                KMeans::fromCentroids([1, 2, 3], 2, 2);
+            },
+            "ValueError",
+            "Codebook size mismatch"
+        );
+
+        echo "\n";
+    }
+
+    private function assertTrue(bool $condition, string $description): void {
+        if ($condition) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+        }
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertArray($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_array($actual) && $this->arraysEqual($actual, $expected, $epsilon)) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function arraysEqual(array $a, array $b, float $epsilon): bool {
+        if (count($a) !== count($b)) {
+            return false;
+        }
+
+        for ($i = 0; $i < count($a); $i++) {
+            if (abs($a[$i] - $b[$i]) > $epsilon) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new KMeansTestRunner($verbose);
+$runner->runTests();
@@ -0,0 +1,311 @@
+<?php
+
+/**
+ * CoralMedia Linear Classifier Test Suite
+ *
+ * Tests native sparse linear classifiers:
+ * - Logistic regression and linear SVM, SGD and AdaGrad
+ * - One-vs-rest multi-class, probabilities
+ * - Serialization
+ */
+
+use CoralMedia\LinearAlgebra\LinearClassifier;
+use CoralMedia\Constants;
+
+class LinearClassifierTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    private $topics = [
+        'sport'    => ['ball', 'goal', 'match', 'team'],
+        'politics' => ['vote', 'law', 'senate', 'party'],
+        'tech'     => ['cpu', 'code', 'kernel', 'compiler'],
+    ];
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia Linear Classifier Test Suite ===\n\n";
+
+        $this->testBinary();
+        $this->testMultiClass();
+        $this->testSparseRows();
+        $this->testSerialization();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    /** Synthetic term => weight documents: three topic words plus shared noise */
+    private function corpus(int $n, array $classes, int $seed): array {
+        mt_srand($seed);
+        $noise = ['the', 'a', 'today', 'news', 'new', 'big'];
+        $docs = [];
+        $labels = [];
+        for ($i = 0; $i < $n; $i++) {
+            $label = $classes[$i % count($classes)];
+            $doc = [];
+            for ($w = 0; $w < 3; $w++) {
+                $doc[$this->topics[$label][mt_rand(0, 3)]] = 0.5 + mt_rand(0, 100) / 100;
+                $doc[$noise[mt_rand(0, 5)]] = 0.3;
+            }
+            $docs[] = $doc;
+            $labels[] = $label;
+        }
+        return [$docs, $labels];
+    }
+
+    private function accuracy(array $predicted, array $expected): float {
+        $ok = 0;
+        foreach ($expected as $i => $label) {
+            $ok += ($predicted[$i] === $label) ? 1 : 0;
+        }
+        return $ok / count($expected);
+    }
+
+    private function testBinary(): void {
+        echo "### Binary ###\n";
+
+        [$docs, $labels] = $this->corpus(200, ['sport', 'politics'], 1);
+        [$test, $expected] = $this->corpus(100, ['sport', 'politics'], 2);
+
+        $log = (new LinearClassifier(['seed' => 1]))->fit($docs, $labels);
+        $this->assertTrue($this->accuracy($log->predict($test), $expected) >= 0.95, "Logistic regression (AdaGrad) accuracy");
+
+        $svm = (new LinearClassifier([
+            'loss' => Constants::LA_LOSS_HINGE,
+            'optimizer' => Constants::LA_OPT_SGD,
+            'seed' => 1,
+        ]))->fit($docs, $labels);
+        $this->assertTrue($this->accuracy($svm->predict($test), $expected) >= 0.95, "Linear SVM (SGD) accuracy");
+
+        $scores = $log->decisionFunction([['goal' => 1.0], ['vote' => 1.0]]);
+        $this->assertTrue(count($scores) === 2 && is_float($scores[0]), "Binary decision function is one score per document");
+
+        $proba = $log->predictProba([['goal' => 1.0]]);
+        $this->assertScalar($proba[0]['sport'] + $proba[0]['politics'], 1.0, "Binary probabilities sum to 1");
+        $this->assertTrue($proba[0]['sport'] > 0.5, "Topic word drives probability");
+
+        echo "\n";
+    }
+
+    private function testMultiClass(): void {
+        echo "### One-vs-rest ###\n";
+
+        $classes = ['sport', 'politics', 'tech'];
+        [$docs, $labels] = $this->corpus(300, $classes, 3);
+        [$test, $expected] = $this->corpus(150, $classes, 4);
+
+        $clf = (new LinearClassifier(['seed' => 2, 'epochs' => 10]))->fit($docs, $labels);
+
+        $this->assertArray(array_map(fn($c) => array_search($c, $clf->getClasses()), $classes), [0, 1, 2], "Classes in order of first appearance");
+        $this->assertTrue($this->accuracy($clf->predict($test), $expected) >= 0.95, "Three-class accuracy");
+        $this->assertTrue(count($clf->decisionFunction([['cpu' => 1.0]])[0]) === 3, "One score per class");
+
+        $proba = $clf->predictProba([['kernel' => 1.0, 'code' => 0.5]])[0];
+        $this->assertScalar(array_sum($proba), 1.0, "Probabilities sum to 1");
+        $this->assertTrue(array_search(max($proba), $proba) === 'tech', "Most probable class");
+        $this->assertTrue($clf->predict([['unseen' => 1.0, 'kernel' => 1.0]]) === ['tech'], "Unknown features are ignored");
+
+        echo "\n";
+    }
+
+    private function testSparseRows(): void {
+        echo "### Sparse Rows (column id => value) ###\n";
+
+        $docs = [];
+        $labels = [];
+        for ($i = 0; $i < 100; $i++) {
+            $positive = $i % 2 === 0;
+            $docs[] = $positive ? [0 => 1.0, 5 => 0.5] : [3 => 1.0, 5 => 0.5];
+            $labels[] = $positive ? 1 : 0;
+        }
+
+        $clf = (new LinearClassifier())->fit($docs, $labels);
+        $this->assertArray($clf->predict([[0 => 1.0], [3 => 1.0]]), [1, 0], "Integer features and labels");
+
+        $clf = (new LinearClassifier())->fit($docs, array_replace($labels, [2 => '1']));
+        $this->assertTrue(count($clf->getClasses()) === 2, "Numeric string label is the integer's class");
+
+        echo "\n";
+    }
+
+    private function testSerialization(): void {
+        echo "### Serialization ###\n";
+
+        [$docs, $labels] = $this->corpus(120, ['sport', 'tech'], 5);
+        $clf = (new LinearClassifier())->fit($docs, $labels);
+        $probe = [['goal' => 1.0], ['code' => 1.0]];
+
+        $restored = LinearClassifier::fromArray($clf->toArray());
+        $this->assertTrue($restored->predict($probe) === $clf->predict($probe), "toArray() / fromArray() round-trip");
+
+        $unserialized = unserialize(serialize($clf));
+        $this->assertArray($unserialized->decisionFunction($probe), $clf->decisionFunction($probe), "serialize() round-trip");
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                (new LinearClassifier())->fit([['a' => 1.0], ['b' => 1.0]], ['x']);
+            },
+            "ValueError",
+            "Label count mismatch"
+        );
+
+        $this->assertError(
+            function() {
+                (new LinearClassifier())->fit([['a' => 1.0], ['b' => 1.0]], ['x', 'x']);
+            },
+            "ValueError",
+            "Single class"
+        );
+
+        $this->assertError(
+            function() {
+                (new LinearClassifier(['loss' => 9]))->fit([['a' => 1.0], ['b' => 1.0]], ['x', 'y']);
+            },
+            "ValueError",
+            "Invalid loss"
+        );
+
+        $this->assertError(
+            function() {
+                (new LinearClassifier())->fit(['not a document', ['b' => 1.0]], ['x', 'y']);
+            },
+            "TypeError",
+            "Document must be an array"
+        );
+
+        [$docs, $labels] = $this->corpus(40, ['sport', 'tech'], 5);
+        $model = (new LinearClassifier())->fit($docs, $labels)->toArray();
+        $corrupted = [
+            "Feature column out of range" => count($model['features']),
+            "Negative feature column" => -1,
+            "Non-integer feature column" => "0",
+        ];
+        foreach ($corrupted as $description => $column) {
+            $this->assertError(
+                function() use ($model, $column) {
+                    $model['features'][array_key_first($model['features'])] = $column;
+                    LinearClassifier::fromArray($model)->predict([['goal' => 1.0]]);
+                },
+                "ValueError",
+                "Corrupted model: {$description}"
+            );
+        }
+
+        $mismatched = [
+            "Three classes for one output" => ['classes' => ['sport', 'tech', 'politics']],
+            "Two classes for three outputs" => ['outputs' => 3],
+        ];
+        foreach ($mismatched as $description => $changes) {
+            $this->assertError(
+                function() use ($model, $changes) {
+                    LinearClassifier::fromArray(array_replace($model, $changes));
+                },
+                "ValueError",
+                "Corrupted model: {$description}"
+            );
+        }
+
+        echo "\n";
+    }
+
+    private function assertTrue(bool $condition, string $description): void {
+        if ($condition) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+        }
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertArray($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_array($actual) && $this->arraysEqual($actual, $expected, $epsilon)) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function arraysEqual(array $a, array $b, float $epsilon): bool {
+        if (count($a) !== count($b)) {
+            return false;
+        }
+
+        for ($i = 0; $i < count($a); $i++) {
+            if (abs($a[$i] - $b[$i]) > $epsilon) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new LinearClassifierTestRunner($verbose);
+$runner->runTests();
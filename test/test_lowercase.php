@@ -31,6 +31,7 @@ class LowercaseTestRunner
         $this->testCyrillic();
         $this->testGerman();
         $this->testEdgeCases();
+        $this->testFastPaths();
 
         $this->printSummary();
     }
@@ -80,6 +81,7 @@ class LowercaseTestRunner
             ["İSTANBUL", "istanbul", "Turkish dotted I (tr_TR)", "tr_TR"],
             ["ISTANBUL", "ıstanbul", "Turkish dotless I (tr_TR)", "tr_TR"],
             ["İstanbul", "istanbul", "Mixed case with İ (tr_TR)", "tr_TR"],
+            ["İSTANBUL", "i\u{307}stanbul", "Dotted I expands outside tr_TR", "en_US"],
         ];
 
         foreach ($tests as [$input, $expected, $desc, $locale]) {
@@ -155,6 +157,26 @@ class LowercaseTestRunner
         echo "\n";
     }
 
+    private function testFastPaths(): void
+    {
+        echo "Test 8: ASCII and Latin-1 Fast Paths\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $tests = [
+            [str_repeat("ABCDEFGHIJKLMNOPQRSTUVWXYZ", 3), str_repeat("abcdefghijklmnopqrstuvwxyz", 3), "Long ASCII", "en_US"],
+            ["ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÐÑÒÓÔÕÖ×ØÙÚÛÜÝÞß", "àáâãäåæçèéêëìíîïðñòóôõö×øùúûüýþß", "Latin-1 letters (× and ß unchanged)", "en_US"],
+            ["CAFÉ « NAÏVE » ½", "café « naïve » ½", "Latin-1 with symbols", "fr_FR"],
+            [str_repeat("A", 40) . "Ω", str_repeat("a", 40) . "ω", "Non-Latin-1 after a long ASCII run", "en_US"],
+            ["ISTANBUL", "ıstanbul", "ASCII still follows az rules", "az_AZ"],
+            ["Ì", "i\u{307}\u{300}", "Latin-1 still follows lt rules", "lt"],
+        ];
+
+        foreach ($tests as [$input, $expected, $desc, $locale]) {
+            $this->assertLowercase($input, $expected, $desc, $locale);
+        }
+        echo "\n";
+    }
+
     private function assertLowercase(string $input, string $expected, string $desc, string $locale): void
     {
         try {
@@ -33,6 +33,8 @@ class MatmulTestRunner
         $this->testSingleElement();
         $this->testCommutativeProperty();
         $this->testAssociativeProperty();
+        $this->testFixedSize();
+        $this->testSmallKernelBoundary();
 
         $this->printSummary();
     }
@@ -320,6 +322,106 @@ class MatmulTestRunner
         echo "\n";
     }
 
+    private function testFixedSize(): void
+    {
+        echo "Test 11: Fixed-size Entry Points (3×3, 4×4)\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $A = [1, 2, 3, 4, 5, 6, 7, 8, 9];
+        $B = [9, 8, 7, 6, 5, 4, 3, 2, 1];
+        $this->assertEqualArrays(
+            CoralMedia\LinearAlgebra::matmul3x3($A, $B),
+            CoralMedia\LinearAlgebra::matmul($A, $B, 3, 3, 3),
+            "matmul3x3 matches matmul"
+        );
+
+        // Translate by (1, 2, 3) then scale by 2: homogeneous 4×4 transforms
+        $T = [1, 0, 0, 1, 0, 1, 0, 2, 0, 0, 1, 3, 0, 0, 0, 1];
+        $S = [2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1];
+        $this->assertEqualArrays(
+            CoralMedia\LinearAlgebra::matmul4x4($S, $T),
+            [2, 0, 0, 2, 0, 2, 0, 4, 0, 0, 2, 6, 0, 0, 0, 1],
+            "matmul4x4 composes transforms"
+        );
+
+        try {
+            CoralMedia\LinearAlgebra::matmul3x3([1, 2, 3], $B);
+            echo "  ✗ matmul3x3 size mismatch - no error thrown\n";
+            $this->failed++;
+        } catch (ValueError $e) {
+            echo "  ✓ matmul3x3 size mismatch throws ValueError\n";
+            $this->passed++;
+        }
+
+        try {
+            CoralMedia\LinearAlgebra::matmul([1, 2, 3, 4, 5, 6], [1, 2, 3], -2, -3, -1);
+            echo "  ✗ negative dimensions - no error thrown\n";
+            $this->failed++;
+        } catch (ValueError $e) {
+            echo "  ✓ negative dimensions throw ValueError\n";
+            $this->passed++;
+        }
+
+        echo "\n";
+    }
+
+    private function testSmallKernelBoundary(): void
+    {
+        echo "Test 12: Stack Kernel / BLAS Boundary\n";
+        echo str_repeat('-', 50) . "\n";
+
+        // 8×8 runs on the stack kernel, 9×9 through cblas_sgemm
+        foreach ([8, 9] as $size) {
+            mt_srand($size);
+            $A = [];
+            $B = [];
+            for ($i = 0; $i < $size * $size; $i++) {
+                $A[] = mt_rand(-9, 9);
+                $B[] = mt_rand(-9, 9);
+            }
+
+            foreach ([[false, false], [true, false], [false, true], [true, true]] as [$ta, $tb]) {
+                $expected = [];
+                for ($i = 0; $i < $size; $i++) {
+                    for ($j = 0; $j < $size; $j++) {
+                        $sum = 0;
+                        for ($p = 0; $p < $size; $p++) {
+                            $a = $ta ? $A[$p * $size + $i] : $A[$i * $size + $p];
+                            $b = $tb ? $B[$j * $size + $p] : $B[$p * $size + $j];
+                            $sum += $a * $b;
+                        }
+                        $expected[] = $sum;
+                    }
+                }
+
+                $this->assertMatmul($A, $B, $size, $size, $size, $expected,
+                    sprintf("(%d×%d)%s × (%d×%d)%s", $size, $size, $ta ? 'ᵀ' : '', $size, $size, $tb ? 'ᵀ' : ''),
+                    $ta, $tb
+                );
+            }
+        }
+
+        echo "\n";
+    }
+
+    private function assertEqualArrays(array $actual, array $expected, string $description): void
+    {
+        $match = count($actual) === count($expected);
+        for ($i = 0; $match && $i < count($expected); $i++) {
+            $match = abs($actual[$i] - $expected[$i]) <= 0.0001;
+        }
+
+        if ($match) {
+            echo "  ✓ {$description}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$description}\n";
+            echo "    Expected: [" . implode(', ', $expected) . "]\n";
+            echo "    Got:      [" . implode(', ', $actual) . "]\n";
+            $this->failed++;
+        }
+    }
+
     private function assertMatmul(
         array $a,
         array $b,
@@ -0,0 +1,258 @@
+<?php
+
+/**
+ * CoralMedia N-gram Test Suite
+ *
+ * Tests native n-gram generation:
+ * - Word n-grams over the term stream (ranges, stop words, stemming)
+ * - Grapheme-aware character n-grams
+ * - Hashed ids instead of strings
+ * - HashingVectorizer / Vocabulary / idf fed with n-grams
+ */
+
+use CoralMedia\Constants;
+use CoralMedia\Text;
+use CoralMedia\Text\HashingVectorizer;
+use CoralMedia\Text\Vocabulary;
+
+class NgramTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia N-gram Test Suite ===\n\n";
+
+        $this->testWordNgrams();
+        $this->testCharNgrams();
+        $this->testHashedIds();
+        $this->testVectorizers();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    /** Word n-grams computed in PHP from a list of terms */
+    private function wordNgrams(array $terms, int $min, int $max): array {
+        $ngrams = [];
+        foreach (array_keys($terms) as $i) {
+            for ($n = $min; $n <= $max && $n <= $i + 1; $n++) {
+                $ngrams[] = implode(' ', array_slice($terms, $i - $n + 1, $n));
+            }
+        }
+        return $ngrams;
+    }
+
+    private function testWordNgrams(): void {
+        echo "### Word N-grams ###\n";
+
+        $text = 'The quick brown fox jumps';
+        $words = Text::wordBreak($text);
+
+        $this->assertTrue(
+            Text::wordBreak($text, 'en_US', ['ngrams' => 2]) === ['The quick', 'quick brown', 'brown fox', 'fox jumps'],
+            "Bigrams of the words as written"
+        );
+        $this->assertTrue(
+            Text::wordBreak($text, 'en_US', ['ngrams' => [1, 3]]) === $this->wordNgrams($words, 1, 3),
+            "[1, 3] matches n-grams built in PHP"
+        );
+        $this->assertTrue(Text::wordBreak('one', 'en_US', ['ngrams' => 2]) === [], "Fewer words than n gives nothing");
+
+        $tf = Text::termFrequency('to be or not to be', ['ngrams' => 2]);
+        $this->assertTrue($tf === ['to be' => 2, 'be or' => 1, 'or not' => 1, 'not to' => 1], "termFrequency() counts bigrams");
+
+        $tf = Text::termFrequency('The quick brown fox', ['ngrams' => 2, 'stop_words' => true]);
+        $this->assertTrue(array_keys($tf) === ['quick brown', 'brown fox'], "N-grams skip stop words");
+
+        $tf = Text::termFrequency('Running dogs', ['ngrams' => [1, 2], 'stem' => true]);
+        $this->assertTrue(array_keys($tf) === ['run', 'dog', 'run dog'], "N-grams of stemmed terms");
+
+        $tf = Text::termFrequency('New York', ['ngrams' => 2, 'normalize' => true]);
+        $this->assertScalar($tf['new york'] ?? null, 1.0, "normalize divides by the number of n-grams");
+
+        echo "\n";
+    }
+
+    private function testCharNgrams(): void {
+        echo "### Character N-grams ###\n";
+
+        $this->assertTrue(
+            Text::wordBreak('cat', 'en_US', ['char_ngrams' => 3]) === [' ca', 'cat', 'at '],
+            "Trigrams of the padded word"
+        );
+        $this->assertTrue(
+            Text::wordBreak('cat', 'en_US', ['char_ngrams' => [2, 4]]) === [' c', 'ca', 'at', 't ', ' ca', 'cat', 'at ', ' cat', 'cat '],
+            "[2, 4], shortest first"
+        );
+        $this->assertTrue(
+            Text::wordBreak('naïve', 'en_US', ['char_ngrams' => 3]) === [' na', 'naï', 'aïv', 'ïve', 've '],
+            "Multibyte characters are not split"
+        );
+
+        $decomposed = "e\u{0301}te\u{0301}";
+        $this->assertTrue(
+            Text::wordBreak($decomposed, 'en_US', ['char_ngrams' => 2]) === [" e\u{0301}", "e\u{0301}t", "te\u{0301}", "e\u{0301} "],
+            "Combining accents stay with their base letter"
+        );
+
+        $tf = Text::termFrequency('Banana', ['char_ngrams' => 3]);
+        $this->assertTrue($tf === [' ba' => 1, 'ban' => 1, 'ana' => 2, 'nan' => 1, 'na ' => 1], "termFrequency() counts lowercased character n-grams");
+
+        echo "\n";
+    }
+
+    private function testHashedIds(): void {
+        echo "### Hashed Ids ###\n";
+
+        $column = fn(string $s, int $bits, int $seed = 0) => hexdec(hash('murmur3a', $s, false, ['seed' => $seed])) & ((1 << $bits) - 1);
+
+        $ids = Text::wordBreak('The cat sat', 'en_US', ['hash_bits' => 16]);
+        $this->assertTrue($ids === [$column('The', 16), $column('cat', 16), $column('sat', 16)], "wordBreak() returns MurmurHash3 columns");
+
+        $tf = Text::termFrequency('a b a b', ['ngrams' => 2, 'hash_bits' => 12, 'seed' => 7]);
+        $this->assertTrue($tf == [$column('a b', 12, 7) => 2, $column('b a', 12, 7) => 1], "termFrequency() keys counts by column");
+
+        $hv = new HashingVectorizer(['bits' => 12, 'ngrams' => 2, 'alternate_sign' => false, 'norm' => Constants::TEXT_NORM_NONE]);
+        $vector = array_map('intval', $hv->transform('a b a b'));
+        $tf = Text::termFrequency('a b a b', ['ngrams' => 2, 'hash_bits' => 12]);
+        ksort($tf);
+        $this->assertTrue($vector === $tf, "Same columns as HashingVectorizer");
+
+        echo "\n";
+    }
+
+    private function testVectorizers(): void {
+        echo "### Vectorizers ###\n";
+
+        $docs = ['red apple pie', 'green apple pie'];
+
+        $vocabulary = (new Vocabulary(['ngrams' => [1, 2]]))->fit($docs);
+        $this->assertTrue(
+            $vocabulary->getTerms() === ['apple', 'apple pie', 'green', 'green apple', 'pie', 'red', 'red apple'],
+            "Vocabulary of unigrams and bigrams"
+        );
+        $this->assertTrue($vocabulary->getId('pie red') === -1, "Bigrams do not span documents");
+
+        $idf = Text::idf($docs, ['ngrams' => 2]);
+        $this->assertTrue(array_keys($idf) === ['red apple', 'apple pie', 'green apple'], "idf() scores bigrams");
+        $this->assertTrue($idf['apple pie'] < $idf['red apple'], "Shared bigram has the lower idf");
+
+        $vocabulary = (new Vocabulary(['char_ngrams' => 3]))->fit(['ab']);
+        $this->assertTrue($vocabulary->getTerms() === [' ab', 'ab '], "Vocabulary of character n-grams");
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                Text::termFrequency('hello', ['ngrams' => [3, 2]]);
+            },
+            "ValueError",
+            "min greater than max"
+        );
+
+        $this->assertError(
+            function() {
+                Text::termFrequency('hello', ['ngrams' => 9]);
+            },
+            "ValueError",
+            "n larger than 8"
+        );
+
+        $this->assertError(
+            function() {
+                Text::termFrequency('hello', ['char_ngrams' => 'three']);
+            },
+            "TypeError",
+            "Invalid range type"
+        );
+
+        $this->assertError(
+            function() {
+                Text::termFrequency('hello', ['ngrams' => 2, 'char_ngrams' => 3]);
+            },
+            "ValueError",
+            "ngrams and char_ngrams together"
+        );
+
+        $this->assertError(
+            function() {
+                Text::wordBreak('hello', 'en_US', ['hash_bits' => 31]);
+            },
+            "ValueError",
+            "hash_bits out of range"
+        );
+
+        echo "\n";
+    }
+
+    private function assertTrue(bool $condition, string $description): void {
+        if ($condition) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+        }
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new NgramTestRunner($verbose);
+$runner->runTests();
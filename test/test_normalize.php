@@ -0,0 +1,183 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * ICU Normalize Test Suite
+ *
+ * Tests single-pass Unicode normalization (NFC, NFD, NFKC, NFKD, NFKC_Casefold)
+ */
+
+use CoralMedia\Text;
+
+class NormalizeTestRunner
+{
+    private $verbose = false;
+    private $passed = 0;
+    private $failed = 0;
+
+    public function __construct(bool $verbose = false)
+    {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void
+    {
+        echo "=== CoralMedia ICU Normalize Test Suite ===\n\n";
+
+        $this->testCanonicalForms();
+        $this->testCompatibilityForms();
+        $this->testCasefold();
+        $this->testStripMarks();
+        $this->testEdgeCases();
+
+        $this->printSummary();
+    }
+
+    private function testCanonicalForms(): void
+    {
+        echo "Test 1: Canonical Forms (NFC, NFD)\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $tests = [
+            ["cafe\u{301}", "NFC", "café", "Combining accent is composed"],
+            ["café", "NFD", "cafe\u{301}", "Precomposed letter is decomposed"],
+            ["café", "NFC", "café", "Already NFC"],
+            ["\u{212B}", "nfc", "\u{C5}", "Angstrom sign becomes Å, form name is case-insensitive"],
+            ["ﬁ", "NFC", "ﬁ", "Compatibility ligature is kept"],
+        ];
+
+        foreach ($tests as [$input, $form, $expected, $desc]) {
+            $this->assertNormalize($input, $form, false, $expected, $desc);
+        }
+        echo "\n";
+    }
+
+    private function testCompatibilityForms(): void
+    {
+        echo "Test 2: Compatibility Forms (NFKC, NFKD)\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $tests = [
+            ["ﬁnance", "NFKC", "finance", "Ligature is expanded"],
+            ["Ｆｕｌｌ ｗｉｄｔｈ", "NFKC", "Full width", "Full-width letters"],
+            ["①②③", "NFKC", "123", "Circled digits"],
+            ["x²", "NFKD", "x2", "Superscript"],
+            ["é", "NFKD", "e\u{301}", "NFKD decomposes"],
+        ];
+
+        foreach ($tests as [$input, $form, $expected, $desc]) {
+            $this->assertNormalize($input, $form, false, $expected, $desc);
+        }
+        echo "\n";
+    }
+
+    private function testCasefold(): void
+    {
+        echo "Test 3: NFKC_Casefold\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $tests = [
+            ["Hello World", "hello world", "ASCII"],
+            ["Straße", "strasse", "ß folds to ss"],
+            ["ΣΑΣ", "σασ", "Greek sigma"],
+            ["ＣＡＦÉ", "café", "Full width and case in one pass"],
+            ["İstanbul", "i\u{307}stanbul", "Dotted capital I"],
+        ];
+
+        foreach ($tests as [$input, $expected, $desc]) {
+            $this->assertNormalize($input, "NFKC_Casefold", false, $expected, $desc);
+        }
+        echo "\n";
+    }
+
+    private function testStripMarks(): void
+    {
+        echo "Test 4: Mark Stripping\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $tests = [
+            ["Crème Brûlée", "NFKC_Casefold", "creme brulee", "Matching key in one call"],
+            ["Việt Nam", "NFC", "Viet Nam", "Stacked marks"],
+            ["cafe\u{301}", "NFD", "cafe", "Decomposed form"],
+            ["Łódź", "NFKC_Casefold", "łodz", "Ł has no mark to strip"],
+            ["ｃａｆé", "NFKC", "cafe", "Compatibility and marks"],
+        ];
+
+        foreach ($tests as [$input, $form, $expected, $desc]) {
+            $this->assertNormalize($input, $form, true, $expected, $desc);
+        }
+
+        foreach (["Crème Brûlée", "Zürich", "São Paulo", "Việt Nam", "ÀÉÎÕÜ"] as $input) {
+            $expected = Text::lowercase(Text::removeDiacritics($input));
+            $this->assertNormalize($input, "NFKC_Casefold", true, $expected, "Same as lowercase(removeDiacritics('{$input}'))");
+        }
+        echo "\n";
+    }
+
+    private function testEdgeCases(): void
+    {
+        echo "Test 5: Edge Cases\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $this->assertNormalize("", "NFC", false, "", "Empty string");
+        $this->assertNormalize("123 !@#", "NFKC_Casefold", false, "123 !@#", "Digits and punctuation");
+        $this->assertNormalize(str_repeat("ﷺ", 50), "NFKC", false, str_repeat("صلى الله عليه وسلم", 50), "Large expansion");
+
+        try {
+            Text::normalize("text", "NFX");
+            echo "  ✗ Unknown form: no error thrown\n";
+            $this->failed++;
+        } catch (ValueError $e) {
+            echo "  ✓ Unknown form throws ValueError\n";
+            $this->passed++;
+        }
+        echo "\n";
+    }
+
+    private function assertNormalize(string $input, string $form, bool $stripMarks, string $expected, string $desc): void
+    {
+        try {
+            $actual = Text::normalize($input, $form, $stripMarks);
+
+            if ($actual === $expected) {
+                if ($this->verbose) {
+                    echo "  ✓ {$desc}\n";
+                    echo "    Input:    '{$input}' ({$form})\n";
+                    echo "    Output:   '{$actual}'\n";
+                } else {
+                    echo "  ✓ {$desc}\n";
+                }
+                $this->passed++;
+            } else {
+                echo "  ✗ {$desc}\n";
+                echo "    Input:    '{$input}' ({$form})\n";
+                echo "    Expected: '{$expected}'\n";
+                echo "    Got:      '{$actual}'\n";
+                $this->failed++;
+            }
+        } catch (Exception $e) {
+            echo "  ✗ {$desc}: ERROR - {$e->getMessage()}\n";
+            $this->failed++;
+        }
+    }
+
+    private function printSummary(): void
+    {
+        $total = $this->passed + $this->failed;
+        echo "\n=== Test Summary ===\n";
+        echo sprintf("Total:  %d tests\n", $total);
+        echo sprintf("✓ Passed: %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed: %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Run tests
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+$runner = new NormalizeTestRunner($verbose);
+$runner->runTests();
@@ -0,0 +1,245 @@
+<?php
+
+/**
+ * CoralMedia Matrix Reduction Test Suite
+ *
+ * Tests axis-aware reductions:
+ * - matrixSum, matrixMean, matrixVariance
+ * - matrixMin, matrixMax, matrixArgmin, matrixArgmax
+ */
+
+use CoralMedia\LinearAlgebra;
+use CoralMedia\Constants;
+
+class ReduceTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia Matrix Reduction Test Suite ===\n\n";
+
+        $this->testWholeMatrix();
+        $this->testRowAxis();
+        $this->testColumnAxis();
+        $this->testErrorHandling();
+        $this->testAgainstPhp();
+
+        $this->printSummary();
+    }
+
+    private function testWholeMatrix(): void {
+        echo "### Whole Matrix (LA_AXIS_NONE) ###\n";
+
+        $a = [1, 2, 3, 4, 5, 6];
+
+        $this->assertScalar(LinearAlgebra::matrixSum($a, 2, 3), 21.0, "Sum of 2×3 matrix");
+        $this->assertScalar(LinearAlgebra::matrixMean($a, 2, 3), 3.5, "Mean of 2×3 matrix");
+        $this->assertScalar(LinearAlgebra::matrixVariance($a, 2, 3), 35 / 12, "Population variance of 2×3 matrix");
+        $this->assertScalar(LinearAlgebra::matrixMin($a, 2, 3), 1.0, "Min of 2×3 matrix");
+        $this->assertScalar(LinearAlgebra::matrixMax($a, 2, 3), 6.0, "Max of 2×3 matrix");
+        $this->assertScalar(LinearAlgebra::matrixArgmin([3, 1, 2, 5], 2, 2), 1, "Flat argmin");
+        $this->assertScalar(LinearAlgebra::matrixArgmax([3, 1, 2, 5], 2, 2), 3, "Flat argmax");
+
+        echo "\n";
+    }
+
+    private function testRowAxis(): void {
+        echo "### Per Row (LA_AXIS_ROWS) ###\n";
+
+        $a = [1, 2, 3, 4, 5, 6];
+        $axis = Constants::LA_AXIS_ROWS;
+
+        $this->assertArray(LinearAlgebra::matrixSum($a, 2, 3, $axis), [6, 15], "Row sums");
+        $this->assertArray(LinearAlgebra::matrixMean($a, 2, 3, $axis), [2, 5], "Row means");
+        $this->assertArray(LinearAlgebra::matrixVariance($a, 2, 3, $axis), [2 / 3, 2 / 3], "Row variances");
+        $this->assertArray(LinearAlgebra::matrixMin($a, 2, 3, $axis), [1, 4], "Row minimums");
+        $this->assertArray(LinearAlgebra::matrixMax($a, 2, 3, $axis), [3, 6], "Row maximums");
+
+        // Classification scores: one row per sample
+        $scores = [0.1, 0.7, 0.2,
+                   0.6, 0.3, 0.1,
+                   0.2, 0.2, 0.6];
+        $this->assertArray(LinearAlgebra::matrixArgmax($scores, 3, 3, $axis), [1, 0, 2], "Row argmax (classification)");
+        $this->assertArray(LinearAlgebra::matrixArgmin($scores, 3, 3, $axis), [0, 2, 0], "Row argmin (first on ties)");
+
+        echo "\n";
+    }
+
+    private function testColumnAxis(): void {
+        echo "### Per Column (LA_AXIS_COLS) ###\n";
+
+        $a = [1, 2, 3, 4, 5, 6];
+        $axis = Constants::LA_AXIS_COLS;
+
+        $this->assertArray(LinearAlgebra::matrixSum($a, 2, 3, $axis), [5, 7, 9], "Column sums");
+        $this->assertArray(LinearAlgebra::matrixMean($a, 2, 3, $axis), [2.5, 3.5, 4.5], "Column means");
+        $this->assertArray(LinearAlgebra::matrixVariance($a, 2, 3, $axis), [2.25, 2.25, 2.25], "Column variances");
+        $this->assertArray(LinearAlgebra::matrixMin([4, 1, 2, 8], 2, 2, $axis), [2, 1], "Column minimums");
+        $this->assertArray(LinearAlgebra::matrixMax([4, 1, 2, 8], 2, 2, $axis), [4, 8], "Column maximums");
+        $this->assertArray(LinearAlgebra::matrixArgmin([4, 1, 2, 8], 2, 2, $axis), [1, 0], "Column argmin");
+        $this->assertArray(LinearAlgebra::matrixArgmax([4, 1, 2, 8], 2, 2, $axis), [0, 1], "Column argmax");
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::matrixSum([1, 2, 3], 2, 2);
+            },
+            "ValueError",
+            "Size mismatch"
+        );
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::matrixMean([], 0, 0);
+            },
+            "ValueError",
+            "Empty matrix"
+        );
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::matrixSum([1, 2, 3, 4], 2, 2, 7);
+            },
+            "ValueError",
+            "Invalid axis"
+        );
+
+        $this->assertError(
+            function() {
+                LinearAlgebra::matrixReduce([1, 2, 3, 4], 2, 2, 42);
+            },
+            "ValueError",
+            "Invalid operation"
+        );
+
+        echo "\n";
+    }
+
+    private function testAgainstPhp(): void {
+        echo "### Cross-check Against PHP ###\n";
+
+        mt_srand(42);
+        $rows = 37;
+        $cols = 23;
+        $a = [];
+        for ($i = 0; $i < $rows * $cols; $i++) {
+            $a[] = mt_rand(-1000, 1000) / 100;
+        }
+
+        $colMeans = array_fill(0, $cols, 0.0);
+        $rowMax = [];
+        for ($r = 0; $r < $rows; $r++) {
+            $row = array_slice($a, $r * $cols, $cols);
+            $rowMax[] = max($row);
+            for ($c = 0; $c < $cols; $c++) {
+                $colMeans[$c] += $row[$c] / $rows;
+            }
+        }
+
+        $this->assertArray(
+            LinearAlgebra::matrixMean($a, $rows, $cols, Constants::LA_AXIS_COLS),
+            $colMeans,
+            "Column means (37×23)",
+            0.001
+        );
+        $this->assertArray(
+            LinearAlgebra::matrixMax($a, $rows, $cols, Constants::LA_AXIS_ROWS),
+            $rowMax,
+            "Row maximums (37×23)",
+            0.001
+        );
+        $this->assertScalar(LinearAlgebra::matrixSum($a, $rows, $cols), array_sum($a), "Total sum (37×23)", 0.01);
+
+        echo "\n";
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertArray($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_array($actual) && $this->arraysEqual($actual, $expected, $epsilon)) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function arraysEqual(array $a, array $b, float $epsilon): bool {
+        if (count($a) !== count($b)) {
+            return false;
+        }
+
+        for ($i = 0; $i < count($a); $i++) {
+            if (abs($a[$i] - $b[$i]) > $epsilon) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new ReduceTestRunner($verbose);
+$runner->runTests();
@@ -32,6 +32,7 @@ class RemoveDiacriticsTestRunner
         $this->testVietnamese();
         $this->testMixedText();
         $this->testEdgeCases();
+        $this->testFastPaths();
 
         $this->printSummary();
     }
@@ -177,6 +178,26 @@ class RemoveDiacriticsTestRunner
         echo "\n";
     }
 
+    private function testFastPaths(): void
+    {
+        echo "Test 9: ASCII and Latin-1 Fast Paths\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $tests = [
+            [str_repeat("plain ascii ", 5), str_repeat("plain ascii ", 5), "Long ASCII is unchanged"],
+            ["ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÐÑÒÓÔÕÖ×ØÙÚÛÜÝÞß", "AAAAAAÆCEEEEIIIIÐNOOOOO×ØUUUUYÞß", "Latin-1 capitals"],
+            ["àáâãäåæçèéêëìíîïðñòóôõö÷øùúûüýþÿ", "aaaaaaæceeeeiiiiðnooooo÷øuuuuyþy", "Latin-1 small letters"],
+            ["¡Señor! ¿Qué? 25°", "¡Senor! ¿Que? 25°", "Latin-1 symbols are kept"],
+            [str_repeat("x", 40) . "é", str_repeat("x", 40) . "e", "Accent after a long ASCII run"],
+            ["Crème brûlée, Łódź", "Creme brulee, Łodz", "Falls back to ICU outside Latin-1"],
+        ];
+
+        foreach ($tests as [$input, $expected, $desc]) {
+            $this->assertRemoveDiacritics($input, $expected, $desc);
+        }
+        echo "\n";
+    }
+
     private function assertRemoveDiacritics(string $input, string $expected, string $desc): void
     {
         try {
@@ -0,0 +1,146 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * Stem Cache Test Suite
+ *
+ * Tests the per-language LRU stem cache (coralmedia.stem_cache_size):
+ * identical stems, hit/miss/eviction counters, and resizing
+ */
+
+use CoralMedia\Stemmer\Snowball;
+
+class StemCacheTestRunner
+{
+    private $verbose = false;
+    private $passed = 0;
+    private $failed = 0;
+
+    private $words = ['running', 'runs', 'ran', 'cats', 'caresses', 'ponies', 'generously', 'a', ''];
+
+    public function __construct(bool $verbose = false)
+    {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void
+    {
+        echo "=== CoralMedia Stem Cache Test Suite ===\n\n";
+
+        $this->testSameStems();
+        $this->testCounters();
+        $this->testResize();
+
+        ini_set('coralmedia.stem_cache_size', '0');
+        $this->printSummary();
+    }
+
+    private function testSameStems(): void
+    {
+        echo "Test 1: Same Stems With the Cache\n";
+        echo str_repeat('-', 50) . "\n";
+
+        ini_set('coralmedia.stem_cache_size', '0');
+        $expected = array_map(fn($w) => Snowball::stem($w), $this->words);
+        $spanish = Snowball::stem('haciéndole', 'spanish');
+
+        ini_set('coralmedia.stem_cache_size', '4');
+        for ($round = 1; $round <= 3; $round++) {
+            $this->assertSame(array_map(fn($w) => Snowball::stem($w), $this->words), $expected, "English, round {$round}");
+        }
+        $this->assertSame(Snowball::stem('haciéndole', 'spanish'), $spanish, "Spanish");
+        $this->assertSame(Snowball::stem('haciéndole', 'spanish'), $spanish, "Spanish, cached");
+        $this->assertSame(Snowball::stem('running', 'klingon'), null, "Unknown language returns null");
+        echo "\n";
+    }
+
+    private function testCounters(): void
+    {
+        echo "Test 2: Hits, Misses and Evictions\n";
+        echo str_repeat('-', 50) . "\n";
+
+        ini_set('coralmedia.stem_cache_size', '0');
+        Snowball::stem('reset');
+        ini_set('coralmedia.stem_cache_size', '3');
+
+        $before = Snowball::cacheStats()['english'];
+        foreach (['a', 'b', 'c', 'a', 'd', 'b', 'a', 'a'] as $w) {
+            Snowball::stem($w);
+        }
+        $stats = Snowball::cacheStats()['english'];
+
+        $this->assertSame($stats['size'], 3, "Size is bounded by the capacity");
+        $this->assertSame($stats['capacity'], 3, "Capacity from coralmedia.stem_cache_size");
+        $this->assertSame($stats['hits'] - $before['hits'], 3, "Hits");
+        $this->assertSame($stats['misses'] - $before['misses'], 5, "Misses");
+        $this->assertSame($stats['evictions'] - $before['evictions'], 2, "Least recently used word evicted");
+        $this->assertTrue(isset(Snowball::cacheStats()['spanish']), "One cache per language");
+        echo "\n";
+    }
+
+    private function testResize(): void
+    {
+        echo "Test 3: Resizing and Switching Off\n";
+        echo str_repeat('-', 50) . "\n";
+
+        ini_set('coralmedia.stem_cache_size', '100');
+        Snowball::stem('running');
+        $stats = Snowball::cacheStats()['english'];
+        $this->assertSame([$stats['size'], $stats['capacity']], [1, 100], "New size starts an empty cache");
+
+        ini_set('coralmedia.stem_cache_size', '0');
+        $this->assertSame(Snowball::stem('running'), 'run', "Stems without the cache");
+        $stats = Snowball::cacheStats()['english'];
+        $this->assertSame([$stats['size'], $stats['capacity']], [0, 0], "Size 0 releases the cache");
+
+        $this->assertSame(ini_set('coralmedia.stem_cache_size', '-1'), false, "Negative size rejected");
+        $this->assertSame(ini_set('coralmedia.stem_cache_size', '1048577'), false, "Size above the cap rejected");
+        $this->assertSame(ini_set('coralmedia.stem_cache_size', 'lots'), false, "Non-numeric size rejected");
+        $this->assertSame(ini_get('coralmedia.stem_cache_size'), '0', "Rejected sizes keep the previous value");
+        $this->assertSame(ini_set('coralmedia.stem_cache_size', '1048576'), '0', "Size at the cap accepted");
+        Snowball::stem('running');
+        $this->assertSame(Snowball::cacheStats()['english']['capacity'], 1048576, "Capacity at the cap");
+        ini_set('coralmedia.stem_cache_size', '0');
+        echo "\n";
+    }
+
+    private function assertSame($actual, $expected, string $desc): void
+    {
+        $this->assertTrue($actual === $expected, $desc);
+        if ($actual !== $expected && $this->verbose) {
+            echo "    Expected: " . json_encode($expected, JSON_UNESCAPED_UNICODE) . "\n";
+            echo "    Got:      " . json_encode($actual, JSON_UNESCAPED_UNICODE) . "\n";
+        }
+    }
+
+    private function assertTrue(bool $condition, string $desc): void
+    {
+        if ($condition) {
+            echo "  ✓ {$desc}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$desc}\n";
+            $this->failed++;
+        }
+    }
+
+    private function printSummary(): void
+    {
+        $total = $this->passed + $this->failed;
+        echo "\n=== Test Summary ===\n";
+        echo sprintf("Total:  %d tests\n", $total);
+        echo sprintf("✓ Passed: %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed: %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Run tests
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+$runner = new StemCacheTestRunner($verbose);
+$runner->runTests();
@@ -0,0 +1,258 @@
+<?php
+
+/**
+ * CoralMedia Stop Words Test Suite
+ *
+ * Tests native stop-word filtering:
+ * - Built-in lists selected by true, language name or ISO code
+ * - Per-call lists and registered lists
+ * - Interaction with strip_numbers, remove_diacritics and stem
+ * - HashingVectorizer / Vocabulary honoring stop_words
+ */
+
+use CoralMedia\Constants;
+use CoralMedia\Text;
+use CoralMedia\Text\HashingVectorizer;
+use CoralMedia\Text\Vocabulary;
+
+class StopWordsTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia Stop Words Test Suite ===\n\n";
+
+        $this->testBuiltInLists();
+        $this->testWordBreak();
+        $this->testTermFrequency();
+        $this->testCustomLists();
+        $this->testVectorizers();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    private function testBuiltInLists(): void {
+        echo "### Built-in Lists ###\n";
+
+        $english = Text::stopWords();
+        $this->assertTrue(in_array('the', $english) && in_array('and', $english), "English list contains 'the' and 'and'");
+        $this->assertTrue(!in_array('cat', $english), "English list does not contain 'cat'");
+
+        $sorted = $english;
+        sort($sorted, SORT_STRING);
+        $this->assertTrue($sorted === $english, "Lists are returned in byte order");
+
+        $this->assertTrue(Text::stopWords('fr') === Text::stopWords('french'), "ISO code selects the same list");
+        $this->assertTrue(in_array('und', Text::stopWords('german')), "German list contains 'und'");
+
+        foreach (['danish', 'dutch', 'finnish', 'hungarian', 'italian', 'norwegian', 'portuguese',
+                  'romanian', 'russian', 'spanish', 'swedish', 'turkish'] as $language) {
+            if (count(Text::stopWords($language)) === 0) {
+                $this->assertTrue(false, "Non-empty list for {$language}");
+                return;
+            }
+        }
+        $this->assertTrue(true, "Every stemmer language has a list");
+
+        echo "\n";
+    }
+
+    private function testWordBreak(): void {
+        echo "### Word Break ###\n";
+
+        $text = 'The cat and the hat';
+
+        $this->assertTrue(Text::wordBreak($text) === ['The', 'cat', 'and', 'the', 'hat'], "No options keeps every word");
+        $this->assertTrue(Text::wordBreak($text, 'en_US', ['stop_words' => true]) === ['cat', 'hat'], "true uses the locale's language");
+        $this->assertTrue(Text::wordBreak($text, 'en_US', ['stop_words' => 'english']) === ['cat', 'hat'], "Language name");
+        $this->assertTrue(Text::wordBreak($text, 'en_US', ['stop_words' => 'en']) === ['cat', 'hat'], "ISO code");
+        $this->assertTrue(Text::wordBreak($text, 'en_US', ['stop_words' => ['cat', 'HAT']]) === ['The', 'and', 'the'], "Per-call list, case-insensitive");
+        $this->assertTrue(Text::wordBreak($text, 'en_US', ['stop_words' => false]) === ['The', 'cat', 'and', 'the', 'hat'], "false disables filtering");
+
+        $this->assertTrue(
+            Text::wordBreak('The 3 cats and 42 hats', 'en_US', ['stop_words' => true, 'strip_numbers' => true]) === ['cats', 'hats'],
+            "Combined with strip_numbers"
+        );
+
+        echo "\n";
+    }
+
+    private function testTermFrequency(): void {
+        echo "### Term Frequency ###\n";
+
+        $text = 'The cat sat on the mat with the other cat';
+
+        $all = Text::termFrequency($text);
+        $filtered = Text::termFrequency($text, ['stop_words' => true]);
+        $expected = array_diff_key($all, array_flip(Text::stopWords('english')));
+
+        $this->assertTrue($filtered == $expected, "Same counts as filtering termFrequency() in PHP");
+        $this->assertTrue(($filtered['cat'] ?? 0) === 2 && !isset($filtered['the']), "Stop words dropped, counts kept");
+
+        $normalized = Text::termFrequency($text, ['stop_words' => true, 'normalize' => true]);
+        $this->assertScalar(array_sum($normalized), 1.0, "normalize sums to 1 over the remaining terms");
+
+        $french = Text::termFrequency('Nous étions à Paris, il fait chaud', [
+            'locale' => 'fr_FR',
+            'stop_words' => true,
+            'remove_diacritics' => true
+        ]);
+        $this->assertTrue(array_keys($french) === ['paris', 'fait', 'chaud'], "French: matched before diacritics are removed");
+
+        $stemmed = Text::termFrequency('The runners were running and ran', ['stem' => true, 'stop_words' => true]);
+        $this->assertTrue(!isset($stemmed['were']) && !isset($stemmed['and']) && isset($stemmed['run']), "Stemming after stop words");
+
+        $german = Text::termFrequency('Der Hund und die Katze', ['locale' => 'en_US', 'stem' => true, 'stem_language' => 'german', 'stop_words' => true]);
+        $this->assertTrue(!isset($german['der']) && !isset($german['und']) && count($german) === 2, "true follows stem_language when stemming");
+
+        echo "\n";
+    }
+
+    private function testCustomLists(): void {
+        echo "### Registered Lists ###\n";
+
+        $count = Text::registerStopWords('support', ['Hello', 'thanks', 'regards', 'hello']);
+        $this->assertTrue($count === 3, "registerStopWords() returns the number of distinct words");
+        $words = Text::stopWords('support');
+        sort($words);
+        $this->assertTrue($words === ['hello', 'regards', 'thanks'], "Registered list is lowercased and deduplicated");
+
+        $tf = Text::termFrequency('Hello team, the printer is broken. Thanks, regards', ['stop_words' => 'support']);
+        $this->assertTrue(array_keys($tf) === ['team', 'the', 'printer', 'is', 'broken'], "Registered list filters terms");
+
+        Text::registerStopWords('support', ['printer']);
+        $tf = Text::termFrequency('Hello printer', ['stop_words' => 'support']);
+        $this->assertTrue(array_keys($tf) === ['hello'], "Registering again replaces the list");
+
+        echo "\n";
+    }
+
+    private function testVectorizers(): void {
+        echo "### Vectorizers ###\n";
+
+        $hv = new HashingVectorizer(['bits' => 18, 'stop_words' => true, 'norm' => Constants::TEXT_NORM_NONE, 'alternate_sign' => false]);
+        $this->assertTrue(array_sum($hv->transform('the cat and the hat')) == 2.0, "HashingVectorizer hashes only the remaining terms");
+
+        $vocabulary = (new Vocabulary(['stop_words' => true]))->fit(['the cat sat', 'the dog sat', 'a cat ran']);
+        $this->assertTrue($vocabulary->getTerms() === ['cat', 'dog', 'ran', 'sat'], "Vocabulary excludes stop words");
+
+        $idf = Text::idf(['the cat', 'the dog'], ['stop_words' => true]);
+        $this->assertTrue(!isset($idf['the']) && isset($idf['cat']), "idf() honors stop_words");
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                Text::termFrequency('hello', ['stop_words' => 'klingon']);
+            },
+            "ValueError",
+            "Unknown list"
+        );
+
+        $this->assertError(
+            function() {
+                Text::wordBreak('私は学生です', 'ja_JP', ['stop_words' => true]);
+            },
+            "ValueError",
+            "No list for the locale's language"
+        );
+
+        $this->assertError(
+            function() {
+                Text::termFrequency('hello', ['stop_words' => 42]);
+            },
+            "TypeError",
+            "Invalid stop_words type"
+        );
+
+        $this->assertError(
+            function() {
+                Text::termFrequency('hello', ['stop_words' => ['ok', 42]]);
+            },
+            "TypeError",
+            "Non-string stop word"
+        );
+
+        $this->assertError(
+            function() {
+                Text::stopWords('klingon');
+            },
+            "ValueError",
+            "stopWords() with an unknown list"
+        );
+
+        echo "\n";
+    }
+
+    private function assertTrue(bool $condition, string $description): void {
+        if ($condition) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+        }
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new StopWordsTestRunner($verbose);
+$runner->runTests();
@@ -0,0 +1,189 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * Token Stream Test Suite
+ *
+ * Tests the streaming word tokenizer (Text::wordBreakStream / TokenStream):
+ * parity with wordBreak() at every chunk size, files and resources, rewind,
+ * and error handling
+ */
+
+use CoralMedia\Text;
+use CoralMedia\Text\TokenStream;
+
+class TokenStreamTestRunner
+{
+    private $verbose = false;
+    private $passed = 0;
+    private $failed = 0;
+
+    private $texts = [
+        'en_US' => "The quick brown fox can't jump over 3.14 lazy dogs' U.S.A. e-mail.\nNew line here.  Done",
+        'ja_JP' => "私は学生です。東京大学で日本語を勉強しています。今日はいい天気ですね",
+        'th_TH' => "ภาษาไทยไม่มีการเว้นวรรคระหว่างคำ ทดสอบการตัดคำ",
+        'fr_FR' => "Crème brûlée à Zürich, São Paulo : naïve café 👍🏽 famille 👨‍👩‍👧 fin",
+    ];
+
+    public function __construct(bool $verbose = false)
+    {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void
+    {
+        echo "=== CoralMedia Token Stream Test Suite ===\n\n";
+
+        $this->testChunkParity();
+        $this->testSources();
+        $this->testRewind();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    private function memoryStream(string $text)
+    {
+        $handle = fopen('php://memory', 'w+b');
+        fwrite($handle, $text);
+        rewind($handle);
+        return $handle;
+    }
+
+    private function testChunkParity(): void
+    {
+        echo "Test 1: Same Words as wordBreak() at Every Chunk Size\n";
+        echo str_repeat('-', 50) . "\n";
+
+        foreach ($this->texts as $locale => $text) {
+            $expected = Text::wordBreak($text, $locale);
+            $bad = [];
+
+            for ($chunk = 1; $chunk <= strlen($text) + 1; $chunk++) {
+                $stream = new TokenStream($this->memoryStream($text), $locale, ['chunk_size' => $chunk]);
+                if (iterator_to_array($stream) !== $expected) {
+                    $bad[] = $chunk;
+                }
+            }
+
+            $this->assertSame($bad, [], "{$locale}: words never split at a chunk edge");
+        }
+
+        $stream = Text::wordBreakStream($this->memoryStream("one two three"), 'en_US', ['chunk_size' => 4]);
+        $this->assertSame(iterator_to_array($stream), [0 => 'one', 1 => 'two', 2 => 'three'], "Keys are the running token number");
+
+        $this->assertSame(iterator_to_array(Text::wordBreakStream($this->memoryStream(""))), [], "Empty stream");
+        $this->assertSame(iterator_to_array(Text::wordBreakStream($this->memoryStream(" ,. \n"))), [], "No words");
+        echo "\n";
+    }
+
+    private function testSources(): void
+    {
+        echo "Test 2: Files and Resources\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $text = str_repeat($this->texts['en_US'] . "\n", 2000);
+        $path = tempnam(sys_get_temp_dir(), 'cm_stream');
+        file_put_contents($path, $text);
+
+        $expected = Text::wordBreak($text);
+        $this->assertSame(iterator_to_array(Text::wordBreakStream($path)), $expected, "File path");
+
+        $handle = fopen($path, 'rb');
+        fseek($handle, strlen($this->texts['en_US']) + 1);
+        $words = iterator_to_array(new TokenStream($handle, 'en_US', ['chunk_size' => 1000]));
+        $this->assertSame(count($words), count($expected) - count(Text::wordBreak($this->texts['en_US'])), "Resource is read from its current position");
+        $this->assertTrue(is_resource($handle), "Resource is left open");
+        fclose($handle);
+
+        $before = memory_get_usage();
+        $count = 0;
+        foreach (Text::wordBreakStream($path, 'en_US', ['chunk_size' => 4096]) as $word) {
+            $count++;
+        }
+        $this->assertTrue($count === count($expected) && memory_get_usage() - $before < 64 * 1024, "Memory stays bounded by the chunk size");
+
+        unlink($path);
+        echo "\n";
+    }
+
+    private function testRewind(): void
+    {
+        echo "Test 3: Rewind\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $stream = Text::wordBreakStream($this->memoryStream("alpha beta gamma"), 'en_US', ['chunk_size' => 3]);
+        $first = iterator_to_array($stream);
+        $this->assertSame(iterator_to_array($stream), $first, "Second iteration gives the same words");
+
+        $partial = [];
+        foreach ($stream as $word) {
+            $partial[] = $word;
+            break;
+        }
+        $this->assertSame(iterator_to_array($stream), $first, "Rewind after a partial iteration");
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void
+    {
+        echo "Test 4: Error Handling\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $this->assertError(fn() => new TokenStream($this->memoryStream("x"), 'en_US', ['chunk_size' => 0]), "ValueError", "chunk_size must be > 0");
+        $this->assertError(fn() => @new TokenStream('/nonexistent/file.txt'), "ValueError", "Missing file");
+        $this->assertError(fn() => new TokenStream(42), "TypeError", "Source is neither a resource nor a path");
+        echo "\n";
+    }
+
+    private function assertSame($actual, $expected, string $desc): void
+    {
+        $this->assertTrue($actual === $expected, $desc);
+        if ($actual !== $expected && $this->verbose) {
+            echo "    Expected: " . json_encode($expected, JSON_UNESCAPED_UNICODE) . "\n";
+            echo "    Got:      " . json_encode($actual, JSON_UNESCAPED_UNICODE) . "\n";
+        }
+    }
+
+    private function assertTrue(bool $condition, string $desc): void
+    {
+        if ($condition) {
+            echo "  ✓ {$desc}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$desc}\n";
+            $this->failed++;
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $desc): void
+    {
+        try {
+            $fn();
+            echo "  ✗ {$desc} - Expected {$expectedError} but no error thrown\n";
+            $this->failed++;
+        } catch (TypeError | ValueError $e) {
+            $this->assertTrue(strpos(get_class($e), $expectedError) !== false, $desc);
+        }
+    }
+
+    private function printSummary(): void
+    {
+        $total = $this->passed + $this->failed;
+        echo "\n=== Test Summary ===\n";
+        echo sprintf("Total:  %d tests\n", $total);
+        echo sprintf("✓ Passed: %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed: %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Run tests
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+$runner = new TokenStreamTestRunner($verbose);
+$runner->runTests();
@@ -34,6 +34,7 @@ class TokenizerTestRunner
         $this->testEnglishSentenceBreak();
         $this->testMultilingualSentenceBreak();
         $this->testEdgeCases();
+        $this->testTokenFilters();
 
         $this->printSummary();
     }
@@ -269,10 +270,54 @@ class TokenizerTestRunner
         echo "\n";
     }
 
-    private function assertWordBreak(string $text, array $expected, string $desc, string $locale): void
+    private function testTokenFilters(): void
+    {
+        echo "Test 11: Token Type and Length Filters\n";
+        echo str_repeat('-', 50) . "\n";
+
+        $mixed = "Tokyo 東京 2024 に ある 3.5 カタカナ café ok";
+
+        $this->assertWordBreak($mixed, ["Tokyo", "café", "ok"], "Letters only", "ja_JP", ['types' => 'letter']);
+        $this->assertWordBreak($mixed, ["2024", "3.5"], "Numbers only", "ja_JP", ['types' => 'NUMBER']);
+        $this->assertWordBreak($mixed, ["東京", "に", "ある", "カタカナ"], "Ideographs and kana", "ja_JP", ['types' => ['ideo', 'kana']]);
+        $this->assertWordBreak("a an the cat café naïve ok", ["the", "cat", "café", "naïve"], "min_length counts code points", "en_US", ['min_length' => 3]);
+        $this->assertWordBreak("a an the cat café naïve hello", ["the", "cat", "café"], "min_length and max_length", "en_US", ['min_length' => 3, 'max_length' => 4]);
+
+        $errors = [
+            "Unknown type" => [['types' => 'emoji'], ValueError::class],
+            "Non-string type" => [['types' => 1], TypeError::class],
+            "Negative min_length" => [['min_length' => -1], ValueError::class],
+            "max_length below min_length" => [['min_length' => 3, 'max_length' => 2], ValueError::class],
+        ];
+
+        foreach ($errors as $desc => [$options, $class]) {
+            try {
+                Text::wordBreak("test", "en_US", $options);
+                echo "  ✗ {$desc} should throw {$class}\n";
+                $this->failed++;
+            } catch (TypeError | ValueError $e) {
+                $this->assertTrue($e instanceof $class, "{$desc} throws {$class}");
+            }
+        }
+
+        echo "\n";
+    }
+
+    private function assertTrue(bool $condition, string $desc): void
+    {
+        if ($condition) {
+            echo "  ✓ {$desc}\n";
+            $this->passed++;
+        } else {
+            echo "  ✗ {$desc}\n";
+            $this->failed++;
+        }
+    }
+
+    private function assertWordBreak(string $text, array $expected, string $desc, string $locale, array $options = []): void
     {
         try {
-            $actual = Text::wordBreak($text, $locale);
+            $actual = Text::wordBreak($text, $locale, $options);
 
             if ($actual === $expected) {
                 if ($this->verbose) {
@@ -0,0 +1,333 @@
+<?php
+
+/**
+ * CoralMedia Vocabulary Test Suite
+ *
+ * Tests integer term ids:
+ * - Term numbering and document frequencies
+ * - min_df / max_df / max_features pruning
+ * - Encoding (tf, idf, normalization) against Text::idf() and Text::termFrequency()
+ * - Sparse similarity, decode and export/restore
+ */
+
+use CoralMedia\Constants;
+use CoralMedia\LinearAlgebra;
+use CoralMedia\Text;
+use CoralMedia\Text\Vocabulary;
+
+class VocabularyTestRunner {
+    private $passed = 0;
+    private $failed = 0;
+    private $verbose = false;
+
+    private $corpus = [
+        'The cat sat on the mat',
+        'The dog sat on the log',
+        'Cats and dogs are friends',
+        'The end',
+    ];
+
+    public function __construct(bool $verbose = false) {
+        $this->verbose = $verbose;
+    }
+
+    public function runTests(): void {
+        echo "=== CoralMedia Vocabulary Test Suite ===\n\n";
+
+        $this->testFit();
+        $this->testPruning();
+        $this->testEncode();
+        $this->testSimilarity();
+        $this->testExport();
+        $this->testErrorHandling();
+
+        $this->printSummary();
+    }
+
+    private function testFit(): void {
+        echo "### Fit ###\n";
+
+        $vocab = (new Vocabulary())->fit($this->corpus);
+        $terms = $vocab->getTerms();
+
+        $expected = [];
+        foreach ($this->corpus as $doc) {
+            $expected = array_merge($expected, array_keys(Text::termFrequency($doc)));
+        }
+        $expected = array_values(array_unique(array_map('strval', $expected)));
+        sort($expected, SORT_STRING);
+
+        $this->assertTrue($terms === $expected, "Terms are the corpus terms in byte order");
+        $this->assertTrue($vocab->size() === count($expected), "size()");
+        $this->assertTrue($vocab->getIndex() === array_flip($terms), "Index maps term => id");
+        $this->assertTrue($vocab->getId('sat') === array_search('sat', $terms, true) && $vocab->getId('zebra') === -1, "getId()");
+
+        $idf = Text::idf($this->corpus);
+        $df = $vocab->getDocumentFrequencies();
+        $this->assertTrue($df[$vocab->getId('the')] === 3 && $df[$vocab->getId('sat')] === 2, "Document frequencies");
+
+        $expectedIdf = array_map(fn($term) => $idf[$term], $terms);
+        $this->assertArray($vocab->getIdf(), $expectedIdf, "IDF matches Text::idf()");
+
+        $rawIdf = Text::idf($this->corpus, ['smooth' => false]);
+        $raw = (new Vocabulary(['smooth' => false]))->fit($this->corpus);
+        $this->assertArray($raw->getIdf(), array_map(fn($term) => $rawIdf[$term], $terms), "Unsmoothed IDF matches Text::idf()");
+
+        $empty = (new Vocabulary(['min_df' => 2, 'max_df' => 0.5]))->fit([]);
+        $this->assertTrue($empty->size() === 0 && $empty->getTerms() === [], "Empty corpus gives an empty vocabulary");
+        $this->assertTrue($empty->encode('the cat sat') === [], "Empty vocabulary encodes to no features");
+
+        echo "\n";
+    }
+
+    private function testPruning(): void {
+        echo "### Pruning ###\n";
+
+        $vocab = (new Vocabulary(['min_df' => 2]))->fit($this->corpus);
+        $this->assertTrue($vocab->getTerms() === ['on', 'sat', 'the'], "min_df as a document count");
+
+        $vocab = (new Vocabulary(['min_df' => 2, 'max_df' => 0.5]))->fit($this->corpus);
+        $this->assertTrue($vocab->getTerms() === ['on', 'sat'], "max_df as a proportion");
+
+        $vocab = (new Vocabulary(['max_features' => 2]))->fit($this->corpus);
+        $this->assertTrue($vocab->getTerms() === ['on', 'the'], "max_features keeps the most frequent terms (ties in byte order)");
+
+        echo "\n";
+    }
+
+    private function testEncode(): void {
+        echo "### Encode ###\n";
+
+        $vocab = (new Vocabulary(['idf' => false, 'norm' => Constants::TEXT_NORM_NONE]))->fit($this->corpus);
+        $expected = [];
+        foreach (Text::termFrequency('The cat and the zebra') as $term => $count) {
+            if (($id = $vocab->getId((string) $term)) >= 0) {
+                $expected[$id] = (float) $count;
+            }
+        }
+        ksort($expected);
+        $this->assertVector($vocab->encode('The cat and the zebra'), $expected, "Raw counts by id, unknown terms dropped");
+
+        $vocab = (new Vocabulary())->fit($this->corpus);
+        $idf = Text::idf($this->corpus);
+        $tfidf = Text::tfidf('The cat sat on the mat', $idf);
+        $l2 = sqrt(array_sum(array_map(fn($v) => $v * $v, $tfidf)));
+
+        $expected = [];
+        foreach ($tfidf as $term => $score) {
+            $expected[$vocab->getId((string) $term)] = $score / $l2;
+        }
+        ksort($expected);
+        $this->assertVector($vocab->encode('The cat sat on the mat'), $expected, "L2-normalized tf-idf matches Text::tfidf()");
+
+        $vector = $vocab->encode('mat cat the');
+        $this->assertTrue($this->ascending(array_keys($vector)), "Ids are ascending");
+
+        $batch = $vocab->encode(['x' => 'the cat', 'y' => 'the dog']);
+        $this->assertTrue(array_keys($batch) === ['x', 'y'], "Batch keeps document keys");
+        $this->assertVector($batch['y'], $vocab->encode('the dog'), "Batch row equals single document");
+        $this->assertTrue($vocab->encode('') === [], "Empty text gives an empty vector");
+
+        $binary = (new Vocabulary(['tf' => Constants::TEXT_TF_BINARY, 'idf' => false, 'norm' => Constants::TEXT_NORM_NONE]))->fit($this->corpus);
+        $this->assertVector($binary->encode('the the the'), [$binary->getId('the') => 1.0], "Binary tf");
+
+        echo "\n";
+    }
+
+    private function testSimilarity(): void {
+        echo "### Sparse Similarity ###\n";
+
+        $vocab = (new Vocabulary())->fit($this->corpus);
+        $a = $vocab->encode('the cat sat');
+        $b = $vocab->encode('the dog sat');
+
+        $dot = 0.0;
+        foreach ($a as $id => $v) {
+            $dot += $v * ($b[$id] ?? 0.0);
+        }
+
+        $this->assertScalar(LinearAlgebra::sparseDot($a, $b), $dot, "sparseDot() over shared ids");
+        $this->assertScalar(LinearAlgebra::sparseCosine($a, $b), $dot, "sparseCosine() of normalized vectors");
+        $this->assertScalar(LinearAlgebra::sparseCosine($a, $a), 1.0, "Self-similarity");
+        $this->assertScalar(LinearAlgebra::sparseCosine($a, []), 0.0, "Empty vector");
+        $this->assertScalar(LinearAlgebra::sparseDot(['a' => 2.0, 'b' => 1.0], ['b' => 3.0, 'c' => 5.0]), 3.0, "String keys (tfidf() output)");
+
+        $this->assertTrue(array_keys($vocab->decode($a)) === ['cat', 'sat', 'the'], "decode() maps ids back to terms");
+
+        echo "\n";
+    }
+
+    private function testExport(): void {
+        echo "### Export / Restore ###\n";
+
+        $vocab = (new Vocabulary(['stem' => true, 'min_df' => 1]))->fit($this->corpus);
+        $restored = Vocabulary::fromArray($vocab->toArray());
+
+        $this->assertTrue($restored->getTerms() === $vocab->getTerms(), "Terms restored");
+        $this->assertVector($restored->encode('Cats sitting on mats'), $vocab->encode('Cats sitting on mats'), "Same encoding after restore");
+
+        $copy = unserialize(serialize($vocab));
+        $this->assertVector($copy->encode('the dogs'), $vocab->encode('the dogs'), "serialize() round trip");
+
+        echo "\n";
+    }
+
+    private function testErrorHandling(): void {
+        echo "### Error Handling ###\n";
+
+        $this->assertError(
+            function() {
+                (new Vocabulary(['min_df' => 3, 'max_df' => 2]))->fit(['a', 'b', 'c']);
+            },
+            "ValueError",
+            "max_df below min_df"
+        );
+
+        $this->assertError(
+            function() {
+                new Vocabulary(['max_features' => -1]);
+            },
+            "ValueError",
+            "Negative max_features"
+        );
+
+        $this->assertError(
+            function() {
+                (new Vocabulary())->fit(['ok', 42]);
+            },
+            "TypeError",
+            "Non-string document"
+        );
+
+        $this->assertError(
+            function() {
+                Vocabulary::fromArray(['terms' => ['a', 'b'], 'df' => [1, 1], 'idf' => '', 'documents' => 1]);
+            },
+            "ValueError",
+            "Mismatched model sizes"
+        );
+
+        echo "\n";
+    }
+
+    private function ascending(array $keys): bool {
+        $sorted = $keys;
+        sort($sorted);
+        return $sorted === $keys;
+    }
+
+    private function assertTrue(bool $condition, string $description): void {
+        if ($condition) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+        }
+    }
+
+    private function assertScalar($actual, float $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_numeric($actual) && abs($actual - $expected) <= $epsilon) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertArray($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        if (is_array($actual) && $this->arraysEqual($actual, $expected, $epsilon)) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    /** Sparse vectors: same keys in the same order, values within epsilon */
+    private function assertVector($actual, array $expected, string $description, float $epsilon = 0.0001): void {
+        $ok = is_array($actual) && array_keys($actual) === array_keys($expected);
+        if ($ok) {
+            foreach ($expected as $column => $value) {
+                if (abs($actual[$column] - $value) > $epsilon) {
+                    $ok = false;
+                    break;
+                }
+            }
+        }
+
+        if ($ok) {
+            $this->passed++;
+            echo "  ✓ {$description}\n";
+        } else {
+            $this->failed++;
+            echo "  ✗ {$description}\n";
+            if ($this->verbose) {
+                echo "    Expected: " . json_encode($expected) . "\n";
+                echo "    Got:      " . json_encode($actual) . "\n";
+            }
+        }
+    }
+
+    private function assertError(callable $fn, string $expectedError, string $description): void {
+        try {
+            $fn();
+            $this->failed++;
+            echo "  ✗ {$description} - Expected {$expectedError} but no error thrown\n";
+        } catch (TypeError | ValueError $e) {
+            if (strpos(get_class($e), $expectedError) !== false) {
+                $this->passed++;
+                echo "  ✓ {$description}\n";
+            } else {
+                $this->failed++;
+                echo "  ✗ {$description} - Expected {$expectedError}, got " . get_class($e) . "\n";
+            }
+        }
+    }
+
+    private function arraysEqual(array $a, array $b, float $epsilon): bool {
+        if (count($a) !== count($b)) {
+            return false;
+        }
+
+        for ($i = 0; $i < count($a); $i++) {
+            if (abs($a[$i] - $b[$i]) > $epsilon) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private function printSummary(): void {
+        $total = $this->passed + $this->failed;
+
+        echo "=== Test Summary ===\n";
+        echo sprintf("Total tests:  %d\n", $total);
+        echo sprintf("✓ Passed:     %d (%.1f%%)\n", $this->passed, ($total > 0 ? ($this->passed / $total) * 100 : 0));
+        echo sprintf("✗ Failed:     %d (%.1f%%)\n", $this->failed, ($total > 0 ? ($this->failed / $total) * 100 : 0));
+
+        if ($this->failed === 0) {
+            echo "\n✅ All tests PASSED!\n";
+        } else {
+            echo "\n⚠️  Some tests FAILED\n";
+        }
+    }
+}
+
+// Parse command-line arguments
+$verbose = in_array('-v', $argv) || in_array('--verbose', $argv);
+
+// Run tests
+$runner = new VocabularyTestRunner($verbose);
+$runner->runTests();